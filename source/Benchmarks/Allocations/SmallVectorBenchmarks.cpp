@@ -0,0 +1,166 @@
+#include "pch.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include "Entity.h"
+#include "Scope.h"
+#include "SmallVector.h"
+#include "TypeManager.h"
+#include "Vector.h"
+
+using namespace FieaGameEngine;
+
+// The containers allocate through malloc and realloc rather than new, so allocations are counted by wrapping the C allocator.
+// The wrappers replace the allocator for the whole process, which is why these benchmarks build into an executable of their own.
+// That's only done against glibc and without AddressSanitizer, which brings its own allocator. Elsewhere the benchmarks still run but report no allocation counter
+
+#if defined(__SANITIZE_ADDRESS__)
+#define FIEA_ADDRESS_SANITIZER 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define FIEA_ADDRESS_SANITIZER 1
+#endif
+#endif
+
+namespace
+{
+	std::atomic<size_t> allocations = 0;
+}
+
+#if defined(__GLIBC__) && !defined(FIEA_ADDRESS_SANITIZER)
+#define FIEA_COUNT_ALLOCATIONS 1
+
+extern "C"
+{
+	void* __libc_malloc(size_t size);
+	void* __libc_calloc(size_t count, size_t size);
+	void* __libc_realloc(void* pointer, size_t size);
+
+	void* malloc(size_t size)
+	{
+		allocations.fetch_add(1, std::memory_order_relaxed);
+		return __libc_malloc(size);
+	}
+
+	void* calloc(size_t count, size_t size)
+	{
+		allocations.fetch_add(1, std::memory_order_relaxed);
+		return __libc_calloc(count, size);
+	}
+
+	void* realloc(void* pointer, size_t size)
+	{
+		allocations.fetch_add(1, std::memory_order_relaxed);
+		return __libc_realloc(pointer, size);
+	}
+}
+#else
+#define FIEA_COUNT_ALLOCATIONS 0
+#endif
+
+namespace
+{
+	/// <summary>
+	/// Reports the allocations made since the benchmark started as an average per iteration
+	/// </summary>
+	void SetAllocationCounter(benchmark::State& state, const size_t first_allocation)
+	{
+#if FIEA_COUNT_ALLOCATIONS
+		state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations.load(std::memory_order_relaxed) - first_allocation), benchmark::Counter::kAvgIterations);
+#else
+		UNREFERENCED_LOCAL(first_allocation);
+		state.SetLabel("allocations not counted in this build");
+#endif
+	}
+
+	/// <summary>
+	/// Registers the entity signatures, torn down again when the benchmark ends
+	/// </summary>
+	class RegisteredEntity final
+	{
+	public:
+		RegisteredEntity()
+		{
+			TypeManager::AddType(Entity::TypeIdClass(), Entity::Signatures());
+		}
+
+		RegisteredEntity(const RegisteredEntity&) = delete;
+		RegisteredEntity& operator=(const RegisteredEntity&) = delete;
+
+		~RegisteredEntity()
+		{
+			TypeManager::Clear();
+		}
+	};
+}
+
+/// <summary>
+/// Builds and destroys one short list per iteration, the shape of a subscriber or signature list
+/// </summary>
+template <typename ListType>
+static void BM_ShortList(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	const size_t first_allocation = allocations.load(std::memory_order_relaxed);
+
+	for (auto _ : state)
+	{
+		ListType list;
+		for (size_t index = 0; index < count; ++index)
+		{
+			list.PushBack(static_cast<std::uintptr_t>(index));
+		}
+
+		benchmark::DoNotOptimize(list.Data());
+	}
+
+	SetAllocationCounter(state, first_allocation);
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK_TEMPLATE(BM_ShortList, Vector<std::uintptr_t>)->Arg(1)->Arg(4)->Arg(8);
+BENCHMARK_TEMPLATE(BM_ShortList, SmallVector<std::uintptr_t, 4>)->Arg(1)->Arg(4)->Arg(8);
+
+/// <summary>
+/// Builds a scope with a few attributes, the size most nested scopes stay at
+/// </summary>
+static void BM_ScopeConstruction(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	const size_t first_allocation = allocations.load(std::memory_order_relaxed);
+
+	for (auto _ : state)
+	{
+		Scope scope;
+		for (size_t index = 0; index < count; ++index)
+		{
+			// One character names stay in the string's own buffer, so only the scope's arrays are counted
+			scope.Append(std::string(1, static_cast<char>('a' + index)));
+		}
+
+		benchmark::DoNotOptimize(&scope);
+	}
+
+	SetAllocationCounter(state, first_allocation);
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ScopeConstruction)->Arg(0)->Arg(4)->Arg(8);
+
+/// <summary>
+/// Constructs an entity, whose prescribed attributes are all appended up front
+/// </summary>
+static void BM_EntityConstruction(benchmark::State& state)
+{
+	RegisteredEntity types;
+	const size_t first_allocation = allocations.load(std::memory_order_relaxed);
+
+	for (auto _ : state)
+	{
+		Entity entity;
+		benchmark::DoNotOptimize(&entity);
+	}
+
+	SetAllocationCounter(state, first_allocation);
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_EntityConstruction);
@@ -0,0 +1,168 @@
+#include "pch.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include "Action.h"
+#include "ActionIncrement.h"
+#include "AttributeHandle.h"
+#include "Entity.h"
+#include "Factory.h"
+#include "TypeManager.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// Registers the types and factories the benchmarks construct, torn down again when the benchmark ends
+	/// </summary>
+	class RegisteredTypes final
+	{
+	public:
+		RegisteredTypes()
+		{
+			TypeManager::AddType(Entity::TypeIdClass(), Entity::Signatures());
+			TypeManager::AddType(Action::TypeIdClass(), Action::Signatures());
+			TypeManager::AddType(ActionIncrement::TypeIdClass(), ActionIncrement::Signatures(), Action::TypeIdClass());
+		}
+
+		RegisteredTypes(const RegisteredTypes&) = delete;
+		RegisteredTypes& operator=(const RegisteredTypes&) = delete;
+
+		~RegisteredTypes()
+		{
+			TypeManager::Clear();
+		}
+
+	private:
+		EntityFactory entity_factory;
+		ActionIncrementFactory action_increment_factory;
+	};
+}
+
+/// <summary>
+/// Creates and destroys entities through the factory, the path a JSON load takes for every object
+/// </summary>
+static void BM_FactoryCreateEntity(benchmark::State& state)
+{
+	RegisteredTypes types;
+
+	for (auto _ : state)
+	{
+		std::unique_ptr<Scope> entity(Factory<Scope>::Create("Entity"));
+		benchmark::DoNotOptimize(entity.get());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_FactoryCreateEntity);
+
+/// <summary>
+/// Creates a derived action, whose prescribed attributes come from two registered types
+/// </summary>
+static void BM_FactoryCreateActionIncrement(benchmark::State& state)
+{
+	RegisteredTypes types;
+
+	for (auto _ : state)
+	{
+		std::unique_ptr<Scope> action(Factory<Scope>::Create("ActionIncrement"));
+		benchmark::DoNotOptimize(action.get());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_FactoryCreateActionIncrement);
+
+/// <summary>
+/// Copies an entity, which rebuilds every attribute and rewrites the external storage pointers
+/// </summary>
+static void BM_CopyEntity(benchmark::State& state)
+{
+	RegisteredTypes types;
+	const Entity prototype;
+
+	for (auto _ : state)
+	{
+		Entity copy(prototype);
+		benchmark::DoNotOptimize(&copy);
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_CopyEntity);
+
+/// <summary>
+/// Reads a prescribed attribute by name, hashing the key and walking its bucket every time
+/// </summary>
+static void BM_PrescribedAttributeFind(benchmark::State& state)
+{
+	RegisteredTypes types;
+	Entity entity;
+	const std::string key = "Position";
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(entity.Find(key));
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_PrescribedAttributeFind);
+
+/// <summary>
+/// Reads the same attribute through a handle resolved once up front
+/// </summary>
+static void BM_PrescribedAttributeHandle(benchmark::State& state)
+{
+	RegisteredTypes types;
+	Entity entity;
+	const AttributeHandle handle(Entity::TypeIdClass(), "Position");
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(&entity[handle]);
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_PrescribedAttributeHandle);
+
+/// <summary>
+/// Casts a derived action to its base through an opaque pointer, the check ActionList and Entity run on every child they update
+/// </summary>
+static void BM_RTTIAs(benchmark::State& state)
+{
+	RegisteredTypes types;
+	ActionIncrement action;
+	RTTI* rtti = &action;
+	benchmark::DoNotOptimize(rtti); // Keeps the compiler from devirtualizing the checks
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(rtti->As<Action>());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_RTTIAs);
+
+/// <summary>
+/// Checks a derived action against a base by name, the check the JSON helpers run
+/// </summary>
+static void BM_RTTIIsName(benchmark::State& state)
+{
+	using namespace std::string_literals;
+	RegisteredTypes types;
+	ActionIncrement action;
+	RTTI* rtti = &action;
+	benchmark::DoNotOptimize(rtti); // Keeps the compiler from devirtualizing the checks
+	const std::string name = "Scope"s;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(rtti->Is(name));
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_RTTIIsName);
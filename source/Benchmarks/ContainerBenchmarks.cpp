@@ -0,0 +1,722 @@
+#include "pch.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <stack>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "DefaultHash.h"
+#include "HashMap.h"
+#include "SList.h"
+#include "Stack.h"
+#include "Vector.h"
+
+using namespace FieaGameEngine;
+
+// Every benchmark here sweeps the container size and runs once per key type, the std containers are the baseline
+// Run with --benchmark_out=<file> --benchmark_out_format=json (or build the benchmarks_json target) to keep results per commit
+
+namespace
+{
+	/// <summary>
+	/// Builds the key stored at an index, distinct for every index
+	/// </summary>
+	template <typename T>
+	T MakeKey(const size_t index);
+
+	template <>
+	std::uint64_t MakeKey<std::uint64_t>(const size_t index)
+	{
+		// Spread the keys out so neither container sees a dense run of small integers
+		return static_cast<std::uint64_t>(index) * 0x9E3779B97F4A7C15ull;
+	}
+
+	template <>
+	std::string MakeKey<std::string>(const size_t index)
+	{
+		// Long enough to leave the small string buffer, like most attribute paths
+		return "Entities.Entity" + std::to_string(index) + ".Transform";
+	}
+
+	template <typename T>
+	std::vector<T> MakeKeys(const size_t count)
+	{
+		std::vector<T> keys;
+		keys.reserve(count);
+		for (size_t index = 0; index < count; ++index)
+		{
+			keys.push_back(MakeKey<T>(index));
+		}
+
+		return keys;
+	}
+
+	/// <summary>
+	/// Reduces an element to something DoNotOptimize can hold, so iteration touches every element
+	/// </summary>
+	size_t Touch(const std::uint64_t& value)
+	{
+		return static_cast<size_t>(value);
+	}
+
+	size_t Touch(const std::string& value)
+	{
+		return value.size();
+	}
+
+	/// <summary>
+	/// Applies the size sweep shared by every container benchmark
+	/// </summary>
+	void ContainerSizes(benchmark::internal::Benchmark* benchmark)
+	{
+		benchmark->RangeMultiplier(8)->Range(8, 32768)->Complexity();
+	}
+
+	/// <summary>
+	/// Applies the size sweep for the benchmarks that are linear per lookup, so quadratic overall
+	/// </summary>
+	void LinearSearchSizes(benchmark::internal::Benchmark* benchmark)
+	{
+		benchmark->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+	}
+
+	void SetCounters(benchmark::State& state, const size_t operations)
+	{
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * operations));
+		state.SetComplexityN(state.range(0));
+	}
+}
+
+#pragma region Vector
+
+template <typename T>
+static void BM_VectorPushBack(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		Vector<T> v;
+		for (const T& key : keys)
+		{
+			v.PushBack(key);
+		}
+		benchmark::DoNotOptimize(v.Size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_VectorPushBack, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_VectorPushBack, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_StdVectorPushBack(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		std::vector<T> v;
+		for (const T& key : keys)
+		{
+			v.push_back(key);
+		}
+		benchmark::DoNotOptimize(v.size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdVectorPushBack, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_StdVectorPushBack, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_VectorFind(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+	Vector<T> v;
+	for (const T& key : keys)
+	{
+		v.PushBack(key);
+	}
+
+	for (auto _ : state)
+	{
+		for (const T& key : keys)
+		{
+			benchmark::DoNotOptimize(v.Find(key));
+		}
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_VectorFind, std::uint64_t)->Apply(LinearSearchSizes);
+BENCHMARK_TEMPLATE(BM_VectorFind, std::string)->Apply(LinearSearchSizes);
+
+template <typename T>
+static void BM_StdVectorFind(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+	const std::vector<T> v(keys);
+
+	for (auto _ : state)
+	{
+		for (const T& key : keys)
+		{
+			benchmark::DoNotOptimize(std::find(v.begin(), v.end(), key));
+		}
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdVectorFind, std::uint64_t)->Apply(LinearSearchSizes);
+BENCHMARK_TEMPLATE(BM_StdVectorFind, std::string)->Apply(LinearSearchSizes);
+
+/// <summary>
+/// Empties a full vector from the front, every removal shifts the remaining elements down
+/// </summary>
+template <typename T>
+static void BM_VectorRemove(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		Vector<T> v;
+		v.Reserve(keys.size());
+		for (const T& key : keys)
+		{
+			v.PushBack(key);
+		}
+		state.ResumeTiming();
+
+		while (!v.IsEmpty())
+		{
+			v.Remove(v.begin());
+		}
+		benchmark::DoNotOptimize(v.Size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_VectorRemove, std::uint64_t)->Apply(LinearSearchSizes);
+BENCHMARK_TEMPLATE(BM_VectorRemove, std::string)->Apply(LinearSearchSizes);
+
+template <typename T>
+static void BM_StdVectorRemove(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<T> v(keys);
+		state.ResumeTiming();
+
+		while (!v.empty())
+		{
+			v.erase(v.begin());
+		}
+		benchmark::DoNotOptimize(v.size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdVectorRemove, std::uint64_t)->Apply(LinearSearchSizes);
+BENCHMARK_TEMPLATE(BM_StdVectorRemove, std::string)->Apply(LinearSearchSizes);
+
+template <typename T>
+static void BM_VectorIterate(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+	Vector<T> v;
+	for (const T& key : keys)
+	{
+		v.PushBack(key);
+	}
+
+	for (auto _ : state)
+	{
+		size_t total = 0;
+		for (const T& value : v)
+		{
+			total += Touch(value);
+		}
+		benchmark::DoNotOptimize(total);
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_VectorIterate, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_VectorIterate, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_StdVectorIterate(benchmark::State& state)
+{
+	const std::vector<T> v = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		size_t total = 0;
+		for (const T& value : v)
+		{
+			total += Touch(value);
+		}
+		benchmark::DoNotOptimize(total);
+	}
+
+	SetCounters(state, v.size());
+}
+BENCHMARK_TEMPLATE(BM_StdVectorIterate, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_StdVectorIterate, std::string)->Apply(ContainerSizes);
+
+#pragma endregion Vector
+
+#pragma region SList
+
+template <typename T>
+static void BM_SListPushBack(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		SList<T> list;
+		for (const T& key : keys)
+		{
+			list.PushBack(key);
+		}
+		benchmark::DoNotOptimize(list.Size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_SListPushBack, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_SListPushBack, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_StdListPushBack(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		std::list<T> list;
+		for (const T& key : keys)
+		{
+			list.push_back(key);
+		}
+		benchmark::DoNotOptimize(list.size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdListPushBack, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_StdListPushBack, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_SListFind(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+	SList<T> list;
+	for (const T& key : keys)
+	{
+		list.PushBack(key);
+	}
+
+	for (auto _ : state)
+	{
+		for (const T& key : keys)
+		{
+			benchmark::DoNotOptimize(list.Find(key));
+		}
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_SListFind, std::uint64_t)->Apply(LinearSearchSizes);
+BENCHMARK_TEMPLATE(BM_SListFind, std::string)->Apply(LinearSearchSizes);
+
+template <typename T>
+static void BM_StdListFind(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+	const std::list<T> list(keys.begin(), keys.end());
+
+	for (auto _ : state)
+	{
+		for (const T& key : keys)
+		{
+			benchmark::DoNotOptimize(std::find(list.begin(), list.end(), key));
+		}
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdListFind, std::uint64_t)->Apply(LinearSearchSizes);
+BENCHMARK_TEMPLATE(BM_StdListFind, std::string)->Apply(LinearSearchSizes);
+
+/// <summary>
+/// Removes every key by value in insertion order, so every removal hits the front of the list
+/// </summary>
+template <typename T>
+static void BM_SListRemove(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		SList<T> list;
+		for (const T& key : keys)
+		{
+			list.PushBack(key);
+		}
+		state.ResumeTiming();
+
+		for (const T& key : keys)
+		{
+			list.Remove(key);
+		}
+		benchmark::DoNotOptimize(list.Size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_SListRemove, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_SListRemove, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_StdListRemove(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::list<T> list(keys.begin(), keys.end());
+		state.ResumeTiming();
+
+		for (const T& key : keys)
+		{
+			list.erase(std::find(list.begin(), list.end(), key));
+		}
+		benchmark::DoNotOptimize(list.size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdListRemove, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_StdListRemove, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_SListIterate(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+	SList<T> list;
+	for (const T& key : keys)
+	{
+		list.PushBack(key);
+	}
+
+	for (auto _ : state)
+	{
+		size_t total = 0;
+		for (const T& value : list)
+		{
+			total += Touch(value);
+		}
+		benchmark::DoNotOptimize(total);
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_SListIterate, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_SListIterate, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_StdListIterate(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+	const std::list<T> list(keys.begin(), keys.end());
+
+	for (auto _ : state)
+	{
+		size_t total = 0;
+		for (const T& value : list)
+		{
+			total += Touch(value);
+		}
+		benchmark::DoNotOptimize(total);
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdListIterate, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_StdListIterate, std::string)->Apply(ContainerSizes);
+
+#pragma endregion SList
+
+#pragma region Stack
+
+/// <summary>
+/// Pushes every key and pops them all again, the pattern the JSON parser's helper stack sees
+/// </summary>
+template <typename T>
+static void BM_StackPushPop(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		Stack<T> stack;
+		for (const T& key : keys)
+		{
+			stack.Push(key);
+		}
+
+		size_t total = 0;
+		while (!stack.IsEmpty())
+		{
+			total += Touch(stack.Top());
+			stack.Pop();
+		}
+		benchmark::DoNotOptimize(total);
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StackPushPop, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_StackPushPop, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_StdStackPushPop(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		std::stack<T, std::vector<T>> stack;
+		for (const T& key : keys)
+		{
+			stack.push(key);
+		}
+
+		size_t total = 0;
+		while (!stack.empty())
+		{
+			total += Touch(stack.top());
+			stack.pop();
+		}
+		benchmark::DoNotOptimize(total);
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdStackPushPop, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_StdStackPushPop, std::string)->Apply(ContainerSizes);
+
+#pragma endregion Stack
+
+#pragma region HashMap
+
+template <typename T>
+static void BM_HashMapInsert(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		HashMap<T, size_t> map;
+		for (size_t index = 0; index < keys.size(); ++index)
+		{
+			map.Insert(std::make_pair(keys[index], index));
+		}
+		benchmark::DoNotOptimize(map.Size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_HashMapInsert, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_HashMapInsert, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_StdUnorderedMapInsert(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		std::unordered_map<T, size_t> map;
+		for (size_t index = 0; index < keys.size(); ++index)
+		{
+			map.insert(std::make_pair(keys[index], index));
+		}
+		benchmark::DoNotOptimize(map.size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdUnorderedMapInsert, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_StdUnorderedMapInsert, std::string)->Apply(ContainerSizes);
+
+/// <summary>
+/// Looks up every key that was inserted, then as many keys that never were
+/// </summary>
+template <typename T>
+static void BM_HashMapFind(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	const std::vector<T> keys = MakeKeys<T>(count * 2);
+
+	HashMap<T, size_t> map;
+	for (size_t index = 0; index < count; ++index)
+	{
+		map.Insert(std::make_pair(keys[index], index));
+	}
+
+	for (auto _ : state)
+	{
+		for (const T& key : keys)
+		{
+			benchmark::DoNotOptimize(map.Find(key));
+		}
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_HashMapFind, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_HashMapFind, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_StdUnorderedMapFind(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	const std::vector<T> keys = MakeKeys<T>(count * 2);
+
+	std::unordered_map<T, size_t> map;
+	for (size_t index = 0; index < count; ++index)
+	{
+		map.insert(std::make_pair(keys[index], index));
+	}
+
+	for (auto _ : state)
+	{
+		for (const T& key : keys)
+		{
+			benchmark::DoNotOptimize(map.find(key));
+		}
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdUnorderedMapFind, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_StdUnorderedMapFind, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_HashMapRemove(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		HashMap<T, size_t> map;
+		for (size_t index = 0; index < keys.size(); ++index)
+		{
+			map.Insert(std::make_pair(keys[index], index));
+		}
+		state.ResumeTiming();
+
+		for (const T& key : keys)
+		{
+			map.Remove(key);
+		}
+		benchmark::DoNotOptimize(map.Size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_HashMapRemove, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_HashMapRemove, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_StdUnorderedMapRemove(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::unordered_map<T, size_t> map;
+		for (size_t index = 0; index < keys.size(); ++index)
+		{
+			map.insert(std::make_pair(keys[index], index));
+		}
+		state.ResumeTiming();
+
+		for (const T& key : keys)
+		{
+			map.erase(key);
+		}
+		benchmark::DoNotOptimize(map.size());
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdUnorderedMapRemove, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_StdUnorderedMapRemove, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_HashMapIterate(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+	HashMap<T, size_t> map;
+	for (size_t index = 0; index < keys.size(); ++index)
+	{
+		map.Insert(std::make_pair(keys[index], index));
+	}
+
+	for (auto _ : state)
+	{
+		size_t total = 0;
+		for (const auto& pair : map)
+		{
+			total += pair.second;
+		}
+		benchmark::DoNotOptimize(total);
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_HashMapIterate, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_HashMapIterate, std::string)->Apply(ContainerSizes);
+
+template <typename T>
+static void BM_StdUnorderedMapIterate(benchmark::State& state)
+{
+	const std::vector<T> keys = MakeKeys<T>(static_cast<size_t>(state.range(0)));
+	std::unordered_map<T, size_t> map;
+	for (size_t index = 0; index < keys.size(); ++index)
+	{
+		map.insert(std::make_pair(keys[index], index));
+	}
+
+	for (auto _ : state)
+	{
+		size_t total = 0;
+		for (const auto& pair : map)
+		{
+			total += pair.second;
+		}
+		benchmark::DoNotOptimize(total);
+	}
+
+	SetCounters(state, keys.size());
+}
+BENCHMARK_TEMPLATE(BM_StdUnorderedMapIterate, std::uint64_t)->Apply(ContainerSizes);
+BENCHMARK_TEMPLATE(BM_StdUnorderedMapIterate, std::string)->Apply(ContainerSizes);
+
+#pragma endregion HashMap
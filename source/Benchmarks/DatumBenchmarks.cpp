@@ -0,0 +1,280 @@
+#include "pch.h"
+#include <benchmark/benchmark.h>
+#include <span>
+#include <string>
+#include "Datum.h"
+#include "DatumMath.h"
+#include "Vector.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// Fills a datum with count vectors, the layout of a positions or velocities attribute
+	/// </summary>
+	Datum MakeVectors(const size_t count, const float value)
+	{
+		Datum datum(Datum::DatumTypes::Vector);
+		datum.Reserve(count);
+		for (size_t index = 0; index < count; ++index)
+		{
+			datum.PushBack(glm::vec4(value + static_cast<float>(index)));
+		}
+
+		return datum;
+	}
+
+	constexpr float DeltaSeconds = 1.f / 60.f;
+}
+
+/// <summary>
+/// Integrates positions one element at a time, type and bounds checking every access
+/// </summary>
+static void BM_DatumIntegrateGet(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	Datum positions = MakeVectors(count, 0.f);
+	const Datum velocities = MakeVectors(count, 1.f);
+
+	for (auto _ : state)
+	{
+		for (size_t index = 0; index < count; ++index)
+		{
+			positions.Get<glm::vec4>(index) += velocities.Get<glm::vec4>(index) * DeltaSeconds;
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_DatumIntegrateGet)->RangeMultiplier(8)->Range(8, 4096);
+
+/// <summary>
+/// Integrates the same positions through spans checked once per pass
+/// </summary>
+static void BM_DatumIntegrateSpan(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	Datum positions = MakeVectors(count, 0.f);
+	const Datum velocities = MakeVectors(count, 1.f);
+
+	for (auto _ : state)
+	{
+		std::span<glm::vec4> position_span = positions.AsSpan<glm::vec4>();
+		std::span<const glm::vec4> velocity_span = velocities.AsSpan<glm::vec4>();
+		for (size_t index = 0; index < position_span.size(); ++index)
+		{
+			position_span[index] += velocity_span[index] * DeltaSeconds;
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_DatumIntegrateSpan)->RangeMultiplier(8)->Range(8, 4096);
+
+/// <summary>
+/// Integrates the same positions in one bulk call, eight floats at a time where AVX2 is available
+/// </summary>
+static void BM_DatumIntegrateBulk(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	Datum positions = MakeVectors(count, 0.f);
+	const Datum velocities = MakeVectors(count, 1.f);
+
+	for (auto _ : state)
+	{
+		DatumMath::MultiplyAdd(positions, velocities, DeltaSeconds);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	state.SetLabel(DatumMath::UsesAvx2() ? "avx2" : "sse2");
+}
+BENCHMARK(BM_DatumIntegrateBulk)->RangeMultiplier(8)->Range(8, 4096);
+
+/// <summary>
+/// Steps a float array one element at a time, the way ActionIncrement updated a single value
+/// </summary>
+static void BM_DatumStepGet(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	Datum values(Datum::DatumTypes::Float);
+	values.Resize(count);
+
+	for (auto _ : state)
+	{
+		for (size_t index = 0; index < count; ++index)
+		{
+			values.Set(values.Get<float>(index) + DeltaSeconds, index);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_DatumStepGet)->RangeMultiplier(8)->Range(8, 4096);
+
+/// <summary>
+/// Steps the same float array in one bulk call, the path ActionIncrement takes for AllElements
+/// </summary>
+static void BM_DatumStepBulk(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	Datum values(Datum::DatumTypes::Float);
+	values.Resize(count);
+
+	for (auto _ : state)
+	{
+		DatumMath::Add(values, DeltaSeconds);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_DatumStepBulk)->RangeMultiplier(8)->Range(8, 4096);
+
+/// <summary>
+/// Builds the single value datums most attributes hold and writes to a copy of each
+/// </summary>
+static void BM_DatumScalars(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		for (size_t index = 0; index < count; ++index)
+		{
+			Datum health(Datum::DatumTypes::Integer);
+			health.PushBack(static_cast<int>(index));
+			Datum copy(health);
+			copy.Set(copy.Get<int>() + 1);
+			benchmark::DoNotOptimize(copy.Get<int>());
+		}
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_DatumScalars)->RangeMultiplier(8)->Range(8, 4096);
+
+/// <summary>
+/// Parses vector attributes the way JsonTableParseHelper loads them
+/// </summary>
+static void BM_DatumParseVectors(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	const Datum source = MakeVectors(count, 0.25f);
+	Vector<std::string> texts;
+	for (size_t index = 0; index < count; ++index)
+	{
+		texts.PushBack(source.ToString(index));
+	}
+
+	for (auto _ : state)
+	{
+		Datum parsed(Datum::DatumTypes::Vector);
+		for (const std::string& text : texts)
+		{
+			parsed.PushBackFromString(text);
+		}
+
+		benchmark::DoNotOptimize(parsed.Back<glm::vec4>());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_DatumParseVectors)->RangeMultiplier(8)->Range(8, 4096);
+
+/// <summary>
+/// Formats every vector into one reused buffer
+/// </summary>
+static void BM_DatumFormatVectors(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	const Datum vectors = MakeVectors(count, 0.25f);
+	std::string buffer;
+
+	for (auto _ : state)
+	{
+		buffer.clear();
+		for (size_t index = 0; index < count; ++index)
+		{
+			vectors.AppendToString(buffer, index);
+		}
+
+		benchmark::DoNotOptimize(buffer.data());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_DatumFormatVectors)->RangeMultiplier(8)->Range(8, 4096);
+
+namespace
+{
+	/// <summary>
+	/// Builds the parsed strings a loader holds before they're stored, each long enough to live on the heap
+	/// </summary>
+	Vector<std::string> MakeStrings(const size_t count)
+	{
+		Vector<std::string> strings(count);
+		for (size_t index = 0; index < count; ++index)
+		{
+			strings.EmplaceBack(48, static_cast<char>('a' + index % 26));
+		}
+
+		return strings;
+	}
+}
+
+/// <summary>
+/// Loads strings into a datum one copy at a time
+/// </summary>
+static void BM_DatumLoadStringsCopy(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		Vector<std::string> strings = MakeStrings(count);
+		state.ResumeTiming();
+
+		Datum datum(Datum::DatumTypes::String);
+		for (const std::string& value : strings)
+		{
+			datum.PushBack(value);
+		}
+
+		benchmark::DoNotOptimize(datum.Back<std::string>().data());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_DatumLoadStringsCopy)->RangeMultiplier(8)->Range(8, 4096);
+
+/// <summary>
+/// Loads the same strings by moving them all in at once
+/// </summary>
+static void BM_DatumLoadStringsMove(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		Vector<std::string> strings = MakeStrings(count);
+		state.ResumeTiming();
+
+		Datum datum(Datum::DatumTypes::String);
+		datum.Append(std::move(strings));
+
+		benchmark::DoNotOptimize(datum.Back<std::string>().data());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_DatumLoadStringsMove)->RangeMultiplier(8)->Range(8, 4096);
@@ -0,0 +1,166 @@
+#include "pch.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "DefaultIncrement.h"
+#include "SizeLiteral.h"
+#include "Vector.h"
+#include "Datum.h"
+#include "Scope.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTableParseHelper.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// Grows by a single element, the worst case for a realloc based container
+	/// </summary>
+	struct UnitIncrement final
+	{
+		size_t operator()(size_t /*size*/, std::size_t /*capacity*/) const
+		{
+			return 1;
+		}
+	};
+
+	/// <summary>
+	/// The increment DefaultIncrement used before, kept as the baseline
+	/// </summary>
+	struct LegacyIncrement final
+	{
+		size_t operator()(size_t /*size*/, std::size_t capacity) const
+		{
+			return capacity + 1;
+		}
+	};
+
+	/// <summary>
+	/// Builds a table helper style document with a single array attribute holding count integers
+	/// </summary>
+	std::string MakeIntegerArrayJson(const size_t count)
+	{
+		std::string json = R"({ "Values": { "type": "Integer", "value": [ )";
+		for (size_t index = 0; index < count; ++index)
+		{
+			json += std::to_string(index);
+			json += (index + 1 < count) ? ", " : " ";
+		}
+		json += "] } }";
+
+		return json;
+	}
+}
+
+template <typename IncrementFunctor>
+static void BM_VectorPushBack(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		Vector<std::uint64_t> v;
+		for (size_t index = 0; index < count; ++index)
+		{
+			v.PushBack<IncrementFunctor>(index);
+		}
+		benchmark::DoNotOptimize(v.Size());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_VectorPushBack, UnitIncrement)->RangeMultiplier(4)->Range(64, 16384)->Complexity();
+BENCHMARK_TEMPLATE(BM_VectorPushBack, LegacyIncrement)->RangeMultiplier(4)->Range(64, 65536)->Complexity();
+BENCHMARK_TEMPLATE(BM_VectorPushBack, DefaultIncrement)->RangeMultiplier(4)->Range(64, 65536)->Complexity();
+
+template <typename IncrementFunctor>
+static void BM_DatumPushBack(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+
+	IncrementFunctor incrementor{};
+
+	for (auto _ : state)
+	{
+		Datum d(Datum::DatumTypes::Integer);
+		for (size_t index = 0; index < count; ++index)
+		{
+			// Datum's typed PushBack specializations always grow with the default, so grow here the same way PotentiallyReserve would
+			if (d.Size() == d.Capacity())
+			{
+				d.Reserve(d.Capacity() + std::max(1_z, incrementor(d.Size(), d.Capacity())));
+			}
+			d.PushBack(static_cast<int>(index));
+		}
+		benchmark::DoNotOptimize(d.Size());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_DatumPushBack, UnitIncrement)->RangeMultiplier(4)->Range(64, 16384)->Complexity();
+BENCHMARK_TEMPLATE(BM_DatumPushBack, LegacyIncrement)->RangeMultiplier(4)->Range(64, 65536)->Complexity();
+BENCHMARK_TEMPLATE(BM_DatumPushBack, DefaultIncrement)->RangeMultiplier(4)->Range(64, 65536)->Complexity();
+
+/// <summary>
+/// Appends many distinct attributes to one scope, then many values onto a single attribute
+/// </summary>
+static void BM_ScopeAppendStorm(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	std::vector<std::string> keys;
+	keys.reserve(count);
+	for (size_t index = 0; index < count; ++index)
+	{
+		keys.push_back("Attribute" + std::to_string(index));
+	}
+
+	for (auto _ : state)
+	{
+		Scope scope;
+		for (const std::string& key : keys)
+		{
+			scope.Append(key) = static_cast<int>(key.size());
+		}
+
+		Datum& values = scope.Append("Values");
+		values.SetType(Datum::DatumTypes::Integer);
+		for (size_t index = 0; index < count; ++index)
+		{
+			values.PushBack(static_cast<int>(index));
+		}
+		benchmark::DoNotOptimize(scope.Size());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count * 2));
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ScopeAppendStorm)->RangeMultiplier(4)->Range(64, 16384)->Complexity();
+
+/// <summary>
+/// Parses one large integer array through the table helper, which pushes every element onto the datum
+/// </summary>
+static void BM_JsonBulkLoad(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	const std::string json = MakeIntegerArrayJson(count);
+
+	for (auto _ : state)
+	{
+		Scope root;
+		JsonTableParseHelper::SharedData shared(root);
+		JsonTableParseHelper table_parse_helper;
+		JsonParseCoordinator parse_coordinator(shared);
+		parse_coordinator.AddHelper(table_parse_helper);
+
+		parse_coordinator.Parse(json);
+		benchmark::DoNotOptimize(root.Find("Values")->Size());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_JsonBulkLoad)->RangeMultiplier(4)->Range(64, 16384)->Complexity();
@@ -0,0 +1,136 @@
+#include "pch.h"
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "DefaultHash.h"
+#include "HashMap.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// The additive byte hash that DefaultHash used before, kept as the baseline
+	/// </summary>
+	size_t LegacyAdditiveHash(const std::uint8_t* data, const size_t size)
+	{
+		size_t hash = 0;
+		for (size_t index = 0; index < size; ++index)
+		{
+			hash += 33 * data[index];
+		}
+
+		return hash;
+	}
+
+	struct LegacyStringHash final
+	{
+		size_t operator()(const std::string& key) const
+		{
+			return LegacyAdditiveHash(reinterpret_cast<const std::uint8_t*>(key.c_str()), key.length());
+		}
+	};
+
+	/// <summary>
+	/// Builds the kind of keys a Scope sees
+	/// 0: prescribed attribute names, 1: numbered children and user attributes, 2: long dotted paths from JSON
+	/// </summary>
+	std::vector<std::string> MakeScopeKeys(const int64_t key_set, const size_t count)
+	{
+		static const char* attribute_names[] = { "this", "Name", "Actions", "Position", "Velocity", "Rotation", "Scale", "Health",
+			"Target", "Step", "Condition", "Then", "Else", "Subtype", "Delay", "Entities", "Sectors", "Reactions", "ClassName", "InstanceName" };
+
+		std::vector<std::string> keys;
+		keys.reserve(count);
+		for (size_t index = 0; index < count; ++index)
+		{
+			const std::string base = attribute_names[index % std::size(attribute_names)];
+			switch (key_set)
+			{
+			case 0:
+				keys.push_back(base + (index < std::size(attribute_names) ? "" : std::to_string(index / std::size(attribute_names))));
+				break;
+			case 1:
+				keys.push_back("Child" + std::to_string(index));
+				break;
+			default:
+				keys.push_back("World.Sectors.Sector" + std::to_string(index % 7) + ".Entities.Entity" + std::to_string(index) + "." + base);
+				break;
+			}
+		}
+
+		return keys;
+	}
+}
+
+static void BM_LegacyAdditiveHash(benchmark::State& state)
+{
+	const std::vector<std::string> keys = MakeScopeKeys(state.range(0), 1024);
+	LegacyStringHash hash_functor;
+
+	size_t bytes = 0;
+	for (const std::string& key : keys)
+	{
+		bytes += key.size();
+	}
+
+	for (auto _ : state)
+	{
+		for (const std::string& key : keys)
+		{
+			benchmark::DoNotOptimize(hash_functor(key));
+		}
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK(BM_LegacyAdditiveHash)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_DefaultHash(benchmark::State& state)
+{
+	const std::vector<std::string> keys = MakeScopeKeys(state.range(0), 1024);
+	DefaultHash<std::string> hash_functor;
+
+	size_t bytes = 0;
+	for (const std::string& key : keys)
+	{
+		bytes += key.size();
+	}
+
+	for (auto _ : state)
+	{
+		for (const std::string& key : keys)
+		{
+			benchmark::DoNotOptimize(hash_functor(key));
+		}
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK(BM_DefaultHash)->Arg(0)->Arg(1)->Arg(2);
+
+template <typename HashFunctor>
+static void BM_HashMapFind(benchmark::State& state)
+{
+	const std::vector<std::string> keys = MakeScopeKeys(state.range(0), static_cast<size_t>(state.range(1)));
+
+	HashMap<std::string, int, HashFunctor> map;
+	for (size_t index = 0; index < keys.size(); ++index)
+	{
+		map.Insert(std::make_pair(keys[index], static_cast<int>(index)));
+	}
+
+	for (auto _ : state)
+	{
+		for (const std::string& key : keys)
+		{
+			benchmark::DoNotOptimize(map.Find(key));
+		}
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK_TEMPLATE(BM_HashMapFind, LegacyStringHash)->ArgsProduct({ { 0, 1, 2 }, { 16, 256, 4096 } });
+BENCHMARK_TEMPLATE(BM_HashMapFind, DefaultHash<std::string>)->ArgsProduct({ { 0, 1, 2 }, { 16, 256, 4096 } });
@@ -0,0 +1,300 @@
+#include "pch.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "Atom.h"
+#include "SizeLiteral.h"
+#include "Scope.h"
+#include "ScopeSlab.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// Builds a chain of nested scopes like the entity hierarchies JsonTableParseHelper loads
+	/// Every level holds a handful of attributes, the searched for "Target" only lives in the root
+	/// </summary>
+	/// <returns> The deepest scope of the chain </returns>
+	Scope& MakeChain(Scope& root, const size_t depth)
+	{
+		root.Append("Target") = 0;
+
+		Scope* scope = &root;
+		for (size_t level = 0; level < depth; ++level)
+		{
+			for (size_t attribute = 0; attribute < 8; ++attribute)
+			{
+				scope->Append("Attribute" + std::to_string(attribute)) = static_cast<int>(level);
+			}
+
+			scope = &scope->AppendScope("Child");
+		}
+
+		return *scope;
+	}
+
+	/// <summary>
+	/// Builds a level the way a JSON load does, a flat list of objects that each hold a few attributes and one nested table
+	/// </summary>
+	void MakeLevel(Scope& root, const size_t object_count)
+	{
+		for (size_t object = 0; object < object_count; ++object)
+		{
+			Scope& child = root.AppendScope("Objects");
+			child.Append("Health") = static_cast<int>(object);
+			child.Append("Speed") = 1.0f;
+			child.AppendScope("Transform").Append("Position") = glm::vec4(0.0f);
+		}
+	}
+
+	/// <summary>
+	/// Builds a prefab template, a handful of nested objects whose attributes each hold an array like a path or an animation curve
+	/// </summary>
+	void MakePrefab(Scope& root, const size_t field_count)
+	{
+		root.Append("Name") = std::string("A prefab name long enough to live on the heap");
+		for (size_t object = 0; object < 4; ++object)
+		{
+			Scope& child = root.AppendScope("Objects");
+			for (size_t field = 0; field < field_count / 4; ++field)
+			{
+				Datum& datum = child.Append("Field" + std::to_string(field));
+				datum.SetType(Datum::DatumTypes::Vector);
+				datum.Resize(16);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Search as it was before the ancestor cache, one hashed Find per level
+	/// </summary>
+	Datum* UncachedSearch(Scope& scope, const std::string& entry)
+	{
+		for (Scope* current = &scope; current != nullptr; current = current->GetParent())
+		{
+			Datum* found = current->Find(entry);
+			if (found != nullptr)
+			{
+				return found;
+			}
+		}
+
+		return nullptr;
+	}
+}
+
+/// <summary>
+/// Finds every key of a flat scope through pre-hashed atoms, small scopes never build a lookup table
+/// </summary>
+static void BM_ScopeFind(benchmark::State& state)
+{
+	const size_t entry_count = static_cast<size_t>(state.range(0));
+	Scope scope;
+	std::vector<Atom> keys;
+	for (size_t index = 0; index < entry_count; ++index)
+	{
+		keys.emplace_back("Attribute" + std::to_string(index));
+		scope.Append(keys.back()) = static_cast<int>(index);
+	}
+
+	for (auto _ : state)
+	{
+		for (const Atom& key : keys)
+		{
+			benchmark::DoNotOptimize(scope.Find(key));
+		}
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_ScopeFind)->Arg(4)->Arg(8)->Arg(64)->Arg(512);
+
+/// <summary>
+/// Compares two equal levels, which walks every entry of every scope in order
+/// </summary>
+static void BM_ScopeEquals(benchmark::State& state)
+{
+	Scope level;
+	MakeLevel(level, static_cast<size_t>(state.range(0)));
+	const Scope copy(level);
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(level == copy);
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_ScopeEquals)->RangeMultiplier(8)->Range(8, 4096);
+
+/// <summary>
+/// Instantiates a prefab of 64 array attributes, then writes to as many of them as the argument says
+/// Copies share every array with the prefab, so only the written attributes pay for a copy of their elements
+/// </summary>
+static void BM_PrefabInstantiate(benchmark::State& state)
+{
+	const size_t mutated_count = static_cast<size_t>(state.range(0));
+	Scope prefab;
+	MakePrefab(prefab, 64);
+
+	for (auto _ : state)
+	{
+		Scope instance(prefab);
+		Datum& objects = instance["Objects"];
+		for (size_t field = 0; field < mutated_count; ++field)
+		{
+			objects[field % 4]["Field" + std::to_string(field / 4)].Set(glm::vec4(1.0f), 0);
+		}
+
+		benchmark::DoNotOptimize(&instance);
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_PrefabInstantiate)->Arg(0)->Arg(1)->Arg(8)->Arg(64);
+
+static void BM_ScopeSearchUncached(benchmark::State& state)
+{
+	Scope root;
+	Scope& leaf = MakeChain(root, static_cast<size_t>(state.range(0)));
+	const std::string target = "Target";
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(UncachedSearch(leaf, target));
+	}
+
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ScopeSearchUncached)->RangeMultiplier(2)->Range(1, 256)->Complexity();
+
+static void BM_ScopeSearch(benchmark::State& state)
+{
+	Scope root;
+	Scope& leaf = MakeChain(root, static_cast<size_t>(state.range(0)));
+	const std::string target = "Target";
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(leaf.Search(target));
+	}
+
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ScopeSearch)->RangeMultiplier(2)->Range(1, 256)->Complexity();
+
+static void BM_ScopeSearchAtom(benchmark::State& state)
+{
+	Scope root;
+	Scope& leaf = MakeChain(root, static_cast<size_t>(state.range(0)));
+	const Atom target("Target");
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(leaf.Search(target));
+	}
+
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ScopeSearchAtom)->RangeMultiplier(2)->Range(1, 256)->Complexity();
+
+/// <summary>
+/// Invalidates the cache on every search, the worst case for it
+/// </summary>
+static void BM_ScopeSearchAfterMutation(benchmark::State& state)
+{
+	Scope root;
+	Scope& leaf = MakeChain(root, static_cast<size_t>(state.range(0)));
+	const std::string target = "Target";
+	Scope& spare = root.AppendScope("Spare");
+
+	for (auto _ : state)
+	{
+		root.Adopt(spare, "Spare");
+		benchmark::DoNotOptimize(leaf.Search(target));
+	}
+
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ScopeSearchAfterMutation)->RangeMultiplier(2)->Range(1, 256)->Complexity();
+
+/// <summary>
+/// Loads and tears down a level with every scope on the heap
+/// </summary>
+static void BM_ScopeLevelHeap(benchmark::State& state)
+{
+	const size_t object_count = static_cast<size_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		Scope root;
+		MakeLevel(root, object_count);
+		benchmark::DoNotOptimize(&root);
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_ScopeLevelHeap)->RangeMultiplier(8)->Range(8, 4096);
+
+/// <summary>
+/// Loads and tears down the same level with every Scope object in one slab
+/// Only the Scope objects come from the slab, their entries and datums are still heap allocated and freed by each destructor, so teardown stays per object
+/// </summary>
+static void BM_ScopeLevelSlab(benchmark::State& state)
+{
+	const size_t object_count = static_cast<size_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		ScopeSlab slab;
+		MakeLevel(slab.Create(), object_count);
+		slab.Release();
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_ScopeLevelSlab)->RangeMultiplier(8)->Range(8, 4096);
+
+/// <summary>
+/// Despawns every object of a level one at a time, in the order they were spawned or newest first
+/// </summary>
+/// <remarks> Oldest first shifts every remaining sibling down on each removal, newest first never has anything to shift </remarks>
+template <bool NewestFirst>
+static void BM_ScopeDespawn(benchmark::State& state)
+{
+	const size_t object_count = static_cast<size_t>(state.range(0));
+	std::vector<Scope*> objects;
+	objects.reserve(object_count);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		Scope root;
+		root.AppendScope("Actions");
+		for (size_t index = 0; index < object_count; ++index)
+		{
+			objects.push_back(&root.AppendScope("Objects"));
+		}
+		if constexpr (NewestFirst)
+		{
+			std::reverse(objects.begin(), objects.end());
+		}
+		state.ResumeTiming();
+
+		for (Scope* object : objects)
+		{
+			Scope::Destroy(*object);
+		}
+
+		state.PauseTiming();
+		objects.clear();
+		root.Clear();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ScopeDespawn, false)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK_TEMPLATE(BM_ScopeDespawn, true)->RangeMultiplier(8)->Range(8, 4096);
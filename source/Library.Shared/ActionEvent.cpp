@@ -30,15 +30,22 @@ namespace FieaGameEngine
 
 			for (auto& attribute : AuxiliaryAttributes())
 			{
-				Datum& datum = message_attributed.AppendAuxililaryAttribute(attribute->first);
-				datum.SetType(attribute->second.Type());
-				for (size_t index = 0; index < attribute->second.Size(); ++index)
+				const Datum& source = attribute->second;
+				if (source.Type() == Datum::DatumTypes::Table)
 				{
-					datum[index] = attribute->second[index];
+					for (size_t index = 0; index < source.Size(); ++index)
+					{
+						message_attributed.Adopt(*source[index].Clone(), attribute->first);
+					}
+				}
+				else
+				{
+					// Shares the payload's array until either side writes to it instead of copying element by element
+					message_attributed.AppendAuxililaryAttribute(attribute->first) = source;
 				}
 			}
 
-			std::shared_ptr<Event<EventMessageAttributed>> e = std::make_shared<Event<EventMessageAttributed>>(message_attributed);
+			std::shared_ptr<Event<EventMessageAttributed>> e = std::make_shared<Event<EventMessageAttributed>>(std::move(message_attributed));
 			queue->Enqueue(e, *state.GetGameTime(), std::chrono::milliseconds(delay));
 		}
 	}
@@ -112,8 +112,8 @@ namespace FieaGameEngine
 
 	protected:
 		std::string subtype;
-		int32_t delay;
-		EventQueue* queue;
+		int32_t delay = 0;
+		EventQueue* queue = nullptr;
 	};
 
 	ConcreteFactory(ActionEvent, Scope)
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ActionIncrement.h"
+#include "DatumMath.h"
 
 namespace FieaGameEngine
 {
@@ -10,15 +11,47 @@ namespace FieaGameEngine
 	{
 	}
 
+	void ActionIncrement::SetTarget(const std::string& new_target)
+	{
+		target = new_target;
+		target_atom = Atom();
+	}
+
+	void ActionIncrement::SetTarget(std::string&& new_target)
+	{
+		target = std::move(new_target);
+		target_atom = Atom();
+	}
+
 	void ActionIncrement::Update(WorldState& /*state*/)
 	{
-		auto [datum, scope] = Search(target);
-		if (datum == nullptr)
+		// The target is a prescribed attribute, so it can change through its datum without SetTarget ever being called
+		if (target_atom.IsNull() || target_atom.String() != target)
+		{
+			target_atom = Atom(target);
+			target_datum = nullptr;
+		}
+
+		if (target_datum == nullptr || !IsUnchangedSince(target_generation, target_scope))
 		{
-			throw std::runtime_error("Target not found.");
+			std::tie(target_datum, target_scope) = Search(target_atom);
+			if (target_datum == nullptr)
+			{
+				throw std::runtime_error("Target not found.");
+			}
+
+			target_generation = Scope::Generation();
 		}
 
-		datum->Set(datum->Get<float>(0) + step);
+		if (index == AllElements)
+		{
+			DatumMath::Add(*target_datum, step);
+		}
+		else
+		{
+			const size_t element = static_cast<size_t>(index);
+			target_datum->Set(target_datum->Get<float>(element) + step, element);
+		}
 	}
 
 	const Vector<Signature> ActionIncrement::Signatures()
@@ -27,6 +60,7 @@ namespace FieaGameEngine
 		{
 			{ "Target", Datum::DatumTypes::String, 1, offsetof(ActionIncrement, target)},
 			{ "Step", Datum::DatumTypes::Float, 1, offsetof(ActionIncrement, step) },
+			{ "Index", Datum::DatumTypes::Integer, 1, offsetof(ActionIncrement, index) },
 		};
 	}
 }
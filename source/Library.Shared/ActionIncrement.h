@@ -2,6 +2,7 @@
 
 #include "Action.h"
 #include "TypeManager.h"
+#include "Atom.h"
 
 namespace FieaGameEngine
 {
@@ -11,6 +12,9 @@ namespace FieaGameEngine
 		RTTI_DECLARATIONS(ActionIncrement, Action)
 
 	public:
+		// An index which applies the step to every element of the target, or every component when the target holds vectors
+		static constexpr int AllElements = -1;
+
 		/// <summary>
 		/// Default constructor which creates the actionincrement by calling the protected Action constructor which takes the id of this action
 		/// </summary>
@@ -58,6 +62,9 @@ namespace FieaGameEngine
 		/// Updates the current actionincrement
 		/// </summary>
 		/// <param name="state"> The state used to update current entities and actions </param>
+		/// <remarks> The target is only searched for again once its name changes, however it was written, or once a scope between this action and the target changes structure </remarks>
+		/// <exception cref="std::runtime_error"> If the target isn't found in this scope or any of its ancestors </exception>
+		/// <exception cref="std::runtime_error"> If the index is out of range or the target can't hold the step </exception>
 		virtual void Update(WorldState& state) override;
 
 		/// <summary>
@@ -83,13 +90,13 @@ namespace FieaGameEngine
 		/// Sets the target of the actionincrement to the parameter
 		/// </summary>
 		/// <param name="new_target"> The new actionincrement target </param>
-		void SetTarget(const std::string& new_target) { target = new_target; }
+		void SetTarget(const std::string& new_target);
 
 		/// <summary>
 		/// Sets the target of the actionincrement to the parameter
 		/// </summary>
 		/// <param name="new_target"> The new actionincrement target </param>
-		void SetTarget(std::string&& new_target) { target = new_target; }
+		void SetTarget(std::string&& new_target);
 
 		/// <summary>
 		/// Queries the step of the actionincrement
@@ -103,9 +110,30 @@ namespace FieaGameEngine
 		/// <param name="new_step"> The new actionincrement step </param>
 		void SetStep(float new_step) { step = new_step; }
 
+		/// <summary>
+		/// Queries the index of the element the step is added to
+		/// </summary>
+		/// <returns> The index of the target element, or AllElements </returns>
+		int Index() const { return index; }
+
+		/// <summary>
+		/// Sets the index of the element the step is added to
+		/// </summary>
+		/// <param name="new_index"> The index of the target element, or AllElements to step a whole Float or Vector array in one pass </param>
+		void SetIndex(int new_index) { index = new_index; }
+
 	private:
 		std::string target;
 		float step = 1.0f;
+		int index = 0;
+
+		// Interned copy of target, made again by Update whenever the two no longer match
+		Atom target_atom;
+
+		// The datum target resolved to and the scope it was found in, valid while IsUnchangedSince(target_generation, target_scope) holds
+		Datum* target_datum = nullptr;
+		Scope* target_scope = nullptr;
+		size_t target_generation = 0;
 	};
 
 	ConcreteFactory(ActionIncrement, Scope)
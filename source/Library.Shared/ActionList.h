@@ -75,7 +75,7 @@ namespace FieaGameEngine
 		/// Queries the order vector and finds all the actions of this actionlist
 		/// </summary>
 		/// <returns> The actions of this actionlist </returns>
-		Datum& Actions() { return order.at(actions_identifier)->second; }
+		Datum& Actions() { return entries.at(actions_identifier).second; }
 
 	protected:
 		/// <summary>
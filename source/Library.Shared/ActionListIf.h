@@ -74,18 +74,18 @@ namespace FieaGameEngine
 		/// Queries the order vector and finds all the "then" actions of this actionlistif
 		/// </summary>
 		/// <returns> The "then" actions of this actionlistif </returns>
-		Datum& ThenActions() { return order.at(then_identifier)->second; }
+		Datum& ThenActions() { return entries.at(then_identifier).second; }
 
 		/// <summary>
 		/// Queries the order vector and finds all the "else" actions of this actionlistif
 		/// </summary>
 		/// <returns> The "else" actions of this actionlistif </returns>
-		Datum& ElseActions() { return order.at(else_identifier)->second; }
+		Datum& ElseActions() { return entries.at(else_identifier).second; }
 
 	private:
 		void LoopActions(WorldState& state, Datum& actions);
 
-		int32_t condition;
+		int32_t condition = 0;
 
 		static const size_t then_identifier = 2;
 		static const size_t else_identifier = 3;
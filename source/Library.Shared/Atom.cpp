@@ -0,0 +1,87 @@
+#include "pch.h"
+#include "Atom.h"
+
+namespace FieaGameEngine
+{
+	// Sized so that ordinary use never has to rehash the table
+	Atom::TableType Atom::table(1021_z);
+
+	Atom::Atom(const std::string& name)
+	{
+		const size_t hash = DefaultHash<std::string>{}(name);
+
+		auto it = table.Find(name, hash);
+		if (it == table.end())
+		{
+			it = std::get<1>(table.Insert(TableType::PairType(name, Entry{ hash, 0_z }), hash));
+		}
+
+		entry = &*it;
+		++entry->second.references;
+	}
+
+	Atom::Atom(const Atom& other) :
+		entry(other.entry)
+	{
+		if (entry != nullptr)
+		{
+			++entry->second.references;
+		}
+	}
+
+	Atom::Atom(Atom&& other) noexcept :
+		entry(other.entry)
+	{
+		other.entry = nullptr;
+	}
+
+	Atom& Atom::operator=(const Atom& other)
+	{
+		if (entry != other.entry)
+		{
+			Release();
+			entry = other.entry;
+			if (entry != nullptr)
+			{
+				++entry->second.references;
+			}
+		}
+
+		return *this;
+	}
+
+	Atom& Atom::operator=(Atom&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Release();
+			entry = other.entry;
+			other.entry = nullptr;
+		}
+
+		return *this;
+	}
+
+	Atom::~Atom()
+	{
+		Release();
+	}
+
+	const std::string& Atom::String() const
+	{
+		static const std::string empty;
+		return (entry != nullptr) ? entry->first : empty;
+	}
+
+	void Atom::Release()
+	{
+		if (entry != nullptr && --entry->second.references == 0_z)
+		{
+			// The key is copied since removal destroys the pair it lives in
+			const std::string name = entry->first;
+			table.Remove(name);
+		}
+
+		entry = nullptr;
+	}
+}
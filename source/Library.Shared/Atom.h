@@ -0,0 +1,119 @@
+#pragma once
+
+#include "HashMap.h"
+#include <string>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// A handle to a string interned in a global table
+	/// Every Atom made from equal strings refers to the same table entry, so comparing two Atoms is a pointer comparison
+	/// The string's DefaultHash is computed once at interning, so hashed lookups (e.g. Scope::Find) don't hash the string again
+	/// </summary>
+	/// <remarks> Entries are reference counted and leave the table once their last Atom is destroyed. Not thread safe </remarks>
+	/// <remarks> The table is a static member, so Atoms can't be created during static initialization </remarks>
+	class Atom final
+	{
+	public:
+		/// <summary>
+		/// Constructs the null atom, which refers to no entry and compares equal only to other null atoms
+		/// </summary>
+		Atom() = default;
+
+		/// <summary>
+		/// Interns the string, adding it to the table if it isn't already present
+		/// </summary>
+		/// <param name="name"> The string to intern </param>
+		explicit Atom(const std::string& name);
+
+		/// <summary>
+		/// Copy constructor which refers to the same entry as the other atom
+		/// </summary>
+		/// <param name="other"> The original atom to copy </param>
+		Atom(const Atom& other);
+
+		/// <summary>
+		/// Move constructor which takes the other atom's entry, leaving it null
+		/// </summary>
+		/// <param name="other"> The original atom to move </param>
+		/// <remarks> Move constructor uses r-values instead of l-values </remarks>
+		Atom(Atom&& other) noexcept;
+
+		/// <summary>
+		/// Copy assignment which refers to the same entry as the other atom
+		/// </summary>
+		/// <param name = "other"> The atom to equate this atom to </param>
+		/// <returns> The lhs atom (this) after equalizing them </returns>
+		Atom& operator=(const Atom& other);
+
+		/// <summary>
+		/// Move assignment which takes the other atom's entry, leaving it null
+		/// </summary>
+		/// <param name = "other"> The atom to equate this atom to </param>
+		/// <remarks> Assignment operator uses r-values instead of l-values </remarks>
+		/// <returns> The lhs atom (this) after moving the "other" atom </returns>
+		Atom& operator=(Atom&& other) noexcept;
+
+		/// <summary>
+		/// Releases this atom's reference to its entry
+		/// </summary>
+		~Atom();
+
+		/// <summary>
+		/// Determines if two atoms were made from the same string
+		/// </summary>
+		/// <param name = "other"> The atom to compare this too </param>
+		/// <returns> A boolean to indicate if two atoms are equivalent </returns>
+		bool operator==(const Atom& other) const { return entry == other.entry; }
+
+		/// <summary>
+		/// Determines if two atoms were made from different strings
+		/// </summary>
+		/// <param name = "other"> The atom to compare this too </param>
+		/// <returns> A boolean to indicate if two atoms are not equivalent </returns>
+		bool operator!=(const Atom& other) const { return entry != other.entry; }
+
+		/// <summary>
+		/// Queries the interned string
+		/// </summary>
+		/// <returns> The interned string, or the empty string for the null atom </returns>
+		const std::string& String() const;
+
+		/// <summary>
+		/// Queries the interned string's hash
+		/// </summary>
+		/// <returns> DefaultHash of the interned string, or zero for the null atom </returns>
+		size_t Hash() const { return (entry != nullptr) ? entry->second.hash : 0_z; }
+
+		/// <summary>
+		/// Queries whether this is the null atom
+		/// </summary>
+		/// <returns> True if this atom doesn't refer to an entry </returns>
+		bool IsNull() const { return (entry == nullptr); }
+
+		/// <summary>
+		/// Queries the amount of strings currently interned
+		/// </summary>
+		/// <returns> The amount of entries in the table </returns>
+		static size_t TableSize() { return table.Size(); }
+
+	private:
+		struct Entry final
+		{
+			size_t hash = 0_z;
+			size_t references = 0_z;
+		};
+
+		// Chains are linked lists whose nodes never move, so atoms can point straight at the table's pairs
+		using TableType = HashMap<std::string, Entry>;
+
+		/// <summary>
+		/// Drops this atom's reference, removing the entry from the table if it was the last
+		/// </summary>
+		void Release();
+
+		static TableType table;
+
+		TableType::PairType* entry = nullptr;
+	};
+}
@@ -0,0 +1,22 @@
+#include "pch.h"
+#include "AttributeHandle.h"
+#include "TypeManager.h"
+
+namespace FieaGameEngine
+{
+	AttributeHandle::AttributeHandle(const RTTI::IdType type, const std::string& name) :
+		type_id(type)
+	{
+		const Vector<Signature>& signatures = TypeManager::GetSignaturesForType(type);
+		for (size_t signature_index = 0_z; signature_index < signatures.Size(); ++signature_index)
+		{
+			if (signatures[signature_index].name == name)
+			{
+				index = signature_index + 1_z; // Entry 0 is always "this"
+				return;
+			}
+		}
+
+		throw std::invalid_argument("The type has no prescribed attribute with this name.");
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "RTTI.h"
+#include "SizeLiteral.h"
+#include <string>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Names a prescribed attribute by the type that declares it and the index of its entry in an instance's scope
+	/// Prescribed attributes are appended base class first, right after "this", so every instance of the type (or of a type derived from it)
+	/// keeps the attribute at the same entry index and Attributed::operator[] reaches it with a single index, without hashing the name
+	/// </summary>
+	/// <remarks> Resolved against the TypeManager, so the type must be registered before its handles are created </remarks>
+	class AttributeHandle final
+	{
+	public:
+		/// <summary>
+		/// Constructs the null handle, which doesn't refer to any attribute
+		/// </summary>
+		AttributeHandle() = default;
+
+		/// <summary>
+		/// Resolves the entry index of a prescribed attribute
+		/// </summary>
+		/// <param name="type"> The registered type that prescribes the attribute, or a type derived from it </param>
+		/// <param name="name"> The name of the prescribed attribute </param>
+		/// <exception cref="std::invalid_argument"> If the type has no prescribed attribute with that name </exception>
+		AttributeHandle(const RTTI::IdType type, const std::string& name);
+
+		/// <summary>
+		/// Defaulted copy constructor
+		/// </summary>
+		/// <param name="other"> The original handle to copy </param>
+		AttributeHandle(const AttributeHandle& other) = default;
+
+		/// <summary>
+		/// Defaulted move constructor
+		/// </summary>
+		/// <param name="other"> The original handle to move </param>
+		/// <remarks> Move constructor uses r-values instead of l-values </remarks>
+		AttributeHandle(AttributeHandle&& other) noexcept = default;
+
+		/// <summary>
+		/// Defaulted copy assignment
+		/// </summary>
+		/// <param name = "other"> The handle to equate this handle to </param>
+		/// <returns> The lhs handle (this) after equalizing them </returns>
+		AttributeHandle& operator=(const AttributeHandle& other) = default;
+
+		/// <summary>
+		/// Defaulted move assignment
+		/// </summary>
+		/// <param name = "other"> The handle to equate this handle to </param>
+		/// <remarks> Assignment operator uses r-values instead of l-values </remarks>
+		/// <returns> The lhs handle (this) after moving the "other" handle </returns>
+		AttributeHandle& operator=(AttributeHandle&& other) noexcept = default;
+
+		/// <summary>
+		/// Defaulted destructor
+		/// </summary>
+		~AttributeHandle() = default;
+
+		/// <summary>
+		/// Compares the type and entry index of two handles
+		/// </summary>
+		/// <param name="other"> The handle to compare against </param>
+		/// <returns> True if both handles refer to the same entry index of the same type </returns>
+		bool operator==(const AttributeHandle& other) const { return (type_id == other.type_id) && (index == other.index); }
+
+		/// <summary>
+		/// Compares the type and entry index of two handles
+		/// </summary>
+		/// <param name="other"> The handle to compare against </param>
+		/// <returns> True if the handles refer to different entry indices or types </returns>
+		bool operator!=(const AttributeHandle& other) const { return !operator==(other); }
+
+		/// <summary>
+		/// Queries the type the handle was resolved against
+		/// </summary>
+		/// <returns> The type's RTTI id </returns>
+		RTTI::IdType TypeId() const { return type_id; }
+
+		/// <summary>
+		/// Queries the index of the attribute's entry in an instance's scope
+		/// </summary>
+		/// <returns> The entry index, which is never 0 for a resolved handle since the first entry is "this" </returns>
+		size_t Index() const { return index; }
+
+		/// <summary>
+		/// Queries whether the handle refers to an attribute
+		/// </summary>
+		/// <returns> True for a default constructed handle </returns>
+		bool IsNull() const { return (index == 0_z); }
+
+	private:
+		RTTI::IdType type_id = 0_z;
+		size_t index = 0_z;
+	};
+}
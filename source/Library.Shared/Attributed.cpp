@@ -6,12 +6,17 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Attributed)
 
-	Attributed::Attributed(const RTTI::IdType id_type)
+	Attributed::Attributed(const RTTI::IdType id_type) :
+		Scope(TypeManager::GetShape(id_type).signatures.Size() + 1_z) // +1 for "this"
 	{
 		(*this)["this"] = this;
 		Populate(id_type);
 	}
 
+	Attributed::~Attributed()
+	{
+	}
+
 	Attributed::Attributed(const Attributed& other) : 
 		Scope(other)
 	{
@@ -55,17 +60,38 @@ namespace FieaGameEngine
 		return (Find(entry) != nullptr);
 	}
 
+	bool Attributed::IsAttribute(const Atom& entry) const
+	{
+		return (Find(entry) != nullptr);
+	}
+
 	bool Attributed::IsPrescribedAttribute(const std::string& entry) const
 	{
 		if (entry == "this") return true;
 		return (TypeManager::GetSignature(TypeIdInstance(), entry) != nullptr);
 	}
 
+	bool Attributed::IsPrescribedAttribute(const Atom& entry) const
+	{
+		return IsPrescribedAttribute(entry.String());
+	}
+
 	bool Attributed::IsAuxiliaryAttribute(const std::string& entry) const
 	{
 		return (IsAttribute(entry) && !IsPrescribedAttribute(entry));
 	}
 
+	Datum& Attributed::operator[](const AttributeHandle& handle)
+	{
+		assert(!handle.IsNull() && Is(handle.TypeId()));
+		return entries[handle.Index()].second;
+	}
+
+	const Datum& Attributed::operator[](const AttributeHandle& handle) const
+	{
+		return const_cast<Attributed*>(this)->operator[](handle);
+	}
+
 	Datum& Attributed::AppendAuxililaryAttribute(const std::string& entry)
 	{
 		if (IsPrescribedAttribute(entry))
@@ -78,12 +104,12 @@ namespace FieaGameEngine
 
 	const Vector<Scope::ScopePairType*> Attributed::PrescribedAttributes() const
 	{
-		Vector<Signature> signatures = TypeManager::GetSignaturesForType(TypeIdInstance());
+		const Vector<Signature>& signatures = TypeManager::GetSignaturesForType(TypeIdInstance());
 		Vector<ScopePairType*> prescribedAttributes(signatures.Size() - + 1); // +1 for "this"
 
 		for (size_t i = 0; i < signatures.Size(); ++i)
 		{
-			prescribedAttributes.PushBack(order[i]);
+			prescribedAttributes.PushBack(const_cast<ScopePairType*>(&entries[i]));
 		}
 
 		return prescribedAttributes;
@@ -91,13 +117,13 @@ namespace FieaGameEngine
 
 	const Vector<Scope::ScopePairType*> Attributed::AuxiliaryAttributes() const
 	{
-		Vector<Signature> signatures = TypeManager::GetSignaturesForType(TypeIdInstance());
+		const Vector<Signature>& signatures = TypeManager::GetSignaturesForType(TypeIdInstance());
 		size_t auxiliaryBeginIndex = signatures.Size() + 1;
-		Vector<ScopePairType*> auxiliaryAttributes(order.Size() - auxiliaryBeginIndex);
+		Vector<ScopePairType*> auxiliaryAttributes(entries.Size() - auxiliaryBeginIndex);
 
-		for (size_t i = auxiliaryBeginIndex; i < order.Size(); ++i)
+		for (size_t i = auxiliaryBeginIndex; i < entries.Size(); ++i)
 		{
-			auxiliaryAttributes.PushBack(order[i]);
+			auxiliaryAttributes.PushBack(const_cast<ScopePairType*>(&entries[i]));
 		}	
 
 		return auxiliaryAttributes;
@@ -105,12 +131,15 @@ namespace FieaGameEngine
 
 	void Attributed::Populate(const RTTI::IdType id_type)
 	{
-		Vector<Signature> signatures = TypeManager::GetSignaturesForType(id_type);
-		for (const Signature& signature : signatures)
+		// The scope was sized for the shape, so appending never rehashes and the keys' hashes come precomputed
+		const TypeManager::Shape& shape = TypeManager::GetShape(id_type);
+		for (size_t index = 0_z; index < shape.signatures.Size(); ++index)
 		{
+			const Signature& signature = shape.signatures[index];
 			assert(signature.type != Datum::DatumTypes::Unknown);
 
-			Datum& datum = Append(signature.name);
+			bool entry_created;
+			Datum& datum = Append(signature.name, shape.name_hashes[index], entry_created);
 			datum.SetType(signature.type);
 
 			if (signature.type == Datum::DatumTypes::Table)
@@ -130,16 +159,17 @@ namespace FieaGameEngine
 
 	void Attributed::PointerRewrite(const RTTI::IdType id_type)
 	{
-		Vector<Signature> signatures = TypeManager::GetSignaturesForType(id_type);
-		for (const Signature& signature : signatures)
+		const TypeManager::Shape& shape = TypeManager::GetShape(id_type);
+		for (size_t index = 0_z; index < shape.signatures.Size(); ++index)
 		{
+			const Signature& signature = shape.signatures[index];
 			assert(signature.type != Datum::DatumTypes::Unknown);
 
 			if (signature.type != Datum::DatumTypes::Table)
 			{
-				Datum* datum = Find(signature.name);
+				Datum& datum = *Find(signature.name, shape.name_hashes[index]);
 				void* new_data = reinterpret_cast<uint8_t*>(this) + signature.storage_offset;
-				datum->data.vp = new_data;
+				datum.data.vp = new_data;
 			}
 		}
 	}
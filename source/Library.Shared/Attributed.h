@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Scope.h"
+#include "AttributeHandle.h"
 
 namespace FieaGameEngine
 {
@@ -54,7 +55,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Pure virtual destructor which is explicitly meant to be overriden by the derived class
 		/// </summary>
-		virtual ~Attributed() = 0 {};
+		virtual ~Attributed() = 0;
 
 		/// <summary>
 		/// Determines whether or not the entry is in the order vector, aka it is an attribute
@@ -62,6 +63,13 @@ namespace FieaGameEngine
 		/// <param name="entry"> The string to search for </param>
 		/// <returns> True/false depending on whether or not the string was found in the order vector </returns>
 		bool IsAttribute(const std::string& entry) const;
+
+		/// <summary>
+		/// Determines whether or not the interned entry is an attribute, without rehashing the name
+		/// </summary>
+		/// <param name="entry"> The atom to search for </param>
+		/// <returns> True/false depending on whether or not the atom was found in the scope </returns>
+		bool IsAttribute(const Atom& entry) const;
 		
 		/// <summary>
 		/// Determines whether or not the entry is in the attributes vector and is prescribed
@@ -69,6 +77,14 @@ namespace FieaGameEngine
 		/// <param name="entry"> The string to search for </param>
 		/// <returns> True/false depending on whether or not the typemanager has a signature for this string </returns>
 		bool IsPrescribedAttribute(const std::string& entry) const;
+
+		/// <summary>
+		/// Determines whether or not the interned entry is prescribed
+		/// </summary>
+		/// <param name="entry"> The atom to search for </param>
+		/// <remarks> Signatures are matched by name, so this compares the atom's string like the string overload does </remarks>
+		/// <returns> True/false depending on whether or not the typemanager has a signature for this atom </returns>
+		bool IsPrescribedAttribute(const Atom& entry) const;
 		
 		/// <summary>
 		/// Determines whether or not the entry is in the attributes vector and is prescribed
@@ -78,6 +94,23 @@ namespace FieaGameEngine
 		/// <returns> True/false depending on whether or not the entry is an attribute and NOT prescribed</returns>
 		bool IsAuxiliaryAttribute(const std::string& entry) const;
 
+		using Scope::operator[];
+
+		/// <summary>
+		/// Retrieves a prescribed attribute through its precomputed slot, without searching or hashing
+		/// </summary>
+		/// <param name="handle"> A handle resolved against this object's type or one of its ancestors </param>
+		/// <returns> The datum of the prescribed attribute </returns>
+		Datum& operator[](const AttributeHandle& handle);
+
+		/// <summary>
+		/// Retrieves a prescribed attribute through its precomputed slot, without searching or hashing
+		/// </summary>
+		/// <param name="handle"> A handle resolved against this object's type or one of its ancestors </param>
+		/// <remarks> This is the const version of the other operator[] method </remarks>
+		/// <returns> The datum of the prescribed attribute </returns>
+		const Datum& operator[](const AttributeHandle& handle) const;
+
 		/// <summary>
 		/// Simply appends an entry to the scope if the element is not prescribed
 		/// </summary>
@@ -87,10 +120,10 @@ namespace FieaGameEngine
 		Datum& AppendAuxililaryAttribute(const std::string& entry);
 
 		/// <summary>
-		/// Queries the order vector
+		/// Queries every attribute, in the order they were appended
 		/// </summary>
-		/// <returns> The order vector in its entirety </returns>
-		const Vector<HashMap<const std::string, Datum>::PairType*>& Attributes() const { return order; }
+		/// <returns> The entries of the scope in their entirety </returns>
+		const SegmentedVector<ScopePairType>& Attributes() const { return entries; }
 		
 		/// <summary>
 		/// Queries the attributes and filters out the prescribed attributes
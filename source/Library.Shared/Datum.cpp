@@ -1,8 +1,121 @@
 #include "pch.h"
 #include "Datum.h"
 #include "RTTI.h"
+#include <charconv>
+#include <iterator>
 #include <stdexcept>
 
+namespace
+{
+	/// <summary>
+	/// Moves the cursor past any whitespace
+	/// </summary>
+	void SkipWhitespace(const char*& cursor, const char* end)
+	{
+		while (cursor != end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\n' || *cursor == '\r'))
+		{
+			++cursor;
+		}
+	}
+
+	/// <summary>
+	/// Consumes a token after any whitespace
+	/// </summary>
+	/// <exception cref="std::invalid_argument"> If the text at the cursor isn't the token </exception>
+	void ExpectToken(const char*& cursor, const char* end, const std::string_view token)
+	{
+		using namespace std::string_literals;
+
+		SkipWhitespace(cursor, end);
+		if (static_cast<size_t>(end - cursor) < token.size() || std::string_view(cursor, token.size()) != token)
+		{
+			throw std::invalid_argument("Expected \""s + std::string(token) + "\" while parsing a datum value."s);
+		}
+
+		cursor += token.size();
+	}
+
+	/// <summary>
+	/// Parses a number after any whitespace and an optional plus sign, the way stoi, stof and scanf accepted them
+	/// </summary>
+	/// <exception cref="std::invalid_argument"> If there's no number at the cursor </exception>
+	/// <exception cref="std::out_of_range"> If the number doesn't fit in T </exception>
+	template <typename T>
+	T ParseNumber(const char*& cursor, const char* end)
+	{
+		SkipWhitespace(cursor, end);
+		if (cursor != end && *cursor == '+')
+		{
+			++cursor;
+		}
+
+		T value{};
+		const auto [next, error] = std::from_chars(cursor, end, value);
+		if (error == std::errc::invalid_argument)
+		{
+			throw std::invalid_argument("Expected a number while parsing a datum value.");
+		}
+
+		if (error == std::errc::result_out_of_range)
+		{
+			throw std::out_of_range("A number in a datum value is out of range.");
+		}
+
+		cursor = next;
+		return value;
+	}
+
+	/// <summary>
+	/// Parses a parenthesized, comma separated group of floats such as "(1, 2, 3, 4)"
+	/// </summary>
+	void ParseFloatGroup(const char*& cursor, const char* end, float* values, const size_t count)
+	{
+		ExpectToken(cursor, end, "(");
+		for (size_t index = 0; index < count; ++index)
+		{
+			if (index > 0)
+			{
+				ExpectToken(cursor, end, ",");
+			}
+
+			values[index] = ParseNumber<float>(cursor, end);
+		}
+
+		ExpectToken(cursor, end, ")");
+	}
+
+	/// <summary>
+	/// Formats a number with to_chars straight onto the end of the buffer
+	/// </summary>
+	template <typename T>
+	void AppendNumber(std::string& buffer, const T value)
+	{
+		char digits[32];
+		const auto [end, error] = std::to_chars(std::begin(digits), std::end(digits), value);
+		assert(error == std::errc{});
+		buffer.append(digits, end);
+	}
+
+	/// <summary>
+	/// Formats a group of floats the way ParseFloatGroup reads them
+	/// </summary>
+	void AppendFloatGroup(std::string& buffer, const float* values, const size_t count)
+	{
+		buffer += '(';
+		for (size_t index = 0; index < count; ++index)
+		{
+			if (index > 0)
+			{
+				buffer += ", ";
+			}
+
+			AppendNumber(buffer, values[index]);
+		}
+
+		buffer += ')';
+	}
+}
+
 namespace FieaGameEngine
 {
 #pragma region RuleOf6
@@ -11,8 +124,8 @@ namespace FieaGameEngine
 	{}
 
 	Datum::Datum(const Datum& other) :
-		size(other.size),
 		type(other.type),
+		size(other.size),
 		is_external(other.is_external)
 	{
 		if (other.is_external)
@@ -20,6 +133,12 @@ namespace FieaGameEngine
 			data = other.data;
 			capacity = other.capacity;
 		}
+		else if (other.is_shareable && other.capacity > 0_z && !other.IsInline())
+		{
+			data = other.data;
+			capacity = other.capacity;
+			++Header().references;
+		}
 		else
 		{
 			DeepCopyDatum(other);
@@ -35,16 +154,12 @@ namespace FieaGameEngine
 	{
 		if (this != &other)
 		{
-			if ((is_external == false) && (capacity > 0_z))
-			{
-				Clear();
-				capacity = 0_z;
-				free(data.vp);
-			}
+			ReleaseBuffer();
 
 			size = other.size;
 			type = other.type;
 			is_external = other.is_external;
+			is_shareable = true;
 
 			// = External
 			if (other.is_external)
@@ -52,7 +167,13 @@ namespace FieaGameEngine
 				data = other.data;
 				capacity = other.capacity;
 			}
-			// = Internal
+			// = Internal, shared until either side writes
+			else if (other.is_shareable && other.capacity > 0_z && !other.IsInline())
+			{
+				data = other.data;
+				capacity = other.capacity;
+				++Header().references;
+			}
 			else
 			{
 				capacity = 0_z;
@@ -124,7 +245,7 @@ namespace FieaGameEngine
 	{
 		if (this != &other)
 		{
-			Clear();
+			ReleaseBuffer();
 			MoveDatum(other);
 		}
 
@@ -133,14 +254,7 @@ namespace FieaGameEngine
 
 	Datum::~Datum()
 	{
-		if (!is_external)
-		{
-			if (capacity > 0_z)
-			{
-				Clear();
-				free(data.vp);
-			}
-		}
+		ReleaseBuffer();
 	}
 
 #pragma endregion RuleOf6
@@ -157,7 +271,7 @@ namespace FieaGameEngine
 
 #pragma region CreateFunctions
 
-	inline void Datum::CreateIntegers(const size_t& start, const size_t& amount)
+	void Datum::CreateIntegers(const size_t& start, const size_t& amount)
 	{
 		for (size_t i = start; i < amount; ++i)
 		{
@@ -165,7 +279,7 @@ namespace FieaGameEngine
 		}
 	}
 
-	inline void Datum::CreateFloats(const size_t& start, const size_t& amount)
+	void Datum::CreateFloats(const size_t& start, const size_t& amount)
 	{
 		for (size_t i = start; i < amount; ++i)
 		{
@@ -173,7 +287,7 @@ namespace FieaGameEngine
 		}
 	}
 
-	inline void Datum::CreateStrings(const size_t& start, const size_t& amount)
+	void Datum::CreateStrings(const size_t& start, const size_t& amount)
 	{
 		for (size_t i = start; i < amount; ++i)
 		{
@@ -181,7 +295,7 @@ namespace FieaGameEngine
 		}
 	}
 
-	inline void Datum::CreateVectors(const size_t& start, const size_t& amount)
+	void Datum::CreateVectors(const size_t& start, const size_t& amount)
 	{
 		for (size_t i = start; i < amount; ++i)
 		{
@@ -189,7 +303,7 @@ namespace FieaGameEngine
 		}
 	}
 
-	inline void Datum::CreateMatrices(const size_t& start, const size_t& amount)
+	void Datum::CreateMatrices(const size_t& start, const size_t& amount)
 	{
 		for (size_t i = start; i < amount; ++i)
 		{
@@ -197,7 +311,7 @@ namespace FieaGameEngine
 		}
 	}
 
-	inline void Datum::CreatePointers(const size_t& start, const size_t& amount)
+	void Datum::CreatePointers(const size_t& start, const size_t& amount)
 	{
 		for (size_t i = start; i < amount; ++i)
 		{
@@ -205,7 +319,7 @@ namespace FieaGameEngine
 		}
 	}
 
-	inline void Datum::CreateTables(const size_t& start, const size_t& amount)
+	void Datum::CreateTables(const size_t& start, const size_t& amount)
 	{
 		for (size_t i = start; i < amount; ++i)
 		{
@@ -229,6 +343,8 @@ namespace FieaGameEngine
 
 		if (new_size < size)
 		{
+			Detach();
+
 			if (type == Datum::DatumTypes::String)
 			{
 				using namespace std;
@@ -241,6 +357,7 @@ namespace FieaGameEngine
 		else
 		{
 			Reserve(new_size);
+			Detach();
 
 			CreateDefaultFunctions func = CreateFunctions[static_cast<int>(type)];
 			assert(func != nullptr);
@@ -257,7 +374,12 @@ namespace FieaGameEngine
 			throw std::runtime_error("Cannot clear external data.");
 		}
 
-		if (type == DatumTypes::String)
+		if (IsShared())
+		{
+			// The elements belong to the other datums sharing the array, so this one just lets go of it
+			ReleaseBuffer();
+		}
+		else if (type == DatumTypes::String)
 		{
 			using namespace std;
 
@@ -319,7 +441,7 @@ namespace FieaGameEngine
 
 		if (size == other.size && type == other.type)
 		{
-			if (type == Datum::DatumTypes::Unknown)
+			if (type == Datum::DatumTypes::Unknown || data.vp == other.data.vp)
 			{
 				return true;
 			}
@@ -361,55 +483,122 @@ namespace FieaGameEngine
 
 		if (new_capacity > capacity)
 		{
-			const size_t element_size = size_map[static_cast<int>(type)];
+			if (new_capacity <= InlineCapacity() && (capacity == 0_z || IsInline()))
+			{
+				// Still fits inside the datum, nothing to allocate or move
+				data.vp = inline_buffer;
+				capacity = new_capacity;
+				return;
+			}
 
-			void* new_data = realloc(data.vp, new_capacity * element_size);
-			assert(new_data != nullptr);
-			data.vp = new_data;
+			if (IsInline())
+			{
+				// Outgrew the inline buffer, only trivially copyable types are ever stored there
+				BufferHeader* header = AllocateBuffer(new_capacity);
+				CopyElements(header + 1);
+				data.vp = header + 1;
+			}
+			else if (IsShared())
+			{
+				// The other datums keep the old array, this one continues on a copy
+				BufferHeader* header = AllocateBuffer(new_capacity);
+				CopyElements(header + 1);
+				--Header().references;
+				data.vp = header + 1;
+			}
+			else if (type == DatumTypes::String)
+			{
+				// A string can point into its own small buffer, so strings are moved into the new block rather than realloc'd
+				BufferHeader* header = AllocateBuffer(new_capacity);
+				std::string* new_data = reinterpret_cast<std::string*>(header + 1);
 
+				for (size_t index = 0_z; index < size; ++index)
+				{
+					using namespace std;
+					new(new_data + index)std::string(std::move(data.s[index]));
+					data.s[index].~string();
+				}
+
+				if (capacity > 0_z)
+				{
+					free(&Header());
+				}
+
+				data.s = new_data;
+			}
+			else
+			{
+				const size_t element_size = size_map[static_cast<int>(type)];
+				void* block = realloc((capacity > 0_z) ? &Header() : nullptr, sizeof(BufferHeader) + new_capacity * element_size);
+				assert(block != nullptr);
+
+				BufferHeader* header = static_cast<BufferHeader*>(block);
+				header->references = 1_z;
+				data.vp = header + 1;
+			}
+
+			// Nothing can point into the new array yet
 			capacity = new_capacity;
+			is_shareable = true;
 		}
 	}
 
 #pragma region FromStringFunctions
 
 	template <>
-	inline int32_t Datum::FromString(const std::string& value)
+	inline int32_t Datum::FromString(std::string_view value)
 	{
-		return stoi(value);
+		const char* cursor = value.data();
+		return ParseNumber<int32_t>(cursor, value.data() + value.size());
 	}
 
 	template <>
-	inline float Datum::FromString(const std::string& value)
+	inline float Datum::FromString(std::string_view value)
 	{
-		return stof(value);
+		const char* cursor = value.data();
+		return ParseNumber<float>(cursor, value.data() + value.size());
 	}
 
 	template <>
-	inline std::string Datum::FromString(const std::string& value)
+	inline std::string Datum::FromString(std::string_view value)
 	{
-		return value;
+		return std::string(value);
 	}
 
 	template <>
-	inline glm::vec4 Datum::FromString(const std::string& value)
+	inline glm::vec4 Datum::FromString(std::string_view value)
 	{
 		glm::vec4 vector{};
-		sscanf_s(value.c_str(), "vec4(%f, %f, %f, %f)", &vector.x, &vector.y, &vector.z, &vector.w);
+
+		const char* cursor = value.data();
+		const char* end = cursor + value.size();
+		ExpectToken(cursor, end, "vec4");
+		ParseFloatGroup(cursor, end, &vector[0], 4);
 
 		return vector;
 	}
 
 	template <>
-	inline glm::mat4 Datum::FromString(const std::string& value)
+	inline glm::mat4 Datum::FromString(std::string_view value)
 	{
 		glm::mat4 matrix{};
 
-		sscanf_s(value.c_str(), "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
-			&matrix[0][0], &matrix[0][1], &matrix[0][2], &matrix[0][3],
-			&matrix[1][0], &matrix[1][1], &matrix[1][2], &matrix[1][3],
-			&matrix[2][0], &matrix[2][1], &matrix[2][2], &matrix[2][3],
-			&matrix[3][0], &matrix[3][1], &matrix[3][2], &matrix[3][3]);
+		// One group per column, "mat4x4((...), (...), (...), (...))"
+		const char* cursor = value.data();
+		const char* end = cursor + value.size();
+		ExpectToken(cursor, end, "mat4x4");
+		ExpectToken(cursor, end, "(");
+		for (int column = 0; column < 4; ++column)
+		{
+			if (column > 0)
+			{
+				ExpectToken(cursor, end, ",");
+			}
+
+			ParseFloatGroup(cursor, end, &matrix[column][0], 4);
+		}
+
+		ExpectToken(cursor, end, ")");
 
 		return matrix;
 	}
@@ -418,32 +607,32 @@ namespace FieaGameEngine
 
 #pragma region SetDeserializeFunctions
 
-	inline void Datum::SetDeserializeInteger(const std::string& value, const size_t& index)
+	void Datum::SetDeserializeInteger(std::string_view value, const size_t& index)
 	{
 		Set<int>(FromString<int>(value), index);
 	}
 
-	inline void Datum::SetDeserializeFloat(const std::string& value, const size_t& index)
+	void Datum::SetDeserializeFloat(std::string_view value, const size_t& index)
 	{
 		Set<float>(FromString<float>(value), index);
 	}
 
-	inline void Datum::SetDeserializeString(const std::string& value, const size_t& index)
+	void Datum::SetDeserializeString(std::string_view value, const size_t& index)
 	{
 		Set<std::string>(FromString<std::string>(value), index);
 	}
 
-	inline void Datum::SetDeserializeVector(const std::string& value, const size_t& index)
+	void Datum::SetDeserializeVector(std::string_view value, const size_t& index)
 	{
 		Set<glm::vec4>(FromString<glm::vec4>(value), index);
 	}
 
-	inline void Datum::SetDeserializeMatrix(const std::string& value, const size_t& index)
+	void Datum::SetDeserializeMatrix(std::string_view value, const size_t& index)
 	{
 		Set<glm::mat4>(FromString<glm::mat4>(value), index);
 	}
 
-	inline void Datum::SetDeserializePointer(const std::string& /*value*/, const size_t& /*index*/)
+	void Datum::SetDeserializePointer(std::string_view /*value*/, const size_t& /*index*/)
 	{
 		throw std::runtime_error("Trying to destring a pointer.");
 	}
@@ -452,46 +641,46 @@ namespace FieaGameEngine
 
 #pragma region PushBackFromStringFunctions
 
-	inline void Datum::PushBackDeserializeInteger(const std::string& value)
+	void Datum::PushBackDeserializeInteger(std::string_view value)
 	{
 		PushBack(FromString<int>(value));
 	}
 
-	inline void Datum::PushBackDeserializeFloat(const std::string& value)
+	void Datum::PushBackDeserializeFloat(std::string_view value)
 	{
 		PushBack(FromString<float>(value));
 	}
 
-	inline void Datum::PushBackDeserializeString(const std::string& value)
+	void Datum::PushBackDeserializeString(std::string_view value)
 	{
 		PushBack(FromString<std::string>(value));
 	}
 
-	inline void Datum::PushBackDeserializeVector(const std::string& value)
+	void Datum::PushBackDeserializeVector(std::string_view value)
 	{
 		PushBack(FromString<glm::vec4>(value));
 	}
 
-	inline void Datum::PushBackDeserializeMatrix(const std::string& value)
+	void Datum::PushBackDeserializeMatrix(std::string_view value)
 	{
 		PushBack(FromString<glm::mat4>(value));
 	}
 
-	inline void Datum::PushBackDeserializePointer(const std::string& /*value*/)
+	void Datum::PushBackDeserializePointer(std::string_view /*value*/)
 	{
 		throw std::runtime_error("Trying to destring a pointer.");
 	}
 
 #pragma endregion PushBackFromStringFunctions
 
-	void Datum::SetFromString(const std::string& value, const size_t& index)
+	void Datum::SetFromString(std::string_view value, const size_t& index)
 	{
 		DestringDefaultFunctions func = SetDeserializeFunctions[static_cast<int>(type)];
 		assert(func != nullptr);
 		(this->*func)(value, index);
 	}
 
-	void Datum::PushBackFromString(const std::string& value)
+	void Datum::PushBackFromString(std::string_view value)
 	{
 		PushBackDefaultFunctions func = PushBackDeserializeFunctions[static_cast<int>(type)];
 		assert(func != nullptr);
@@ -500,47 +689,67 @@ namespace FieaGameEngine
 
 #pragma region SerializeFunctions
 
-	std::string Datum::SerializeInteger(const size_t& index) const
+	void Datum::SerializeInteger(std::string& buffer, const size_t& index) const
 	{
-		return std::to_string(Get<int>(index));
+		AppendNumber(buffer, Get<int>(index));
 	}
 
-	std::string Datum::SerializeFloat(const size_t& index) const
+	void Datum::SerializeFloat(std::string& buffer, const size_t& index) const
 	{
-		return std::to_string(Get<float>(index));
+		AppendNumber(buffer, Get<float>(index));
 	}
 
-	std::string Datum::SerializeString(const size_t& index) const
+	void Datum::SerializeString(std::string& buffer, const size_t& index) const
 	{
-		return Get<std::string>(index);
+		buffer += Get<std::string>(index);
 	}
 
-	std::string Datum::SerializeVector(const size_t& index) const
+	void Datum::SerializeVector(std::string& buffer, const size_t& index) const
 	{
-		return glm::to_string(Get<glm::vec4>(index));
+		const glm::vec4& vector = Get<glm::vec4>(index);
+		buffer += "vec4";
+		AppendFloatGroup(buffer, &vector[0], 4);
 	}
 
-	std::string Datum::SerializeMatrix(const size_t& index) const
+	void Datum::SerializeMatrix(std::string& buffer, const size_t& index) const
 	{
-		return glm::to_string(Get<glm::mat4>(index));
+		const glm::mat4& matrix = Get<glm::mat4>(index);
+		buffer += "mat4x4(";
+		for (int column = 0; column < 4; ++column)
+		{
+			if (column > 0)
+			{
+				buffer += ", ";
+			}
+
+			AppendFloatGroup(buffer, &matrix[column][0], 4);
+		}
+
+		buffer += ')';
 	}
 
-	std::string Datum::SerializePointer(const size_t& index) const
+	void Datum::SerializePointer(std::string& buffer, const size_t& index) const
 	{
-		using namespace std::string_literals;
-
 		RTTI* rtti = Get<RTTI*>(index);
 		if (rtti == nullptr)
 		{
-			return "nullptr"s;
+			buffer += "nullptr";
+			return;
 		}
 
-		return rtti->ToString();
+		buffer += rtti->ToString();
 	}
 
 #pragma endregion SerializeFunctions
 
 	std::string Datum::ToString(const size_t& index) const
+	{
+		std::string buffer;
+		AppendToString(buffer, index);
+		return buffer;
+	}
+
+	void Datum::AppendToString(std::string& buffer, const size_t& index) const
 	{
 		if (type == Datum::DatumTypes::Unknown)
 		{
@@ -549,7 +758,7 @@ namespace FieaGameEngine
 
 		StringifyDefaultFunctions func = SerializeFunctions[static_cast<int>(type)];
 		assert(func != nullptr);
-		return (this->*func)(index);
+		(this->*func)(buffer, index);
 	}
 
 	void Datum::PopBack()
@@ -559,6 +768,8 @@ namespace FieaGameEngine
 			throw std::runtime_error("Cannot remove on external data.");
 		}
 
+		Detach();
+
 		if (type == Datum::DatumTypes::String)
 		{
 			using namespace std;
@@ -578,16 +789,23 @@ namespace FieaGameEngine
 		bool found = false;
 		if (found_index < size)
 		{
+			Detach();
+
 			if (type == DatumTypes::String)
 			{
+				std::move(data.s + found_index + 1_z, data.s + size, data.s + found_index);
+
 				using namespace std;
-				data.s[found_index].~string();
+				data.s[size - 1_z].~string();
 			}
-
-			const size_t bytes_to_move = ((size - 1_z) - found_index) * size_map[static_cast<int>(type)];
-			if (bytes_to_move > 0)
+			else
 			{
-				std::memmove(&data.b[found_index*bytes_to_move], &data.b[(found_index + 1)*bytes_to_move], bytes_to_move);
+				const size_t element_size = size_map[static_cast<int>(type)];
+				const size_t bytes_to_move = ((size - 1_z) - found_index) * element_size;
+				if (bytes_to_move > 0)
+				{
+					std::memmove(&data.b[found_index * element_size], &data.b[(found_index + 1_z) * element_size], bytes_to_move);
+				}
 			}
 
 			--size;
@@ -605,6 +823,7 @@ namespace FieaGameEngine
 		size = other.size;
 		capacity = other.capacity;
 		is_external = other.is_external;
+		is_shareable = other.is_shareable;
 
 		return *this;
 	}
@@ -612,12 +831,18 @@ namespace FieaGameEngine
 	Datum& Datum::MoveDatum(Datum& other)
 	{
 		ShallowCopyDatum(other);
+		if (other.IsInline())
+		{
+			std::memcpy(inline_buffer, other.inline_buffer, InlineBytes);
+			data.vp = inline_buffer;
+		}
 
 		other.data.vp = nullptr;
 		other.type = Datum::DatumTypes::Unknown;
 		other.size = 0_z;
 		other.capacity = 0_z;
 		other.is_external = false;
+		other.is_shareable = true;
 
 		return *this;
 	}
@@ -626,25 +851,86 @@ namespace FieaGameEngine
 	{
 		if (other.capacity > 0_z)
 		{
+			// Nothing has been copied yet, so Reserve must not treat the destination as holding any elements
+			size = 0_z;
 			Reserve(other.size);
+			size = other.size;
 
-			if (type == Datum::DatumTypes::String)
+			if (capacity > 0_z)
 			{
-				for (size_t index = 0_z; index < other.size; ++index)
-				{
-					new(data.s + index)std::string(other.data.s[index]);
-				}
+				other.CopyElements(data.vp);
 			}
-			else
+		}
+
+		return *this;
+	}
+
+	Datum::BufferHeader* Datum::AllocateBuffer(const size_t& new_capacity) const
+	{
+		const size_t element_size = size_map[static_cast<int>(type)];
+		BufferHeader* header = static_cast<BufferHeader*>(malloc(sizeof(BufferHeader) + new_capacity * element_size));
+		assert(header != nullptr);
+
+		header->references = 1_z;
+		return header;
+	}
+
+	void Datum::CopyElements(void* destination) const
+	{
+		if (type == Datum::DatumTypes::String)
+		{
+			std::string* strings = static_cast<std::string*>(destination);
+			for (size_t index = 0_z; index < size; ++index)
+			{
+				new(strings + index)std::string(data.s[index]);
+			}
+		}
+		else
+		{
+			const size_t bytes_to_copy = size * size_map[static_cast<int>(type)];
+			if (bytes_to_copy > 0_z)
 			{
-				const size_t bytes_to_copy = other.size * size_map[static_cast<int>(type)];
-				if (bytes_to_copy > 0_z)
+				std::memcpy(destination, data.vp, bytes_to_copy);
+			}
+		}
+	}
+
+	void Datum::ReleaseBuffer()
+	{
+		if (is_external || capacity == 0_z)
+		{
+			return;
+		}
+
+		if (!IsInline())
+		{
+			BufferHeader& header = Header();
+			if (--header.references == 0_z)
+			{
+				if (type == DatumTypes::String)
 				{
-					std::memcpy(&data.b[0_z], &other.data.b[0_z], bytes_to_copy);
+					using namespace std;
+					for (size_t index = 0_z; index < size; ++index)
+					{
+						data.s[index].~string();
+					}
 				}
+
+				free(&header);
 			}
 		}
 
-		return *this;
+		data.vp = nullptr;
+		size = 0_z;
+		capacity = 0_z;
+		is_shareable = true;
+	}
+
+	void Datum::Unshare()
+	{
+		BufferHeader* header = AllocateBuffer(capacity);
+		CopyElements(header + 1);
+		--Header().references;
+		data.vp = header + 1;
 	}
 }
\ No newline at end of file
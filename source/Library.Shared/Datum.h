@@ -3,7 +3,13 @@
 #include <functional>
 #include "SizeLiteral.h"
 #include "DefaultIncrement.h"
+#include "Vector.h"
 #include <map>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace FieaGameEngine
 {
@@ -17,6 +23,8 @@ namespace FieaGameEngine
 	/// Size refers to the amount of elements in the vector
 	/// Capacity refers to the amount of space that's available in the vector
 	/// IsExternal refers to if the information in this Datum is defined elsewhere (ie RTTI derived classes)
+	/// Internal arrays are copy-on-write, copies share one reference counted array until either of them writes to it
+	/// Up to 16 bytes of integers, floats, a vector or pointers are kept inline in the datum itself and only move to the heap once they outgrow it
 	/// </summary>
 	class Datum final
 	{
@@ -52,7 +60,7 @@ namespace FieaGameEngine
 		/// Copy constructor which creates a new datum based on the existing other datum
 		/// </summary>
 		/// <param name="other"> The original datum to copy </param>
-		/// <remarks> If the the datum is external, perform a shallow copy. Otherwise, perform a deep copy </remarks>
+		/// <remarks> If the the datum is external, perform a shallow copy. Otherwise share the other datum's array until one of them writes to it </remarks>
 		Datum(const Datum& other);
 		
 		/// <summary>
@@ -146,7 +154,7 @@ namespace FieaGameEngine
 		/// Queries the datum for its type
 		/// </summary>
 		/// <returns> The type associated with this datum </returns>
-		const DatumTypes Type() const { return type; }
+		DatumTypes Type() const { return type; }
 
 		/// <summary>
 		/// Sets the type of the datum if it has not been set already set
@@ -177,6 +185,7 @@ namespace FieaGameEngine
 		/// Removes all elements from the datum
 		/// </summary>
 		/// <remarks> Manually calls destructor on strings, otherwise simply sets size to 0 </remarks>
+		/// <remarks> A datum sharing its array with copies only drops its reference, leaving it with no capacity until the next write </remarks>
 		void Clear();
 
 		/// <summary>
@@ -248,10 +257,19 @@ namespace FieaGameEngine
 		template<typename T>
 		void Set(const T& value, const size_t& index = 0);
 
+		/// <summary>
+		/// Sets a value of the datum at the paramaterized index
+		/// </summary>
+		/// <param name="value"> The string to move into the datum </param>
+		/// <param name="index"> The index of the datum at which to set the data </param>
+		/// <remarks> Specifically handles the r-value version of strings, every other type is as cheap to copy as to move </remarks>
+		void Set(std::string&& value, const size_t& index = 0);
+
 		/// <summary>
 		/// Gets a value of the datum at the paramaterized index
 		/// </summary>
 		/// <param name="index"> The index of the datum at which to get data </param>
+		/// <remarks> The returned reference can be written through, so a shared array is copied first and this datum stops sharing it with later copies </remarks>
 		/// <returns> The data at the given index </returns>
 		template<typename T>
 		T& Get(const size_t& index = 0);
@@ -265,25 +283,46 @@ namespace FieaGameEngine
 		template<typename T>
 		const T& Get(const size_t& index = 0) const;
 
+		/// <summary>
+		/// Views every element of the datum as one contiguous array, so bulk work only checks the type once
+		/// </summary>
+		/// <remarks> A writable view leaks the array like Get does, AsSpan&lt;const T&gt; leaves it shared. Anything that reallocates or detaches the array invalidates the view </remarks>
+		/// <exception cref="std::runtime_error"> If the datum doesn't hold T </exception>
+		/// <returns> A span over the elements, empty if the datum is </returns>
+		template<typename T>
+		std::span<T> AsSpan();
+
+		/// <summary>
+		/// Views every element of the datum as one contiguous, read only array
+		/// </summary>
+		/// <remarks> Specifically refers to the AsSpan on const datums </remarks>
+		/// <exception cref="std::runtime_error"> If the datum doesn't hold T </exception>
+		/// <returns> A span over the elements, empty if the datum is </returns>
+		template<typename T>
+		std::span<const std::remove_const_t<T>> AsSpan() const;
+
 		/// <summary>
 		/// Converts a value in string format to that actual value
 		/// </summary>
+		/// <remarks> Numbers are parsed in place with from_chars, vectors and matrices follow the glm::to_string layout </remarks>
+		/// <exception cref="std::invalid_argument"> If the string doesn't start with a value of type T </exception>
+		/// <exception cref="std::out_of_range"> If a number doesn't fit in its type </exception>
 		/// <returns> The actual value based on the parameter </returns>
 		template <typename T>
-		T FromString(const std::string& value);
+		T FromString(std::string_view value);
 
 		/// <summary>
 		/// Calls set on a string, which requires parsing
 		/// </summary>
 		/// <param name="value"> The value which needs to be parsed. When parsed, sends a value to set </param>
 		/// <param name="index"> The index of the datum at which to set the data </param>
-		void SetFromString(const std::string& value, const size_t& index = 0);
+		void SetFromString(std::string_view value, const size_t& index = 0);
 
 		/// <summary>
 		/// Calls the FromString template and pushes back into the Datum thereafter
 		/// </summary>
 		/// <param name="value"> The string to deserialize and push into the Datum </param>
-		void PushBackFromString(const std::string& value);
+		void PushBackFromString(std::string_view value);
 
 		/// <summary>
 		/// Converts a data value to a string at the given index
@@ -292,6 +331,14 @@ namespace FieaGameEngine
 		/// <returns> A string converted from the data found at the index </returns>
 		std::string ToString(const size_t& index = 0) const;
 
+		/// <summary>
+		/// Converts a data value to a string at the given index and appends it to an existing buffer
+		/// </summary>
+		/// <param name="buffer"> The string to append onto, its capacity is reused across calls </param>
+		/// <param name="index"> The index of the datum at which to get the data to convert to a string </param>
+		/// <remarks> Numbers are formatted with to_chars, the shortest text which reads back as the same value </remarks>
+		void AppendToString(std::string& buffer, const size_t& index = 0) const;
+
 		/// <summary>
 		/// Adds a new element to the end of the datum
 		/// </summary>
@@ -307,6 +354,22 @@ namespace FieaGameEngine
 		template <typename IncrementFunctor = DefaultIncrement>
 		void PushBack(std::string&& value);
 
+		/// <summary>
+		/// Copies a range of elements onto the end of the datum, growing at most once
+		/// </summary>
+		/// <param name="values"> The elements to copy, which must not live in this datum </param>
+		/// <exception cref="std::runtime_error"> If the datum is external or doesn't hold T </exception>
+		template <typename T, typename IncrementFunctor = DefaultIncrement>
+		void Append(std::span<const T> values);
+
+		/// <summary>
+		/// Moves every element of a vector onto the end of the datum, growing at most once
+		/// </summary>
+		/// <param name="values"> The elements to move, the vector is left empty afterwards </param>
+		/// <exception cref="std::runtime_error"> If the datum is external or doesn't hold T </exception>
+		template <typename T, typename IncrementFunctor = DefaultIncrement>
+		void Append(Vector<T>&& values);
+
 		/// <summary>
 		/// Removes the last data member of the datum
 		/// </summary>
@@ -362,7 +425,7 @@ namespace FieaGameEngine
 		/// <param name="value"> The data to search for </param>
 		/// <returns> The index of the data, size if not found </returns>
 		template<typename T>
-		inline const size_t IndexOf(const T& value) const;
+		inline size_t IndexOf(const T& value) const;
 
 		/// <summary>
 		/// Queries the current Datum and determines if its external or not
@@ -370,6 +433,19 @@ namespace FieaGameEngine
 		/// <returns> An indicator determining if the Datum is external or not </returns>
 		bool IsExternal();
 
+		/// <summary>
+		/// Queries the current Datum and determines if its internal array is shared with a copy
+		/// </summary>
+		/// <returns> An indicator determining if the next write has to copy the array first </returns>
+		/// <remarks> Inline elements are never shared, a copy copies them right away </remarks>
+		bool IsShared() const;
+
+		/// <summary>
+		/// Queries the current Datum and determines if its elements are stored inline rather than on the heap
+		/// </summary>
+		/// <returns> An indicator determining if the elements live inside the datum </returns>
+		bool IsInline() const;
+
 		/// <summary>
 		/// A mapping of names which converts the DatumType into a string for easy lookup
 		/// </summary>
@@ -398,6 +474,12 @@ namespace FieaGameEngine
 		};
 
 	private:
+		// Sits in front of every internal array, counting the datums which share it
+		struct alignas(std::max_align_t) BufferHeader final
+		{
+			size_t references = 0_z;
+		};
+
 		union DatumValue
 		{
 			int* i;
@@ -413,7 +495,7 @@ namespace FieaGameEngine
 		};
 
 		template <typename IncrementFunctor = DefaultIncrement>
-		void PotentiallyReserve(const Datum::DatumTypes& other_type);
+		void PotentiallyReserve(const Datum::DatumTypes& other_type, const size_t additional = 1);
 
 		template <typename IncrementFunctor = DefaultIncrement>
 		void PushBack(Scope& value);
@@ -423,6 +505,52 @@ namespace FieaGameEngine
 		void GetInit(const Datum::DatumTypes& other_type, const size_t& index) const;
 		void SetInit(const Datum::DatumTypes& other_type, const size_t& index) const;
 
+		/// <summary>
+		/// Queries the header in front of the internal array, only valid while the datum holds one
+		/// </summary>
+		/// <returns> The header of the internal array </returns>
+		BufferHeader& Header() const;
+
+		/// <summary>
+		/// Queries how many elements of this datum's type fit in the inline buffer
+		/// </summary>
+		/// <returns> The inline capacity, zero for strings, matrices and unknown types </returns>
+		size_t InlineCapacity() const;
+
+		/// <summary>
+		/// Allocates an unshared internal array with room for the given amount of elements
+		/// </summary>
+		/// <param name="new_capacity"> The amount of elements the array holds </param>
+		/// <returns> The header of the new array, the elements follow it </returns>
+		BufferHeader* AllocateBuffer(const size_t& new_capacity) const;
+
+		/// <summary>
+		/// Copy constructs every element of this datum into another array of the same type
+		/// </summary>
+		/// <param name="destination"> The uninitialized array to copy into </param>
+		void CopyElements(void* destination) const;
+
+		/// <summary>
+		/// Drops this datum's reference to its internal array, destroying the array if nobody else shares it
+		/// </summary>
+		/// <remarks> Leaves the datum without an array, external datums are left alone </remarks>
+		void ReleaseBuffer();
+
+		/// <summary>
+		/// Copies a shared internal array so this datum can write to it
+		/// </summary>
+		void Detach();
+
+		/// <summary>
+		/// Moves this datum onto its own copy of a shared internal array, keeping the capacity
+		/// </summary>
+		void Unshare();
+
+		/// <summary>
+		/// Detaches the internal array and stops sharing it with later copies, as a reference into it is about to be handed out
+		/// </summary>
+		void Leak();
+
 		Datum& ShallowCopyDatum(const Datum& other);
 		Datum& MoveDatum(Datum& other);
 		Datum& DeepCopyDatum(const Datum& other);
@@ -444,8 +572,14 @@ namespace FieaGameEngine
 		size_t size = 0_z;
 		size_t capacity = 0_z;
 		bool is_external = false;
+		bool is_shareable = true; // Cleared once a writable reference into the internal array was handed out
+
+		// Holds the elements while the capacity fits, data then points here. Strings and matrices always go to the heap
+		static constexpr size_t InlineBytes = 16;
+		alignas(glm::vec4) alignas(void*) std::byte inline_buffer[InlineBytes];
 
 		friend class Attributed;
+		friend class DatumMath;
 		/// <summary>
 		/// A templated method which sets a datum to be externally stored
 		/// </summary>
@@ -459,13 +593,13 @@ namespace FieaGameEngine
 
 #pragma region CreateFunctions
 
-		inline void CreateIntegers(const size_t& startIndex, const size_t& amount);
-		inline void CreateFloats(const size_t& startIndex, const size_t& amount);
-		inline void CreateStrings(const size_t& startIndex, const size_t& amount);
-		inline void CreateVectors(const size_t& startIndex, const size_t& amount);
-		inline void CreateMatrices(const size_t& startIndex, const size_t& amount);
-		inline void CreatePointers(const size_t& startIndex, const size_t& amount);
-		inline void CreateTables(const size_t& startIndex, const size_t& amount);
+		void CreateIntegers(const size_t& startIndex, const size_t& amount);
+		void CreateFloats(const size_t& startIndex, const size_t& amount);
+		void CreateStrings(const size_t& startIndex, const size_t& amount);
+		void CreateVectors(const size_t& startIndex, const size_t& amount);
+		void CreateMatrices(const size_t& startIndex, const size_t& amount);
+		void CreatePointers(const size_t& startIndex, const size_t& amount);
+		void CreateTables(const size_t& startIndex, const size_t& amount);
 
 		using CreateDefaultFunctions = void(Datum::*)(const size_t&, const size_t&);
 		inline static const Datum::CreateDefaultFunctions CreateFunctions[static_cast<int>(DatumTypes::End) + 1] =
@@ -483,9 +617,9 @@ namespace FieaGameEngine
 
 #pragma region CompareFunctions
 
-		inline bool CompareMemory(const Datum& other) const;
-		inline bool CompareStrings(const Datum& other) const;
-		inline bool ComparePointers(const Datum& other) const;
+		bool CompareMemory(const Datum& other) const;
+		bool CompareStrings(const Datum& other) const;
+		bool ComparePointers(const Datum& other) const;
 
 		using CompareDefaultFunctions = bool(Datum::*)(const Datum&) const;
 		inline static const Datum::CompareDefaultFunctions CompareFunctions[static_cast<int>(DatumTypes::End) + 1] =
@@ -503,14 +637,14 @@ namespace FieaGameEngine
 
 #pragma region SerializeFunctions 
 
-		inline std::string SerializeInteger(const size_t& index) const;
-		inline std::string SerializeFloat(const size_t& index) const ;
-		inline std::string SerializeString(const size_t& index) const;
-		inline std::string SerializeVector(const size_t& index) const;
-		inline std::string SerializeMatrix(const size_t& index) const;
-		inline std::string SerializePointer(const size_t& index) const;
+		void SerializeInteger(std::string& buffer, const size_t& index) const;
+		void SerializeFloat(std::string& buffer, const size_t& index) const;
+		void SerializeString(std::string& buffer, const size_t& index) const;
+		void SerializeVector(std::string& buffer, const size_t& index) const;
+		void SerializeMatrix(std::string& buffer, const size_t& index) const;
+		void SerializePointer(std::string& buffer, const size_t& index) const;
 
-		using StringifyDefaultFunctions = std::string(Datum::*)(const size_t&) const;
+		using StringifyDefaultFunctions = void(Datum::*)(std::string&, const size_t&) const;
 		inline static const Datum::StringifyDefaultFunctions SerializeFunctions[static_cast<int>(DatumTypes::End) + 1] =
 		{
 			&Datum::SerializeInteger,
@@ -526,14 +660,14 @@ namespace FieaGameEngine
 
 #pragma region SetDeserializeFunctions
 
-		inline void SetDeserializeInteger(const std::string& value, const size_t& index);
-		inline void SetDeserializeFloat(const std::string& value, const size_t& index);
-		inline void SetDeserializeString(const std::string& value, const size_t& index);
-		inline void SetDeserializeVector(const std::string& value, const size_t& index);
-		inline void SetDeserializeMatrix(const std::string& value, const size_t& index);
-		inline void SetDeserializePointer(const std::string& value, const size_t& index);
+		void SetDeserializeInteger(std::string_view value, const size_t& index);
+		void SetDeserializeFloat(std::string_view value, const size_t& index);
+		void SetDeserializeString(std::string_view value, const size_t& index);
+		void SetDeserializeVector(std::string_view value, const size_t& index);
+		void SetDeserializeMatrix(std::string_view value, const size_t& index);
+		void SetDeserializePointer(std::string_view value, const size_t& index);
 
-		using DestringDefaultFunctions = void(Datum::*)(const std::string&, const size_t&);
+		using DestringDefaultFunctions = void(Datum::*)(std::string_view, const size_t&);
 		inline static const Datum::DestringDefaultFunctions SetDeserializeFunctions[static_cast<int>(DatumTypes::End) + 1] =
 		{
 			&Datum::SetDeserializeInteger,
@@ -549,14 +683,14 @@ namespace FieaGameEngine
 
 #pragma region PushBackDeserializeFunctions
 
-		inline void PushBackDeserializeInteger(const std::string& value);
-		inline void PushBackDeserializeFloat(const std::string& value);
-		inline void PushBackDeserializeString(const std::string& value);
-		inline void PushBackDeserializeVector(const std::string& value);
-		inline void PushBackDeserializeMatrix(const std::string& value);
-		inline void PushBackDeserializePointer(const std::string& value);
+		void PushBackDeserializeInteger(std::string_view value);
+		void PushBackDeserializeFloat(std::string_view value);
+		void PushBackDeserializeString(std::string_view value);
+		void PushBackDeserializeVector(std::string_view value);
+		void PushBackDeserializeMatrix(std::string_view value);
+		void PushBackDeserializePointer(std::string_view value);
 
-		using PushBackDefaultFunctions = void(Datum::*)(const std::string&);
+		using PushBackDefaultFunctions = void(Datum::*)(std::string_view);
 		inline static const Datum::PushBackDefaultFunctions PushBackDeserializeFunctions[static_cast<int>(DatumTypes::End) + 1] =
 		{
 			&Datum::PushBackDeserializeInteger,
@@ -572,6 +706,18 @@ namespace FieaGameEngine
 	
 	}; // END OF DATUM CLASS
 
+	/// <summary>
+	/// Maps a C++ type to the DatumTypes value a datum holding it has, Unknown for types a datum can't view directly
+	/// </summary>
+	/// <remarks> Tables are left out on purpose, a datum stores pointers to its scopes rather than the scopes </remarks>
+	template <typename T> inline constexpr Datum::DatumTypes DatumTypeOf = Datum::DatumTypes::Unknown;
+	template <> inline constexpr Datum::DatumTypes DatumTypeOf<int> = Datum::DatumTypes::Integer;
+	template <> inline constexpr Datum::DatumTypes DatumTypeOf<float> = Datum::DatumTypes::Float;
+	template <> inline constexpr Datum::DatumTypes DatumTypeOf<std::string> = Datum::DatumTypes::String;
+	template <> inline constexpr Datum::DatumTypes DatumTypeOf<glm::vec4> = Datum::DatumTypes::Vector;
+	template <> inline constexpr Datum::DatumTypes DatumTypeOf<glm::mat4> = Datum::DatumTypes::Matrix;
+	template <> inline constexpr Datum::DatumTypes DatumTypeOf<RTTI*> = Datum::DatumTypes::Pointer;
+
 // Template Method Specializations
 
 #pragma region EqualityScalar
@@ -697,12 +843,13 @@ namespace FieaGameEngine
 
 #pragma region IndexOf
 
-	template<> const size_t Datum::IndexOf(const int& value) const;
-	template<> const size_t Datum::IndexOf(const float& value) const;
-	template<> const size_t Datum::IndexOf(const std::string& value) const;
-	template<> const size_t Datum::IndexOf(const glm::vec4& value) const;
-	template<> const size_t Datum::IndexOf(const glm::mat4& value) const;
-	template<> const size_t Datum::IndexOf(RTTI* const& value) const;
+	template<> size_t Datum::IndexOf(const int& value) const;
+	template<> size_t Datum::IndexOf(const float& value) const;
+	template<> size_t Datum::IndexOf(const std::string& value) const;
+	template<> size_t Datum::IndexOf(const glm::vec4& value) const;
+	template<> size_t Datum::IndexOf(const glm::mat4& value) const;
+	template<> size_t Datum::IndexOf(RTTI* const& value) const;
+	template<> size_t Datum::IndexOf(const Scope& value) const; // Compares addresses, not contents
 
 #pragma endregion IndexOf
 }
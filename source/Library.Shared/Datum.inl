@@ -1,84 +1,93 @@
 #include "Datum.h"
 #include "SizeLiteral.h"
+#include <memory>
 
 namespace FieaGameEngine
 {
+	// Depends on T so the assertions below only fire when an unsupported type is actually used
+	template <typename T>
+	inline constexpr bool unsupported_type = false;
+
 	template<typename T>
 	inline bool Datum::operator==(const T& /*value*/) const
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
+		return false;
 	}
 
 	template<typename T>
 	inline bool Datum::operator!=(const T& /*value*/) const
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
+		return false;
 	}
 
 	template<typename T>
 	inline void Datum::Set(const T& /*value*/, const size_t& /*index*/)
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
 	}
 
 	template<typename T>
 	inline T& Datum::Get(const size_t& /*index*/)
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
 	}
 
 	template<typename T>
 	inline const T& Datum::Get(const size_t& /*index*/) const
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
 	}
 
 	template<typename T>
 	inline void Datum::SetStorage(T* /*new_data*/, const size_t& /*new_size*/)
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
 	}
 
 	template <typename T, typename IncrementFunctor>
 	inline void Datum::PushBack(const T& /*value*/)
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
 	}
 
 	template<typename T>
 	inline T& Datum::Front()
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
 	}
 
 	template<typename T>
 	inline const T& Datum::Front() const
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
 	}
 
 	template<typename T>
 	inline T& Datum::Back()
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
 	}
 
 	template<typename T>
 	inline const T& Datum::Back() const
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
 	}
 
 	template<typename T>
-	inline const size_t Datum::IndexOf(const T& /*value*/) const
+	inline size_t Datum::IndexOf(const T& /*value*/) const
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
+		return size;
 	}
 
 	template<typename T>
 	inline bool Datum::Remove(const T& /*value*/)
 	{
-		static_assert(false, "Data type not supported");
+		static_assert(unsupported_type<T>, "Data type not supported");
+		return false;
 	}
 
 #pragma region EqualityScalar
@@ -163,6 +172,7 @@ namespace FieaGameEngine
 	inline void Datum::Set(const int& value, const size_t& index)
 	{
 		SetInit(Datum::DatumTypes::Integer, index);
+		Detach();
 		data.i[index] = value;
 	}
 
@@ -170,6 +180,7 @@ namespace FieaGameEngine
 	inline void Datum::Set(const float& value, const size_t& index)
 	{
 		SetInit(Datum::DatumTypes::Float, index);
+		Detach();
 		data.f[index] = value;
 	}
 
@@ -177,13 +188,22 @@ namespace FieaGameEngine
 	inline void Datum::Set(const std::string& value, const size_t& index)
 	{
 		SetInit(Datum::DatumTypes::String, index);
+		Detach();
 		data.s[index] = value;
 	}
 
+	inline void Datum::Set(std::string&& value, const size_t& index)
+	{
+		SetInit(Datum::DatumTypes::String, index);
+		Detach();
+		data.s[index] = std::move(value);
+	}
+
 	template<>
 	inline void Datum::Set(const glm::vec4& value, const size_t& index)
 	{
 		SetInit(Datum::DatumTypes::Vector, index);
+		Detach();
 		data.v[index] = value;
 	}
 
@@ -191,6 +211,7 @@ namespace FieaGameEngine
 	inline void Datum::Set(const glm::mat4& value, const size_t& index)
 	{
 		SetInit(Datum::DatumTypes::Matrix, index);
+		Detach();
 		data.m[index] = value;
 	}
 
@@ -198,12 +219,14 @@ namespace FieaGameEngine
 	inline void Datum::Set(RTTI* const& value, const size_t& index)
 	{
 		SetInit(Datum::DatumTypes::Pointer, index);
+		Detach();
 		data.r[index] = value;
 	}
 
 	inline void Datum::SetScope(Scope& value, const size_t& index)
 	{
 		SetInit(Datum::DatumTypes::Table, index);
+		Detach();
 		data.sc[index] = &value;
 	}
 
@@ -228,6 +251,7 @@ namespace FieaGameEngine
 	inline int& Datum::Get(const size_t& index)
 	{
 		GetInit(Datum::DatumTypes::Integer, index);
+		Leak();
 		return data.i[index];
 	}
 
@@ -242,6 +266,7 @@ namespace FieaGameEngine
 	inline float& Datum::Get(const size_t& index)
 	{
 		GetInit(Datum::DatumTypes::Float, index);
+		Leak();
 		return data.f[index];
 	}
 
@@ -256,6 +281,7 @@ namespace FieaGameEngine
 	inline std::string& Datum::Get(const size_t& index)
 	{
 		GetInit(Datum::DatumTypes::String, index);
+		Leak();
 		return data.s[index];
 	}
 
@@ -270,6 +296,7 @@ namespace FieaGameEngine
 	inline glm::vec4& Datum::Get(const size_t& index)
 	{
 		GetInit(Datum::DatumTypes::Vector, index);
+		Leak();
 		return data.v[index];
 	}
 
@@ -284,6 +311,7 @@ namespace FieaGameEngine
 	inline glm::mat4& Datum::Get(const size_t& index)
 	{
 		GetInit(Datum::DatumTypes::Matrix, index);
+		Leak();
 		return data.m[index];
 	}
 
@@ -298,6 +326,7 @@ namespace FieaGameEngine
 	inline RTTI*& Datum::Get(const size_t& index)
 	{
 		GetInit(Datum::DatumTypes::Pointer, index);
+		Leak();
 		return data.r[index];
 	}
 
@@ -341,6 +370,41 @@ namespace FieaGameEngine
 
 #pragma endregion Get
 
+#pragma region AsSpan
+
+	template<typename T>
+	inline std::span<T> Datum::AsSpan()
+	{
+		using ValueType = std::remove_const_t<T>;
+		static_assert(DatumTypeOf<ValueType> != DatumTypes::Unknown, "Data type not supported");
+		if (DatumTypeOf<ValueType> != type)
+		{
+			throw std::runtime_error("The Datum type is incorrect.");
+		}
+
+		if constexpr (!std::is_const_v<T>)
+		{
+			Leak();
+		}
+
+		return std::span<T>(static_cast<ValueType*>(data.vp), size);
+	}
+
+	template<typename T>
+	inline std::span<const std::remove_const_t<T>> Datum::AsSpan() const
+	{
+		using ValueType = std::remove_const_t<T>;
+		static_assert(DatumTypeOf<ValueType> != DatumTypes::Unknown, "Data type not supported");
+		if (DatumTypeOf<ValueType> != type)
+		{
+			throw std::runtime_error("The Datum type is incorrect.");
+		}
+
+		return std::span<const ValueType>(static_cast<const ValueType*>(data.vp), size);
+	}
+
+#pragma endregion AsSpan
+
 #pragma region PushBack
 
 	template<>
@@ -399,8 +463,34 @@ namespace FieaGameEngine
 		new(data.sc + size++)Scope*(&value);
 	}
 
+	template <typename T, typename IncrementFunctor>
+	inline void Datum::Append(std::span<const T> values)
+	{
+		static_assert(DatumTypeOf<T> != DatumTypes::Unknown, "Data type not supported");
+
+		PotentiallyReserve<IncrementFunctor>(DatumTypeOf<T>, values.size());
+		std::uninitialized_copy(values.begin(), values.end(), static_cast<T*>(data.vp) + size);
+		size += values.size();
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline void Datum::Append(Vector<T>&& values)
+	{
+		static_assert(DatumTypeOf<T> != DatumTypes::Unknown, "Data type not supported");
+
+		PotentiallyReserve<IncrementFunctor>(DatumTypeOf<T>, values.Size());
+		T* destination = static_cast<T*>(data.vp) + size;
+		for (T& value : values)
+		{
+			new(destination++)T(std::move(value));
+		}
+
+		size += values.Size();
+		values.Clear();
+	}
+
 	template <typename IncrementFunctor>
-	inline void Datum::PotentiallyReserve(const Datum::DatumTypes& other_type)
+	inline void Datum::PotentiallyReserve(const Datum::DatumTypes& other_type, const size_t additional)
 	{
 		if (is_external)
 		{
@@ -414,10 +504,20 @@ namespace FieaGameEngine
 
 		IncrementFunctor incrementor{};
 
-		if (size == capacity)
+		if (size + additional > capacity)
 		{
 			size_t new_capacity = capacity + std::max(1_z, incrementor(size, capacity));
-			Reserve(new_capacity);
+			if (capacity < InlineCapacity() && (capacity == 0_z || IsInline()))
+			{
+				// Fill the inline buffer before growing onto the heap
+				new_capacity = std::min(new_capacity, InlineCapacity());
+			}
+
+			Reserve(std::max(new_capacity, size + additional));
+		}
+		else
+		{
+			Detach();
 		}
 	}
 
@@ -730,7 +830,7 @@ namespace FieaGameEngine
 #pragma region IndexOf
 
 	template<>
-	inline const size_t Datum::IndexOf(const int& value) const
+	inline size_t Datum::IndexOf(const int& value) const
 	{
 		size_t index;
 		for (index = 0; index < size; ++index)
@@ -745,7 +845,7 @@ namespace FieaGameEngine
 	}
 
 	template<>
-	inline const size_t Datum::IndexOf(const float& value) const
+	inline size_t Datum::IndexOf(const float& value) const
 	{
 		size_t index;
 		for (index = 0; index < size; ++index)
@@ -760,7 +860,7 @@ namespace FieaGameEngine
 	}
 
 	template<>
-	inline const size_t Datum::IndexOf(const std::string& value) const
+	inline size_t Datum::IndexOf(const std::string& value) const
 	{
 		size_t index;
 		for (index = 0; index < size; ++index)
@@ -775,7 +875,7 @@ namespace FieaGameEngine
 	}
 
 	template<>
-	inline const size_t Datum::IndexOf(const glm::vec4& value) const
+	inline size_t Datum::IndexOf(const glm::vec4& value) const
 	{
 		size_t index;
 		for (index = 0; index < size; ++index)
@@ -790,7 +890,7 @@ namespace FieaGameEngine
 	}
 
 	template<>
-	inline const size_t Datum::IndexOf(const glm::mat4& value) const
+	inline size_t Datum::IndexOf(const glm::mat4& value) const
 	{
 		size_t index;
 		for (index = 0; index < size; ++index)
@@ -805,7 +905,7 @@ namespace FieaGameEngine
 	}
 
 	template<>
-	inline const size_t Datum::IndexOf(RTTI* const& value) const
+	inline size_t Datum::IndexOf(RTTI* const& value) const
 	{
 		size_t index;
 		for (index = 0; index < size; ++index)
@@ -819,10 +919,67 @@ namespace FieaGameEngine
 		return index;
 	}
 
+	template<>
+	inline size_t Datum::IndexOf(const Scope& value) const
+	{
+		size_t index;
+		for (index = 0; index < size; ++index)
+		{
+			if (data.sc[index] == &value)
+			{
+				break;
+			}
+		}
+
+		return index;
+	}
+
 #pragma endregion IndexOf
 
 	inline bool Datum::IsExternal()
 	{
 		return is_external;
 	}
+
+	inline bool Datum::IsShared() const
+	{
+		return !is_external && capacity > 0_z && !IsInline() && Header().references > 1_z;
+	}
+
+	inline bool Datum::IsInline() const
+	{
+		return data.vp == inline_buffer;
+	}
+
+	inline size_t Datum::InlineCapacity() const
+	{
+		switch (type)
+		{
+		case DatumTypes::String:
+		case DatumTypes::Matrix:
+		case DatumTypes::Unknown:
+			return 0_z;
+		default:
+			return InlineBytes / size_map[static_cast<int>(type)];
+		}
+	}
+
+	inline Datum::BufferHeader& Datum::Header() const
+	{
+		return *(reinterpret_cast<BufferHeader*>(data.vp) - 1);
+	}
+
+	inline void Datum::Detach()
+	{
+		if (IsShared())
+		{
+			Unshare();
+		}
+	}
+
+	inline void Datum::Leak()
+	{
+		Detach();
+		is_shareable = false;
+	}
 }
\ No newline at end of file
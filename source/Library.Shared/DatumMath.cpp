@@ -0,0 +1,542 @@
+#include "pch.h"
+#include "DatumMath.h"
+#include <algorithm>
+
+#if defined(__SSE2__) && defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#define DATUM_MATH_X64 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define DATUM_MATH_AVX2 // MSVC emits AVX2 intrinsics without enabling them for the whole file
+#else
+#define DATUM_MATH_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Checks the processor and operating system once for AVX2 support
+		/// </summary>
+		/// <returns> True if the AVX2 kernels can run </returns>
+		bool DetectAvx2()
+		{
+#if defined(DATUM_MATH_X64) && defined(_MSC_VER) && !defined(__clang__)
+			int registers[4];
+			__cpuid(registers, 0);
+			if (registers[0] < 7)
+			{
+				return false;
+			}
+
+			// The operating system has to save the upper halves of the registers, advertised through OSXSAVE and XCR0
+			__cpuid(registers, 1);
+			const bool os_saves_avx = (registers[2] & (1 << 27)) != 0 && (registers[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+			__cpuidex(registers, 7, 0);
+			return os_saves_avx && (registers[1] & (1 << 5)) != 0;
+#elif defined(DATUM_MATH_X64)
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2");
+#else
+			return false;
+#endif
+		}
+
+		bool HasAvx2()
+		{
+			static const bool has_avx2 = DetectAvx2();
+			return has_avx2;
+		}
+
+		/// <summary>
+		/// Views a Float or Vector datum as one array of floats, without writing to it
+		/// </summary>
+		/// <param name="datum"> The datum to read </param>
+		/// <exception cref="std::runtime_error"> If the datum isn't of type Float or Vector </exception>
+		/// <returns> Every float of the datum </returns>
+		std::span<const float> ReadableFloats(const Datum& datum)
+		{
+			if (datum.Type() == Datum::DatumTypes::Vector)
+			{
+				const std::span<const glm::vec4> vectors = datum.AsSpan<glm::vec4>();
+				return std::span<const float>(reinterpret_cast<const float*>(vectors.data()), vectors.size() * 4_z);
+			}
+
+			return datum.AsSpan<float>();
+		}
+
+		/// <summary>
+		/// Ensures two datums can be combined element by element
+		/// </summary>
+		/// <param name="target"> The datum which will be written </param>
+		/// <param name="other"> The datum which will be read </param>
+		/// <exception cref="std::runtime_error"> If the types or the sizes differ </exception>
+		void ValidatePair(const Datum& target, const Datum& other)
+		{
+			if (target.Type() != other.Type())
+			{
+				throw std::runtime_error("The Datum type is incorrect.");
+			}
+
+			if (target.Size() != other.Size())
+			{
+				throw std::runtime_error("The Datums differ in size.");
+			}
+		}
+
+		void ValidateRange(const bool is_ordered)
+		{
+			if (!is_ordered)
+			{
+				throw std::invalid_argument("The minimum is greater than the maximum.");
+			}
+		}
+
+#pragma region Avx2Kernels
+
+		// Each AVX2 kernel handles whole groups of eight and returns how many elements it processed, the caller finishes the rest
+#ifdef DATUM_MATH_X64
+
+		DATUM_MATH_AVX2 size_t AddFloatsAvx2(float* target, const float* other, const size_t count)
+		{
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				_mm256_storeu_ps(target + index, _mm256_add_ps(_mm256_loadu_ps(target + index), _mm256_loadu_ps(other + index)));
+			}
+
+			return index;
+		}
+
+		DATUM_MATH_AVX2 size_t AddScalarAvx2(float* target, const float amount, const size_t count)
+		{
+			const __m256 amounts = _mm256_set1_ps(amount);
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				_mm256_storeu_ps(target + index, _mm256_add_ps(_mm256_loadu_ps(target + index), amounts));
+			}
+
+			return index;
+		}
+
+		DATUM_MATH_AVX2 size_t ScaleAvx2(float* target, const float factor, const size_t count)
+		{
+			const __m256 factors = _mm256_set1_ps(factor);
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				_mm256_storeu_ps(target + index, _mm256_mul_ps(_mm256_loadu_ps(target + index), factors));
+			}
+
+			return index;
+		}
+
+		DATUM_MATH_AVX2 size_t MultiplyAddAvx2(float* target, const float* other, const float factor, const size_t count)
+		{
+			// Multiplies and adds separately rather than fused, so every path rounds the same way
+			const __m256 factors = _mm256_set1_ps(factor);
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				const __m256 scaled = _mm256_mul_ps(_mm256_loadu_ps(other + index), factors);
+				_mm256_storeu_ps(target + index, _mm256_add_ps(_mm256_loadu_ps(target + index), scaled));
+			}
+
+			return index;
+		}
+
+		DATUM_MATH_AVX2 size_t ClampFloatsAvx2(float* target, const float minimum, const float maximum, const size_t count)
+		{
+			const __m256 minimums = _mm256_set1_ps(minimum);
+			const __m256 maximums = _mm256_set1_ps(maximum);
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				_mm256_storeu_ps(target + index, _mm256_min_ps(maximums, _mm256_max_ps(minimums, _mm256_loadu_ps(target + index))));
+			}
+
+			return index;
+		}
+
+		DATUM_MATH_AVX2 size_t LerpAvx2(float* target, const float* other, const float weight, const size_t count)
+		{
+			const __m256 weights = _mm256_set1_ps(weight);
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				const __m256 from = _mm256_loadu_ps(target + index);
+				const __m256 step = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(other + index), from), weights);
+				_mm256_storeu_ps(target + index, _mm256_add_ps(from, step));
+			}
+
+			return index;
+		}
+
+		DATUM_MATH_AVX2 size_t AddIntegersAvx2(int* target, const int* other, const size_t count)
+		{
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				__m256i* destination = reinterpret_cast<__m256i*>(target + index);
+				const __m256i addends = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(other + index));
+				_mm256_storeu_si256(destination, _mm256_add_epi32(_mm256_loadu_si256(destination), addends));
+			}
+
+			return index;
+		}
+
+		DATUM_MATH_AVX2 size_t AddIntegerScalarAvx2(int* target, const int amount, const size_t count)
+		{
+			const __m256i amounts = _mm256_set1_epi32(amount);
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				__m256i* destination = reinterpret_cast<__m256i*>(target + index);
+				_mm256_storeu_si256(destination, _mm256_add_epi32(_mm256_loadu_si256(destination), amounts));
+			}
+
+			return index;
+		}
+
+		DATUM_MATH_AVX2 size_t ClampIntegersAvx2(int* target, const int minimum, const int maximum, const size_t count)
+		{
+			const __m256i minimums = _mm256_set1_epi32(minimum);
+			const __m256i maximums = _mm256_set1_epi32(maximum);
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				__m256i* destination = reinterpret_cast<__m256i*>(target + index);
+				_mm256_storeu_si256(destination, _mm256_min_epi32(_mm256_max_epi32(_mm256_loadu_si256(destination), minimums), maximums));
+			}
+
+			return index;
+		}
+
+#endif
+
+#pragma endregion Avx2Kernels
+
+#pragma region Kernels
+
+		// SSE2 is part of every x64 processor, so it picks up whatever the AVX2 kernel left or does all the work without AVX2
+
+		void AddFloats(float* target, const float* other, const size_t count)
+		{
+			size_t index = 0;
+#ifdef DATUM_MATH_X64
+			if (HasAvx2())
+			{
+				index = AddFloatsAvx2(target, other, count);
+			}
+
+			for (; index + 4 <= count; index += 4)
+			{
+				_mm_storeu_ps(target + index, _mm_add_ps(_mm_loadu_ps(target + index), _mm_loadu_ps(other + index)));
+			}
+#endif
+			for (; index < count; ++index)
+			{
+				target[index] += other[index];
+			}
+		}
+
+		void AddScalar(float* target, const float amount, const size_t count)
+		{
+			size_t index = 0;
+#ifdef DATUM_MATH_X64
+			if (HasAvx2())
+			{
+				index = AddScalarAvx2(target, amount, count);
+			}
+
+			const __m128 amounts = _mm_set1_ps(amount);
+			for (; index + 4 <= count; index += 4)
+			{
+				_mm_storeu_ps(target + index, _mm_add_ps(_mm_loadu_ps(target + index), amounts));
+			}
+#endif
+			for (; index < count; ++index)
+			{
+				target[index] += amount;
+			}
+		}
+
+		void ScaleFloats(float* target, const float factor, const size_t count)
+		{
+			size_t index = 0;
+#ifdef DATUM_MATH_X64
+			if (HasAvx2())
+			{
+				index = ScaleAvx2(target, factor, count);
+			}
+
+			const __m128 factors = _mm_set1_ps(factor);
+			for (; index + 4 <= count; index += 4)
+			{
+				_mm_storeu_ps(target + index, _mm_mul_ps(_mm_loadu_ps(target + index), factors));
+			}
+#endif
+			for (; index < count; ++index)
+			{
+				target[index] *= factor;
+			}
+		}
+
+		void MultiplyAddFloats(float* target, const float* other, const float factor, const size_t count)
+		{
+			size_t index = 0;
+#ifdef DATUM_MATH_X64
+			if (HasAvx2())
+			{
+				index = MultiplyAddAvx2(target, other, factor, count);
+			}
+
+			const __m128 factors = _mm_set1_ps(factor);
+			for (; index + 4 <= count; index += 4)
+			{
+				const __m128 scaled = _mm_mul_ps(_mm_loadu_ps(other + index), factors);
+				_mm_storeu_ps(target + index, _mm_add_ps(_mm_loadu_ps(target + index), scaled));
+			}
+#endif
+			for (; index < count; ++index)
+			{
+				const float scaled = other[index] * factor;
+				target[index] += scaled;
+			}
+		}
+
+		void ClampFloats(float* target, const float minimum, const float maximum, const size_t count)
+		{
+			size_t index = 0;
+#ifdef DATUM_MATH_X64
+			if (HasAvx2())
+			{
+				index = ClampFloatsAvx2(target, minimum, maximum, count);
+			}
+
+			// min and max return their second operand when either is NaN, so with the element second a NaN passes through
+			// unchanged. The scalar loop makes the same comparisons, so a NaN ends up the same whichever path it lands on
+			const __m128 minimums = _mm_set1_ps(minimum);
+			const __m128 maximums = _mm_set1_ps(maximum);
+			for (; index + 4 <= count; index += 4)
+			{
+				_mm_storeu_ps(target + index, _mm_min_ps(maximums, _mm_max_ps(minimums, _mm_loadu_ps(target + index))));
+			}
+#endif
+			for (; index < count; ++index)
+			{
+				const float raised = (minimum > target[index]) ? minimum : target[index];
+				target[index] = (maximum < raised) ? maximum : raised;
+			}
+		}
+
+		void LerpFloats(float* target, const float* other, const float weight, const size_t count)
+		{
+			size_t index = 0;
+#ifdef DATUM_MATH_X64
+			if (HasAvx2())
+			{
+				index = LerpAvx2(target, other, weight, count);
+			}
+
+			const __m128 weights = _mm_set1_ps(weight);
+			for (; index + 4 <= count; index += 4)
+			{
+				const __m128 from = _mm_loadu_ps(target + index);
+				const __m128 step = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(other + index), from), weights);
+				_mm_storeu_ps(target + index, _mm_add_ps(from, step));
+			}
+#endif
+			for (; index < count; ++index)
+			{
+				const float step = (other[index] - target[index]) * weight;
+				target[index] += step;
+			}
+		}
+
+		void AddIntegers(int* target, const int* other, const size_t count)
+		{
+			size_t index = 0;
+#ifdef DATUM_MATH_X64
+			if (HasAvx2())
+			{
+				index = AddIntegersAvx2(target, other, count);
+			}
+
+			for (; index + 4 <= count; index += 4)
+			{
+				__m128i* destination = reinterpret_cast<__m128i*>(target + index);
+				const __m128i addends = _mm_loadu_si128(reinterpret_cast<const __m128i*>(other + index));
+				_mm_storeu_si128(destination, _mm_add_epi32(_mm_loadu_si128(destination), addends));
+			}
+#endif
+			for (; index < count; ++index)
+			{
+				target[index] += other[index];
+			}
+		}
+
+		void AddIntegerScalar(int* target, const int amount, const size_t count)
+		{
+			size_t index = 0;
+#ifdef DATUM_MATH_X64
+			if (HasAvx2())
+			{
+				index = AddIntegerScalarAvx2(target, amount, count);
+			}
+
+			const __m128i amounts = _mm_set1_epi32(amount);
+			for (; index + 4 <= count; index += 4)
+			{
+				__m128i* destination = reinterpret_cast<__m128i*>(target + index);
+				_mm_storeu_si128(destination, _mm_add_epi32(_mm_loadu_si128(destination), amounts));
+			}
+#endif
+			for (; index < count; ++index)
+			{
+				target[index] += amount;
+			}
+		}
+
+		void ClampIntegers(int* target, const int minimum, const int maximum, const size_t count)
+		{
+			size_t index = 0;
+#ifdef DATUM_MATH_X64
+			if (HasAvx2())
+			{
+				index = ClampIntegersAvx2(target, minimum, maximum, count);
+			}
+
+			// SSE2 has no 32 bit min or max, so the limits are blended in through compare masks
+			const __m128i minimums = _mm_set1_epi32(minimum);
+			const __m128i maximums = _mm_set1_epi32(maximum);
+			for (; index + 4 <= count; index += 4)
+			{
+				__m128i* destination = reinterpret_cast<__m128i*>(target + index);
+				__m128i values = _mm_loadu_si128(destination);
+				const __m128i below = _mm_cmplt_epi32(values, minimums);
+				values = _mm_or_si128(_mm_and_si128(below, minimums), _mm_andnot_si128(below, values));
+				const __m128i above = _mm_cmpgt_epi32(values, maximums);
+				values = _mm_or_si128(_mm_and_si128(above, maximums), _mm_andnot_si128(above, values));
+				_mm_storeu_si128(destination, values);
+			}
+#endif
+			for (; index < count; ++index)
+			{
+				target[index] = std::min(std::max(target[index], minimum), maximum);
+			}
+		}
+
+#pragma endregion Kernels
+	}
+
+	void DatumMath::Add(Datum& target, const Datum& other)
+	{
+		ValidatePair(target, other);
+		if (target.Type() == Datum::DatumTypes::Integer)
+		{
+			const std::span<const int> addends = other.AsSpan<int>();
+			AddIntegers(WritableIntegers(target).data(), addends.data(), addends.size());
+			return;
+		}
+
+		const std::span<const float> addends = ReadableFloats(other);
+		AddFloats(WritableFloats(target).data(), addends.data(), addends.size());
+	}
+
+	void DatumMath::Add(Datum& target, const float amount)
+	{
+		const std::span<float> floats = WritableFloats(target);
+		AddScalar(floats.data(), amount, floats.size());
+	}
+
+	void DatumMath::Add(Datum& target, const int amount)
+	{
+		if (target.Type() != Datum::DatumTypes::Integer)
+		{
+			Add(target, static_cast<float>(amount));
+			return;
+		}
+
+		const std::span<int> integers = WritableIntegers(target);
+		AddIntegerScalar(integers.data(), amount, integers.size());
+	}
+
+	void DatumMath::Scale(Datum& target, const float factor)
+	{
+		const std::span<float> floats = WritableFloats(target);
+		ScaleFloats(floats.data(), factor, floats.size());
+	}
+
+	void DatumMath::MultiplyAdd(Datum& target, const Datum& other, const float factor)
+	{
+		ValidatePair(target, other);
+		const std::span<const float> addends = ReadableFloats(other);
+		MultiplyAddFloats(WritableFloats(target).data(), addends.data(), factor, addends.size());
+	}
+
+	void DatumMath::Clamp(Datum& target, const float minimum, const float maximum)
+	{
+		ValidateRange(minimum <= maximum);
+		const std::span<float> floats = WritableFloats(target);
+		ClampFloats(floats.data(), minimum, maximum, floats.size());
+	}
+
+	void DatumMath::Clamp(Datum& target, const int minimum, const int maximum)
+	{
+		ValidateRange(minimum <= maximum);
+		if (target.Type() != Datum::DatumTypes::Integer)
+		{
+			Clamp(target, static_cast<float>(minimum), static_cast<float>(maximum));
+			return;
+		}
+
+		const std::span<int> integers = WritableIntegers(target);
+		ClampIntegers(integers.data(), minimum, maximum, integers.size());
+	}
+
+	void DatumMath::Lerp(Datum& target, const Datum& other, const float weight)
+	{
+		ValidatePair(target, other);
+		const std::span<const float> destinations = ReadableFloats(other);
+		LerpFloats(WritableFloats(target).data(), destinations.data(), weight, destinations.size());
+	}
+
+	bool DatumMath::UsesAvx2()
+	{
+		return HasAvx2();
+	}
+
+	std::span<float> DatumMath::WritableFloats(Datum& target)
+	{
+		size_t count;
+		switch (target.type)
+		{
+		case Datum::DatumTypes::Float:
+			count = target.size;
+			break;
+		case Datum::DatumTypes::Vector:
+			count = target.size * 4_z;
+			break;
+		default:
+			throw std::runtime_error("The Datum type is incorrect.");
+		}
+
+		target.Detach();
+		return std::span<float>(target.data.f, count);
+	}
+
+	std::span<int> DatumMath::WritableIntegers(Datum& target)
+	{
+		if (target.type != Datum::DatumTypes::Integer)
+		{
+			throw std::runtime_error("The Datum type is incorrect.");
+		}
+
+		target.Detach();
+		return std::span<int>(target.data.i, target.size);
+	}
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Datum.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Bulk arithmetic applied to every element of a numeric datum in one call
+	/// Float and Vector datums are processed as one flat array of floats, so a vector's four components are treated alike
+	/// Uses AVX2 when the processor supports it, SSE2 on every other x64 processor and plain loops elsewhere
+	/// </summary>
+	/// <remarks>
+	/// Every operation writes in place, copying a shared array first. External datums are written straight into their storage.
+	/// Operations between two datums require both to hold the same type and size
+	/// </remarks>
+	class DatumMath final
+	{
+	public:
+		/// <summary>
+		/// Deleted default constructor, only static methods live here
+		/// </summary>
+		DatumMath() = delete;
+
+		/// <summary>
+		/// Adds every element of another datum to the element at the same index
+		/// </summary>
+		/// <param name="target"> The Integer, Float or Vector datum to write </param>
+		/// <param name="other"> The datum to add, of the same type and size </param>
+		/// <exception cref="std::runtime_error"> If the types aren't supported or don't match, or the sizes differ </exception>
+		static void Add(Datum& target, const Datum& other);
+
+		/// <summary>
+		/// Adds an amount to every element, or every component of a vector
+		/// </summary>
+		/// <param name="target"> The Float or Vector datum to write </param>
+		/// <param name="amount"> The amount to add </param>
+		/// <exception cref="std::runtime_error"> If the datum isn't of type Float or Vector </exception>
+		static void Add(Datum& target, const float amount);
+
+		/// <summary>
+		/// Adds an amount to every element, or every component of a vector
+		/// </summary>
+		/// <param name="target"> The Integer, Float or Vector datum to write </param>
+		/// <param name="amount"> The amount to add </param>
+		/// <remarks> Float and Vector datums add the amount as a float </remarks>
+		/// <exception cref="std::runtime_error"> If the datum isn't of type Integer, Float or Vector </exception>
+		static void Add(Datum& target, const int amount);
+
+		/// <summary>
+		/// Multiplies every element, or every component of a vector, by a factor
+		/// </summary>
+		/// <param name="target"> The Float or Vector datum to write </param>
+		/// <param name="factor"> The factor to multiply by </param>
+		/// <exception cref="std::runtime_error"> If the datum isn't of type Float or Vector </exception>
+		static void Scale(Datum& target, const float factor);
+
+		/// <summary>
+		/// Adds every element of another datum, multiplied by a factor, to the element at the same index
+		/// </summary>
+		/// <param name="target"> The Float or Vector datum to write, like positions </param>
+		/// <param name="other"> The datum to add, like velocities, of the same type and size </param>
+		/// <param name="factor"> The factor to multiply the other datum's elements by, like the frame's delta time </param>
+		/// <exception cref="std::runtime_error"> If the types aren't supported or don't match, or the sizes differ </exception>
+		static void MultiplyAdd(Datum& target, const Datum& other, const float factor);
+
+		/// <summary>
+		/// Limits every element, or every component of a vector, to a range
+		/// </summary>
+		/// <param name="target"> The Float or Vector datum to write </param>
+		/// <param name="minimum"> The smallest value to keep </param>
+		/// <param name="maximum"> The largest value to keep </param>
+		/// <remarks> NaN elements are left as NaN </remarks>
+		/// <exception cref="std::invalid_argument"> If the minimum is greater than the maximum </exception>
+		/// <exception cref="std::runtime_error"> If the datum isn't of type Float or Vector </exception>
+		static void Clamp(Datum& target, const float minimum, const float maximum);
+
+		/// <summary>
+		/// Limits every element, or every component of a vector, to a range
+		/// </summary>
+		/// <param name="target"> The Integer, Float or Vector datum to write </param>
+		/// <param name="minimum"> The smallest value to keep </param>
+		/// <param name="maximum"> The largest value to keep </param>
+		/// <remarks> Float and Vector datums clamp to the range as floats, leaving NaN elements as NaN </remarks>
+		/// <exception cref="std::invalid_argument"> If the minimum is greater than the maximum </exception>
+		/// <exception cref="std::runtime_error"> If the datum isn't of type Integer, Float or Vector </exception>
+		static void Clamp(Datum& target, const int minimum, const int maximum);
+
+		/// <summary>
+		/// Moves every element towards the element at the same index of another datum
+		/// </summary>
+		/// <param name="target"> The Float or Vector datum to write </param>
+		/// <param name="other"> The datum to move towards, of the same type and size </param>
+		/// <param name="weight"> How far to move, zero keeps the target and one copies the other datum </param>
+		/// <exception cref="std::runtime_error"> If the types aren't supported or don't match, or the sizes differ </exception>
+		static void Lerp(Datum& target, const Datum& other, const float weight);
+
+		/// <summary>
+		/// Queries whether the AVX2 paths are used on this processor
+		/// </summary>
+		/// <returns> True if the processor and operating system support AVX2 </returns>
+		static bool UsesAvx2();
+
+	private:
+		/// <summary>
+		/// Copies a shared array so it can be written, then views a Float or Vector datum as one array of floats
+		/// </summary>
+		/// <param name="target"> The datum about to be written </param>
+		/// <exception cref="std::runtime_error"> If the datum isn't of type Float or Vector </exception>
+		/// <returns> Every float of the datum </returns>
+		static std::span<float> WritableFloats(Datum& target);
+
+		/// <summary>
+		/// Copies a shared array so it can be written, then views an Integer datum
+		/// </summary>
+		/// <param name="target"> The datum about to be written </param>
+		/// <exception cref="std::runtime_error"> If the datum isn't of type Integer </exception>
+		/// <returns> Every integer of the datum </returns>
+		static std::span<int> WritableIntegers(Datum& target);
+	};
+}
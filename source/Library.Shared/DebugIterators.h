@@ -0,0 +1,15 @@
+#pragma once
+
+/// <summary>
+/// FIEA_DEBUG_ITERATORS controls whether container iterators validate their owner and position
+/// When on, dereferencing or stepping an orphaned or out of range iterator throws
+/// When off, iterators step and dereference without checks so loops inline like a raw pointer
+/// Defaults to on in debug builds and off when NDEBUG is defined; define it to 0 or 1 to override
+/// </summary>
+#ifndef FIEA_DEBUG_ITERATORS
+#if defined(_DEBUG) || !defined(NDEBUG)
+#define FIEA_DEBUG_ITERATORS 1
+#else
+#define FIEA_DEBUG_ITERATORS 0
+#endif
+#endif
@@ -13,12 +13,13 @@ namespace FieaGameEngine
 	};
 
 	/// <summary>
-	/// Determines the hash value for the parameter data 
+	/// Determines the hash value for the parameter data
 	/// </summary>
 	/// <param name="data"> The actual stored address of the passed in value </param>
 	/// <param name="size"> The amount of bytes for the data </param>
+	/// <remarks> Reads the data eight bytes at a time and folds it with 64x64->128 bit multiplies (wyhash) </remarks>
 	/// <returns> Hash value determined </returns>
-	size_t AdditiveHash(const std::uint8_t* data, const size_t size);
+	size_t HashBytes(const std::uint8_t* data, const size_t size);
 };
 
 #include "DefaultHash.inl"
\ No newline at end of file
@@ -1,23 +1,120 @@
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
 namespace FieaGameEngine
 {
-	const size_t hash_prime = 33;
+	inline constexpr std::uint64_t hash_secrets[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+	/// <summary>
+	/// Multiplies two 64 bit values into 128 bits, leaving the low half in lhs and the high half in rhs
+	/// </summary>
+	inline void HashMultiply(std::uint64_t& lhs, std::uint64_t& rhs)
+	{
+#if defined(__SIZEOF_INT128__)
+		const __uint128_t product = static_cast<__uint128_t>(lhs) * rhs;
+		lhs = static_cast<std::uint64_t>(product);
+		rhs = static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+		lhs = _umul128(lhs, rhs, &rhs);
+#else
+		const std::uint64_t lhs_high = lhs >> 32, lhs_low = static_cast<std::uint32_t>(lhs);
+		const std::uint64_t rhs_high = rhs >> 32, rhs_low = static_cast<std::uint32_t>(rhs);
+		const std::uint64_t high_high = lhs_high * rhs_high, high_low = lhs_high * rhs_low;
+		const std::uint64_t low_high = lhs_low * rhs_high, low_low = lhs_low * rhs_low;
+		const std::uint64_t middle = (low_low >> 32) + static_cast<std::uint32_t>(high_low) + static_cast<std::uint32_t>(low_high);
+		lhs = (middle << 32) | static_cast<std::uint32_t>(low_low);
+		rhs = high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+#endif
+	}
+
+	/// <summary>
+	/// Folds the 128 bit product of two values back into 64 bits
+	/// </summary>
+	inline std::uint64_t HashMix(std::uint64_t lhs, std::uint64_t rhs)
+	{
+		HashMultiply(lhs, rhs);
+		return lhs ^ rhs;
+	}
+
+	inline std::uint64_t HashRead8(const std::uint8_t* data)
+	{
+		std::uint64_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	inline std::uint64_t HashRead4(const std::uint8_t* data)
+	{
+		std::uint32_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
 
-	inline size_t AdditiveHash(const std::uint8_t* data, const size_t size)
+	inline size_t HashBytes(const std::uint8_t* data, const size_t size)
 	{
-		size_t hash = 0;
-		for (size_t index = 0; index < size; ++index)
+		std::uint64_t seed = HashMix(hash_secrets[0], hash_secrets[1]);
+		std::uint64_t a = 0;
+		std::uint64_t b = 0;
+
+		if (size <= 16)
 		{
-			hash += hash_prime * data[index];
+			// Short keys (most attribute names) are covered by two overlapping pairs of 4 byte reads
+			if (size >= 4)
+			{
+				const size_t offset = (size >> 3) << 2;
+				a = (HashRead4(data) << 32) | HashRead4(data + offset);
+				b = (HashRead4(data + size - 4) << 32) | HashRead4(data + size - 4 - offset);
+			}
+			else if (size > 0)
+			{
+				a = (static_cast<std::uint64_t>(data[0]) << 16) | (static_cast<std::uint64_t>(data[size >> 1]) << 8) | data[size - 1];
+			}
 		}
+		else
+		{
+			size_t remaining = size;
+			if (remaining > 48)
+			{
+				std::uint64_t first_lane = seed;
+				std::uint64_t second_lane = seed;
+				do
+				{
+					seed = HashMix(HashRead8(data) ^ hash_secrets[1], HashRead8(data + 8) ^ seed);
+					first_lane = HashMix(HashRead8(data + 16) ^ hash_secrets[2], HashRead8(data + 24) ^ first_lane);
+					second_lane = HashMix(HashRead8(data + 32) ^ hash_secrets[3], HashRead8(data + 40) ^ second_lane);
+					data += 48;
+					remaining -= 48;
+				} while (remaining > 48);
+
+				seed ^= first_lane ^ second_lane;
+			}
+
+			while (remaining > 16)
+			{
+				seed = HashMix(HashRead8(data) ^ hash_secrets[1], HashRead8(data + 8) ^ seed);
+				data += 16;
+				remaining -= 16;
+			}
 
-		return hash;
+			a = HashRead8(data + remaining - 16);
+			b = HashRead8(data + remaining - 8);
+		}
+
+		a ^= hash_secrets[1];
+		b ^= seed;
+		HashMultiply(a, b);
+
+		return static_cast<size_t>(HashMix(a ^ hash_secrets[0] ^ size, b ^ hash_secrets[1]));
 	}
 
 	template <typename T>
 	inline size_t DefaultHash<T>::operator()(const T& key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(&key);		
-		return AdditiveHash(data, sizeof(T));
+		return HashBytes(data, sizeof(T));
 	}
 
 	template <>
@@ -26,7 +123,7 @@ namespace FieaGameEngine
 		inline size_t operator()(char* key) const
 		{	
 			const std::uint8_t* data = reinterpret_cast<std::uint8_t*>(key);
-			return AdditiveHash(data, strlen(key));
+			return HashBytes(data, strlen(key));
 		}
 	};
 
@@ -36,7 +133,7 @@ namespace FieaGameEngine
 		inline size_t operator()(const char* key) const
 		{
 			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-			return AdditiveHash(data, strlen(key));
+			return HashBytes(data, strlen(key));
 		}
 	};
 
@@ -46,7 +143,7 @@ namespace FieaGameEngine
 		inline size_t operator()(char* const key) const
 		{
 			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-			return AdditiveHash(data, strlen(key));
+			return HashBytes(data, strlen(key));
 		}
 	};
 
@@ -56,7 +153,7 @@ namespace FieaGameEngine
 		inline size_t operator()(const char* const key) const
 		{
 			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-			return AdditiveHash(data, strlen(key));
+			return HashBytes(data, strlen(key));
 		}
 	};
 
@@ -66,7 +163,7 @@ namespace FieaGameEngine
 		inline size_t operator()(const std::string& key) const
 		{
 			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-			return AdditiveHash(data, key.length());
+			return HashBytes(data, key.length());
 		}
 	};
 
@@ -76,7 +173,25 @@ namespace FieaGameEngine
 		inline size_t operator()(const std::wstring& key) const
 		{
 			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-			return AdditiveHash(data, key.length());
+			return HashBytes(data, key.length() * sizeof(wchar_t));
+		}
+	};
+
+	template <>
+	struct DefaultHash<const std::string>
+	{
+		inline size_t operator()(const std::string& key) const
+		{
+			return DefaultHash<std::string>{}(key);
+		}
+	};
+
+	template <>
+	struct DefaultHash<const std::wstring>
+	{
+		inline size_t operator()(const std::wstring& key) const
+		{
+			return DefaultHash<std::wstring>{}(key);
 		}
 	};
 
@@ -85,7 +200,7 @@ namespace FieaGameEngine
 	{
 		inline size_t operator()(const int key) const
 		{
-			return static_cast<size_t>(key);
+			return static_cast<size_t>(HashMix(static_cast<std::uint64_t>(key) ^ hash_secrets[0], hash_secrets[1]));
 		}
 	};
 }
\ No newline at end of file
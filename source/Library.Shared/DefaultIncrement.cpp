@@ -3,8 +3,8 @@
 
 namespace FieaGameEngine
 {
-	size_t DefaultIncrement::operator()(size_t /*size*/, std::size_t capacity) const
+	size_t DefaultIncrement::operator()(size_t size, std::size_t capacity) const
 	{
-		return capacity + 1;
+		return GeometricIncrement<3, 2, 4>{}(size, capacity);
 	}
-}
\ No newline at end of file
+}
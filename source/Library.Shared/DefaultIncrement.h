@@ -1,9 +1,34 @@
 #pragma once
 
+#include <cstddef>
+
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// Grows a container's capacity by a constant factor of Numerator / Denominator, but never by less than MinimumChunk
+	/// </summary>
+	/// <remarks> Geometric growth keeps the amortized cost of a push constant, since every element is copied O(1) times on average </remarks>
+	template <std::size_t Numerator, std::size_t Denominator, std::size_t MinimumChunk>
+	struct GeometricIncrement final
+	{
+		static_assert(Denominator > 0 && Numerator > Denominator, "The growth factor must be greater than one.");
+
+		/// <summary>
+		/// Determines how many elements a full container should grow by
+		/// </summary>
+		/// <param name="size"> The current amount of elements in the container </param>
+		/// <param name="capacity"> The current amount of elements the container has room for </param>
+		/// <returns> The amount of elements to add onto the capacity </returns>
+		size_t operator()(size_t size, std::size_t capacity) const;
+	};
+
+	/// <summary>
+	/// The growth strategy Vector and Datum use unless told otherwise: 1.5x the capacity, at least four elements at a time
+	/// </summary>
 	struct DefaultIncrement final
 	{
 		size_t operator()(size_t size, std::size_t capacity) const;
 	};
-}
\ No newline at end of file
+}
+
+#include "DefaultIncrement.inl"
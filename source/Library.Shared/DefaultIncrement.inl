@@ -0,0 +1,12 @@
+#include "pch.h"
+#include "DefaultIncrement.h"
+#include <algorithm>
+
+namespace FieaGameEngine
+{
+	template <std::size_t Numerator, std::size_t Denominator, std::size_t MinimumChunk>
+	inline size_t GeometricIncrement<Numerator, Denominator, MinimumChunk>::operator()(size_t /*size*/, std::size_t capacity) const
+	{
+		return std::max(MinimumChunk, capacity * (Numerator - Denominator) / Denominator);
+	}
+}
@@ -64,11 +64,11 @@ namespace FieaGameEngine
 
 	Datum& Entity::Children()
 	{
-		return order.at(children_identifier)->second;
+		return entries.at(children_identifier).second;
 	}
 
 	Datum& Entity::Actions()
 	{
-		return order.at(actions_identifier)->second;
+		return entries.at(actions_identifier).second;
 	}
 }
\ No newline at end of file
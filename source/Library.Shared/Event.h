@@ -146,7 +146,7 @@ namespace FieaGameEngine
 		{
 			std::shared_ptr<EventPublisher> event_publisher;
 			std::chrono::high_resolution_clock::time_point enqueue_time;
-			std::chrono::milliseconds delay;
+			std::chrono::milliseconds delay{ 0 };
 
 			bool IsExpired(std::chrono::high_resolution_clock::time_point current) const;
 		};
@@ -8,8 +8,8 @@ namespace FieaGameEngine
 
 	EventMessageAttributed::EventMessageAttributed(WorldState& new_world_state, const std::string& new_subtype) :
 		Attributed::Attributed(EventMessageAttributed::TypeIdClass()), 
-		world_state(new_world_state),
-		subtype(new_subtype)
+		subtype(new_subtype),
+		world_state(new_world_state)
 	{
 	}
 }
\ No newline at end of file
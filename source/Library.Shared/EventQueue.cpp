@@ -7,17 +7,14 @@ namespace FieaGameEngine
 	void EventQueue::Enqueue(std::shared_ptr<EventPublisher> publisher, GameTime& game_time, std::chrono::milliseconds delay)
 	{
 		QueueEntry entry{ std::move(publisher), game_time.CurrentTime(), delay };
-		buffer.PushBack(entry);
+		buffer.PushBack(std::move(entry));
 	}
 
 	void EventQueue::Update(const GameTime& game_time)
 	{
-		for (QueueEntry& entry : buffer)
-		{
-			events.PushBack(entry);
-		}
+		events.Append(std::move(buffer));
 
-		auto it_partition = std::partition(events.begin(), events.end(), [current = game_time.CurrentTime()](QueueEntry entry)
+		auto it_partition = std::partition(events.begin(), events.end(), [current = game_time.CurrentTime()](const QueueEntry& entry)
 		{return !entry.IsExpired(current); });
 
 		for (auto it = it_partition; it != events.end(); ++it)
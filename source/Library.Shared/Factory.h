@@ -44,7 +44,7 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="factory_name"> The factory name to search for </param>
 		/// <returns> A pointer to the factory found, or nullptr if not found </returns>
-		static const Factory* const Find(const std::string& factory_name);
+		static const Factory* Find(const std::string& factory_name);
 		
 		/// <summary>
 		/// Queries the size of the map
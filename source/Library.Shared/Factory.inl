@@ -14,7 +14,7 @@ namespace FieaGameEngine
 	}
 
 	template <typename T>
-	inline const Factory<T>* const Factory<T>::Find(const std::string& factory_name)
+	inline const Factory<T>* Factory<T>::Find(const std::string& factory_name)
 	{
 		auto it = factories.Find(factory_name);
 		return it != factories.end() ? it->second : nullptr;
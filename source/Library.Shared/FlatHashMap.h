@@ -0,0 +1,481 @@
+#pragma once
+
+#include "DefaultHash.h"
+#include "DefaultEquality.h"
+#include "SizeLiteral.h"
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// An open-addressing hashmap with the same interface as HashMap
+	/// Pairs live inline in a single slot array, and every slot has a one byte control value (empty, deleted, or 7 bits of the hash)
+	/// Lookups compare a whole group of control bytes at once (SSE2 when available) before touching any pair
+	/// </summary>
+	/// <remarks> Pairs are relocated when the map grows, so references and pointers to pairs do not survive an insert </remarks>
+	template <typename TKey, typename TValue, typename HashFunctor = DefaultHash<TKey>, typename EqualityFunctor = DefaultEquality<TKey>>
+	class FlatHashMap
+	{
+	public:
+		using PairType = std::pair<const TKey, TValue>;
+		using value_type = PairType;
+
+		class Iterator final
+		{
+			friend FlatHashMap;
+			friend class ConstIterator;
+
+		public:
+			/// <summary>
+			/// The default constructor with no owner
+			/// </summary>
+			Iterator() = default;
+
+			/// <summary>
+			/// The default copy constructor which creates a new Iterator based on the existing other Iterator
+			/// </summary>
+			/// <param name="other"> The original Iterator to copy </param>
+			Iterator(const Iterator& other) = default;
+
+			/// <summary>
+			/// The default copy constructor which creates a new Iterator based on the existing other Iterator
+			/// </summary>
+			/// <param name="other"> The original Iterator to copy </param>
+			/// <remarks> Copy constructor uses r-values instead of l-values </remarks>
+			Iterator(Iterator&& other) noexcept = default;
+
+			/// <summary>
+			/// The default equality for Iterators
+			/// </summary>
+			/// <param name = "other"> The Iterator to equate this Iterator to </param>
+			/// <returns> The lhs Iterator (this) after equalizing them </returns>
+			Iterator& operator=(const Iterator& other) = default;
+
+			/// <summary>
+			/// The default equality for Iterators
+			/// </summary>
+			/// <param name = "other"> The Iterator to equate this Iterator to </param>
+			/// <remarks> Equality operator uses r-values instead of l-values </remarks>
+			/// <returns> The lhs Iterator (this) after equalizing them </returns>
+			Iterator& operator=(Iterator&& other) noexcept = default;
+
+			/// <summary>
+			/// The default destructor, destroying the Iterator
+			/// </summary>
+			~Iterator() = default;
+
+			/// <summary>
+			/// Determines if two Iterator's are the same (owner and slot index)
+			/// </summary>
+			/// <param name = "other"> The Iterator to compare this too </param>
+			/// <remarks> Used less frequently, call the inverse of the != operator </remarks>
+			/// <returns> A boolean to indicate if two Iterator are equivalent </returns>
+			bool operator==(const Iterator& other) const;
+
+			/// <summary>
+			/// Determines if two Iterator's are not the same (owner and slot index)
+			/// </summary>
+			/// <param name = "other"> The Iterator to compare this too </param>
+			/// <returns> A boolean to indicate if two Iterators are not the same </returns>
+			bool operator!=(const Iterator& other) const;
+
+			/// <summary>
+			/// Increments an Iterator by moving it to the next occupied slot
+			/// </summary>
+			/// <remarks> Specifically handles the prefix increment case </remarks>
+			/// <exception cref="std::runtime_error"> If the owner is null </exception>
+			/// <returns> The altered Iterator </returns>
+			Iterator& operator++();
+
+			/// <summary>
+			/// Increments an Iterator by moving it to the next occupied slot
+			/// </summary>
+			/// <remarks> Specifically handles the postfix increment case </remarks>
+			/// <remarks> Fake parameter to this operator, it doesn't exist. Must be an int </remarks>
+			/// <returns> A copy of the old Iterator </returns>
+			Iterator operator++(int);
+
+			/// <summary>
+			/// The overloaded dereference operator which retrieves the pair in the Iterator's slot
+			/// </summary>
+			/// <exception cref="std::runtime_error"> If the owner is null or the Iterator is end() </exception>
+			/// <returns> The pair stored in the slot </returns>
+			PairType& operator*() const;
+
+			/// <summary>
+			/// The overloaded dereference operator which retrieves the pair in the Iterator's slot
+			/// </summary>
+			/// <exception cref="std::runtime_error"> If the owner is null or the Iterator is end() </exception>
+			/// <returns> A pointer to the pair stored in the slot </returns>
+			PairType* operator->() const;
+
+		private:
+			/// <summary>
+			/// Private constructor that's used to assign maps and slot indexes from only within the FlatHashMap class
+			/// <param name = "owner"> The FlatHashMap that will own this Iterator </param>
+			/// <param name = "new_index"> The slot this Iterator refers to </param>
+			/// </summary>
+			Iterator(FlatHashMap& owner, const size_t new_index);
+
+			FlatHashMap* owner = nullptr;
+			size_t index = 0_z;
+		};
+
+		class ConstIterator final
+		{
+			friend FlatHashMap;
+
+		public:
+			/// <summary>
+			/// The default constructor with no owner
+			/// </summary>
+			ConstIterator() = default;
+
+			/// <summary>
+			/// A copy constructor which creates a ConstIterator based on an ITERATOR
+			/// </summary>
+			/// <param name="other"> The original Iterator to copy into a ConstIterator </param>
+			ConstIterator(const Iterator& other);
+
+			/// <summary>
+			/// The default copy constructor which creates a new ConstIterator based on the existing other ConstIterator
+			/// </summary>
+			/// <param name="other"> The original ConstIterator to copy </param>
+			ConstIterator(const ConstIterator& other) = default;
+
+			/// <summary>
+			/// The default copy constructor which creates a new ConstIterator based on the existing other ConstIterator
+			/// </summary>
+			/// <param name="other"> The original ConstIterator to copy </param>
+			/// <remarks> Copy constructor uses r-values instead of l-values </remarks>
+			ConstIterator(ConstIterator&& other) noexcept = default;
+
+			/// <summary>
+			/// The default equality for ConstIterators
+			/// </summary>
+			/// <param name = "other"> The ConstIterator to equate this ConstIterator to </param>
+			/// <returns> The lhs ConstIterator (this) after equalizing them </returns>
+			ConstIterator& operator=(const ConstIterator& other) = default;
+
+			/// <summary>
+			/// The default equality for ConstIterators
+			/// </summary>
+			/// <param name = "other"> The ConstIterator to equate this ConstIterator to </param>
+			/// <remarks> Equality operator uses r-values instead of l-values </remarks>
+			/// <returns> The lhs ConstIterator (this) after equalizing them </returns>
+			ConstIterator& operator=(ConstIterator&& other) noexcept = default;
+
+			/// <summary>
+			/// The default destructor, destroying the ConstIterator
+			/// </summary>
+			~ConstIterator() = default;
+
+			/// <summary>
+			/// Determines if two ConstIterator's are the same (owner and slot index)
+			/// </summary>
+			/// <param name = "other"> The ConstIterator to compare this too </param>
+			/// <remarks> Used less frequently, call the inverse of the != operator </remarks>
+			/// <returns> A boolean to indicate if two ConstIterator's are equivalent </returns>
+			bool operator==(const ConstIterator& other) const;
+
+			/// <summary>
+			/// Determines if two ConstIterator's are not the same (owner and slot index)
+			/// </summary>
+			/// <param name = "other"> The ConstIterator to compare this too </param>
+			/// <returns> A boolean to indicate if two ConstIterator's are not the same </returns>
+			bool operator!=(const ConstIterator& other) const;
+
+			/// <summary>
+			/// Increments a ConstIterator by moving it to the next occupied slot
+			/// </summary>
+			/// <remarks> Specifically handles the prefix increment case </remarks>
+			/// <exception cref="std::runtime_error"> If the owner is null </exception>
+			/// <returns> The altered ConstIterator </returns>
+			ConstIterator& operator++();
+
+			/// <summary>
+			/// Increments a ConstIterator by moving it to the next occupied slot
+			/// </summary>
+			/// <remarks> Specifically handles the postfix increment case </remarks>
+			/// <remarks> Fake parameter to this operator, it doesn't exist. Must be an int </remarks>
+			/// <returns> A copy of the old ConstIterator </returns>
+			ConstIterator operator++(int);
+
+			/// <summary>
+			/// The overloaded dereference operator which retrieves the pair in the ConstIterator's slot
+			/// </summary>
+			/// <exception cref="std::runtime_error"> If the owner is null or the ConstIterator is end() </exception>
+			/// <returns> The pair stored in the slot </returns>
+			const PairType& operator*() const;
+
+			/// <summary>
+			/// The overloaded dereference operator which retrieves the pair in the ConstIterator's slot
+			/// </summary>
+			/// <exception cref="std::runtime_error"> If the owner is null or the ConstIterator is end() </exception>
+			/// <returns> A pointer to the pair stored in the slot </returns>
+			const PairType* operator->() const;
+
+		private:
+			/// <summary>
+			/// Private constructor that's used to assign maps and slot indexes from only within the FlatHashMap class
+			/// <param name = "owner"> The FlatHashMap that will own this ConstIterator </param>
+			/// <param name = "new_index"> The slot this ConstIterator refers to </param>
+			/// </summary>
+			ConstIterator(const FlatHashMap& owner, const size_t new_index);
+
+			const FlatHashMap* owner = nullptr;
+			size_t index = 0_z;
+		};
+
+		/// <summary>
+		/// Constructor for object initialization
+		/// <param name = "slot_count"> The amount of slots to initially allocate </param>
+		/// </summary>
+		/// <remarks> The slot count is rounded up to a power of two of at least one group </remarks>
+		/// <exception cref="std::invalid_argument"> If the slot count is 0 </exception>
+		explicit FlatHashMap(const size_t slot_count = 16_z);
+
+		/// <summary>
+		/// Copy constructor which creates a new map based on the existing other map
+		/// </summary>
+		/// <param name="other"> The original map to copy </param>
+		FlatHashMap(const FlatHashMap& other);
+
+		/// <summary>
+		/// Copy constructor which creates a new map based on the existing other map
+		/// </summary>
+		/// <param name="other"> The original map to copy </param>
+		/// <remarks> Copy constructor uses rvalues instead of lvalues </remarks>
+		FlatHashMap(FlatHashMap&& other) noexcept;
+
+		/// <summary>
+		/// Default equality operator for maps
+		/// </summary>
+		/// <param name = "other"> The map to equate this map to </param>
+		/// <returns> The lhs map (this) after equalizing them </returns>
+		FlatHashMap& operator=(const FlatHashMap& other);
+
+		/// <summary>
+		/// Default equality operator for maps
+		/// </summary>
+		/// <param name = "other"> The map to equate this map to </param>
+		/// <remarks> Equality operator uses rvalues instead of lvalues </remarks>
+		/// <returns> The lhs map (this) after equalizing them </returns>
+		FlatHashMap& operator=(FlatHashMap&& other) noexcept;
+
+		/// <summary>
+		/// Destructor, destroys every pair and frees the slots
+		/// </summary>
+		~FlatHashMap();
+
+		/// <summary>
+		/// Finds the value associated with the key
+		/// </summary>
+		/// <param name="key"> The key associated with the pair that could be in the map </param>
+		/// <remarks> The returned Iterator will be end() if the key isn't found </remarks>
+		/// <returns> An Iterator referring to the slot of the pair </returns>
+		Iterator Find(const TKey& key);
+
+		/// <summary>
+		/// Finds the value associated with the key
+		/// </summary>
+		/// <param name="key"> The key associated with the pair that could be in the map </param>
+		/// <remarks> The returned ConstIterator will be end() if the key isn't found </remarks>
+		/// <returns> A ConstIterator referring to the slot of the pair </returns>
+		ConstIterator Find(const TKey& key) const;
+
+		/// <summary>
+		/// Adds a new element to the map if the pair is not found
+		/// </summary>
+		/// <param name="pair"> The pair to insert </param>
+		/// <returns> A tuple with a bool indicating whether or not the key was inserted, and an
+		///  iterator that refers to the pair with this key </returns>
+		std::tuple<bool, Iterator> Insert(const PairType& pair);
+
+		/// <summary>
+		/// Adds a new element to the map if the pair is not found
+		/// </summary>
+		/// <param name="pair"> The pair to insert </param>
+		/// <remarks> Explicitly uses r-values instead of l-values </remarks>
+		/// <returns> A tuple with a bool indicating whether or not the key was inserted, and an
+		///  iterator that refers to the pair with this key </returns>
+		std::tuple<bool, Iterator> Insert(PairType&& pair);
+
+		/// <summary>
+		/// Finds the value associated with the key
+		/// </summary>
+		/// <param name="key"> The key associated with the pair that could be in the map </param>
+		/// <returns> A TValue reference to the value found OR inserted (if the key is not found) </returns>
+		TValue& operator[](const TKey& key);
+
+		/// <summary>
+		/// Finds the value associated with the key
+		/// </summary>
+		/// <param name="key"> The key associated with the pair that could be in the map </param>
+		/// <remarks> Simply calls at() which calls Find </remarks>
+		/// <returns> A TValue reference to the value found </returns>
+		TValue& operator[](const TKey& key) const;
+
+		/// <summary>
+		/// Removes a data member in the map given some key, and does nothing if it isn't found
+		/// </summary>
+		/// <param name="key"> The key to search for, and remove </param>
+		/// <remarks> Leaves a tombstone unless the slot's group still has an empty slot </remarks>
+		void Remove(const TKey& key);
+
+		/// <summary>
+		/// Resizes the map to hold the parameter's amount of slots and re-hashes every element into them
+		/// </summary>
+		/// <param name="new_size"> The new amount of slots </param>
+		/// <remarks> Ignores the max load factor, use Rehash to respect it. Never drops below the current size </remarks>
+		/// <exception cref="std::invalid_argument"> If the new size is 0 </exception>
+		void Resize(const size_t new_size);
+
+		/// <summary>
+		/// Re-hashes every element into at least the parameter's amount of slots
+		/// </summary>
+		/// <param name="slot_count"> The requested amount of slots </param>
+		/// <remarks> Grows the request if it would push the load factor past the max load factor. Clears out tombstones </remarks>
+		void Rehash(const size_t slot_count);
+
+		/// <summary>
+		/// Sets the amount of slots so that the parameter's amount of elements fit without a rehash
+		/// </summary>
+		/// <param name="element_count"> The amount of elements the map should hold </param>
+		/// <remarks> Never shrinks the amount of slots </remarks>
+		void Reserve(const size_t element_count);
+
+		/// <summary>
+		/// Queries the fraction of slots that hold a pair
+		/// </summary>
+		/// <returns> The size of the map divided by the amount of slots </returns>
+		float LoadFactor() const;
+
+		/// <summary>
+		/// Queries the load factor that triggers an automatic rehash on insert
+		/// </summary>
+		/// <returns> The max load factor of the map </returns>
+		float MaxLoadFactor() const;
+
+		/// <summary>
+		/// Sets the load factor that triggers an automatic rehash on insert
+		/// </summary>
+		/// <param name="new_max_load_factor"> The new max load factor </param>
+		/// <remarks> Rehashes immediately if the current load factor is already past the new max </remarks>
+		/// <exception cref="std::invalid_argument"> If the max load factor is not in (0, 1] </exception>
+		void SetMaxLoadFactor(const float new_max_load_factor);
+
+		/// <summary>
+		/// Removes all elements from the map, keeping its slots
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Queries the map and determines the amount of objects in the map
+		/// </summary>
+		/// <returns> Amount of elements in the map </returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// Queries the map and retrieves the number of slots that are allocated for the map
+		/// </summary>
+		/// <returns> Amount of slots allocated for the map </returns>
+		size_t BucketSize() const;
+
+		/// <summary>
+		/// Queries the map by calling find and comparing it to the end of the map
+		/// </summary>
+		/// <param name = "key"> The key to query </param>
+		/// <returns> A boolean indicating whether or not the key was found </returns>
+		bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// Queries the map and retrieves the data member at the parameter's key
+		/// </summary>
+		/// <param name = "key"> The key to query </param>
+		/// <exception cref="std::runtime_error"> If the key is not found </exception>
+		/// <returns> A mutable reference to the value of associated with the key </returns>
+		TValue& at(const TKey& key);
+
+		/// <summary>
+		/// Queries the map and retrieves the data member at the parameter's key
+		/// </summary>
+		/// <param name = "key"> The key to query </param>
+		/// <remarks> This is the const version of the other at method </remarks>
+		/// <returns> A mutable reference to the value of associated with the key </returns>
+		TValue& at(const TKey& key) const;
+
+		/// <summary>
+		/// Creates an Iterator from this map and the first element of the map
+		/// </summary>
+		/// <returns> An Iterator referencing to the front of the map </returns>
+		Iterator begin();
+
+		/// <summary>
+		/// Creates an Iterator from this map and PAST the last element of the map
+		/// </summary>
+		/// <returns> An Iterator referencing beyond the back/end of the map </returns>
+		Iterator end();
+
+		/// <summary>
+		/// Creates a ConstIterator from this map and the first element of the map
+		/// </summary>
+		/// <returns> A ConstIterator referencing to the front of the map </returns>
+		ConstIterator begin() const;
+
+		/// <summary>
+		/// Creates a ConstIterator from this map and the first element of the map
+		/// </summary>
+		/// <remarks> In a non-const map, you can still get a ConstIterator out of a mutable map </remarks>
+		/// <returns> A ConstIterator referencing to the front of the map </returns>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// Creates a ConstIterator from this map and PAST the last element of the map
+		/// </summary>
+		/// <returns> A ConstIterator referencing beyond the back/end of the map </returns>
+		ConstIterator end() const;
+
+		/// <summary>
+		/// Creates a ConstIterator from this map and PAST the last element of the map
+		/// </summary>
+		/// <remarks> In a non-const map, you can still get a ConstIterator out of a mutable map </remarks>
+		/// <returns> A ConstIterator referencing beyond the back/end of the map </returns>
+		ConstIterator cend() const;
+
+	private:
+		using ControlType = std::int8_t;
+		using MaskType = std::uint32_t;
+
+		inline static const ControlType empty_control = -128;
+		inline static const ControlType deleted_control = -2;
+		inline static const size_t group_width = 16_z;
+		inline static const float default_max_load_factor = 0.875f;
+
+		static size_t MixHash(const TKey& key);
+		static size_t NormalizeSlotCount(const size_t slot_count);
+		static MaskType MatchControl(const ControlType* group, const ControlType control);
+		static MaskType MatchEmpty(const ControlType* group);
+		static MaskType MatchEmptyOrDeleted(const ControlType* group);
+
+		size_t FindIndex(const TKey& key, const size_t hash) const;
+		size_t FindInsertIndex(const size_t hash) const;
+		size_t NextOccupied(size_t index) const;
+		template <typename Pair> std::tuple<bool, Iterator> Emplace(Pair&& pair);
+		bool GrowIfNeeded();
+		void Relocate(const size_t slot_count);
+		void Allocate(const size_t slot_count);
+		void Release();
+
+		PairType* slots = nullptr;
+		ControlType* controls = nullptr;
+		size_t capacity = 0_z;
+		size_t size = 0_z;
+		size_t deleted = 0_z;
+		float max_load_factor = default_max_load_factor;
+	};
+}
+
+#include "FlatHashMap.inl"
@@ -0,0 +1,720 @@
+#include "pch.h"
+#include "FlatHashMap.h"
+#include "SizeLiteral.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLAT_HASH_MAP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace FieaGameEngine
+{
+#pragma region Iterator
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::Iterator(FlatHashMap& owner, const size_t new_index) :
+		owner(&owner),
+		index(new_index)
+	{}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator==(const Iterator& other) const
+	{
+		return !(operator!=(other));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator!=(const Iterator& other) const
+	{
+		return ((owner != other.owner) || (index != other.index));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator&
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator++()
+	{
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
+		}
+
+		if (index < owner->capacity)
+		{
+			index = owner->NextOccupied(index + 1_z);
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator++(int)
+	{
+		Iterator temp(*this);
+		operator++();
+
+		return temp;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType&
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator*() const
+	{
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
+		}
+
+		if (index >= owner->capacity)
+		{
+			throw std::runtime_error("Index is out of range. Is this iterator == end()?");
+		}
+
+		return owner->slots[index];
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType*
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::ConstIterator(const FlatHashMap& owner, const size_t new_index) :
+		owner(&owner),
+		index(new_index)
+	{}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::ConstIterator(const Iterator& other) :
+		owner(other.owner),
+		index(other.index)
+	{}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator==(const ConstIterator& other) const
+	{
+		return !(operator!=(other));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator!=(const ConstIterator& other) const
+	{
+		return ((owner != other.owner) || (index != other.index));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator&
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator++()
+	{
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
+		}
+
+		if (index < owner->capacity)
+		{
+			index = owner->NextOccupied(index + 1_z);
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator++(int)
+	{
+		ConstIterator temp(*this);
+		operator++();
+
+		return temp;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline const typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType&
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator*() const
+	{
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
+		}
+
+		if (index >= owner->capacity)
+		{
+			throw std::runtime_error("Index is out of range. Is this iterator == end()?");
+		}
+
+		return owner->slots[index];
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline const typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType*
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+#pragma endregion ConstIterator
+
+#pragma region FlatHashMap
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::FlatHashMap(const size_t slot_count)
+	{
+		if (slot_count == 0_z)
+		{
+			throw std::invalid_argument("Do not create an empty FlatHashMap.");
+		}
+
+		Allocate(NormalizeSlotCount(slot_count));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::FlatHashMap(const FlatHashMap& other) :
+		max_load_factor(other.max_load_factor)
+	{
+		if (other.capacity != 0_z)
+		{
+			Allocate(other.capacity);
+			std::memcpy(controls, other.controls, capacity);
+
+			for (size_t index = other.NextOccupied(0_z); index < capacity; index = other.NextOccupied(index + 1_z))
+			{
+				new(slots + index) PairType(other.slots[index]);
+			}
+
+			size = other.size;
+			deleted = other.deleted;
+		}
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::FlatHashMap(FlatHashMap&& other) noexcept :
+		slots(other.slots),
+		controls(other.controls),
+		capacity(other.capacity),
+		size(other.size),
+		deleted(other.deleted),
+		max_load_factor(other.max_load_factor)
+	{
+		other.slots = nullptr;
+		other.controls = nullptr;
+		other.capacity = 0_z;
+		other.size = 0_z;
+		other.deleted = 0_z;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>&
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::operator=(const FlatHashMap& other)
+	{
+		if (this != &other)
+		{
+			FlatHashMap copy(other);
+			*this = std::move(copy);
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>&
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::operator=(FlatHashMap&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Release();
+
+			slots = other.slots;
+			controls = other.controls;
+			capacity = other.capacity;
+			size = other.size;
+			deleted = other.deleted;
+			max_load_factor = other.max_load_factor;
+
+			other.slots = nullptr;
+			other.controls = nullptr;
+			other.capacity = 0_z;
+			other.size = 0_z;
+			other.deleted = 0_z;
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::~FlatHashMap()
+	{
+		Release();
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Find(const TKey& key)
+	{
+		return Iterator(*this, FindIndex(key, MixHash(key)));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Find(const TKey& key) const
+	{
+		return ConstIterator(*this, FindIndex(key, MixHash(key)));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline std::tuple<bool, typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator>
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Insert(const PairType& pair)
+	{
+		return Emplace(pair);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline std::tuple<bool, typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator>
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Insert(PairType&& pair)
+	{
+		return Emplace(std::move(pair));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline TValue& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::operator[](const TKey& key)
+	{
+		const size_t index = FindIndex(key, MixHash(key));
+		if (index != capacity)
+		{
+			return slots[index].second;
+		}
+
+		auto [was_inserted, it] = Insert(PairType(key, TValue{}));
+		return it->second;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline TValue& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::operator[](const TKey& key) const
+	{
+		return at(key);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Remove(const TKey& key)
+	{
+		const size_t index = FindIndex(key, MixHash(key));
+		if (index != capacity)
+		{
+			slots[index].~PairType();
+			--size;
+
+			// A probe only continues past a group that has no empty slot, so the slot can go back to empty when its group still has one
+			const ControlType* group = controls + (index - (index % group_width));
+			if (MatchEmpty(group) != 0)
+			{
+				controls[index] = empty_control;
+			}
+			else
+			{
+				controls[index] = deleted_control;
+				++deleted;
+			}
+		}
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Resize(const size_t new_size)
+	{
+		if (new_size == 0_z)
+		{
+			throw std::invalid_argument("Do not resize to an empty FlatHashMap.");
+		}
+
+		Relocate(NormalizeSlotCount(std::max(new_size, size)));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Rehash(const size_t slot_count)
+	{
+		const size_t minimum_count = static_cast<size_t>(std::ceil(size / max_load_factor));
+		Relocate(NormalizeSlotCount(std::max(slot_count, minimum_count)));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Reserve(const size_t element_count)
+	{
+		const size_t slot_count = static_cast<size_t>(std::ceil(element_count / max_load_factor));
+		if (slot_count > capacity)
+		{
+			Rehash(slot_count);
+		}
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline float FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::LoadFactor() const
+	{
+		return (capacity == 0_z) ? 0.0f : static_cast<float>(size) / static_cast<float>(capacity);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline float FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MaxLoadFactor() const
+	{
+		return max_load_factor;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::SetMaxLoadFactor(const float new_max_load_factor)
+	{
+		if (!(new_max_load_factor > 0.0f) || new_max_load_factor > 1.0f)
+		{
+			throw std::invalid_argument("The max load factor must be in (0, 1].");
+		}
+
+		max_load_factor = new_max_load_factor;
+		if (LoadFactor() > max_load_factor)
+		{
+			Rehash(capacity);
+		}
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Clear()
+	{
+		for (size_t index = NextOccupied(0_z); index < capacity; index = NextOccupied(index + 1_z))
+		{
+			slots[index].~PairType();
+		}
+
+		if (controls != nullptr)
+		{
+			std::memset(controls, empty_control, capacity);
+		}
+
+		size = 0_z;
+		deleted = 0_z;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Size() const
+	{
+		return size;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::BucketSize() const
+	{
+		return capacity;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ContainsKey(const TKey& key) const
+	{
+		return (FindIndex(key, MixHash(key)) != capacity);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline TValue& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::at(const TKey& key)
+	{
+		const size_t index = FindIndex(key, MixHash(key));
+		if (index == capacity)
+		{
+			throw std::runtime_error("Value not found at this index");
+		}
+
+		return slots[index].second;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline TValue& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::at(const TKey& key) const
+	{
+		return const_cast<FlatHashMap*>(this)->at(key);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::begin()
+	{
+		return Iterator(*this, NextOccupied(0_z));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::end()
+	{
+		return Iterator(*this, capacity);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::begin() const
+	{
+		return ConstIterator(*this, NextOccupied(0_z));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::cbegin() const
+	{
+		return ConstIterator(*this, NextOccupied(0_z));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::end() const
+	{
+		return ConstIterator(*this, capacity);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::cend() const
+	{
+		return ConstIterator(*this, capacity);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MixHash(const TKey& key)
+	{
+		// The low 7 bits become the control byte and the rest pick the group, so spread every input bit over both
+		std::uint64_t hash = static_cast<std::uint64_t>(HashFunctor{}(key));
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdull;
+		hash ^= hash >> 33;
+
+		return static_cast<size_t>(hash);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::NormalizeSlotCount(const size_t slot_count)
+	{
+		size_t normalized = group_width;
+		while (normalized < slot_count)
+		{
+			normalized <<= 1;
+		}
+
+		return normalized;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MaskType
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MatchControl(const ControlType* group, const ControlType control)
+	{
+#ifdef FLAT_HASH_MAP_SSE2
+		const __m128i group_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+		return static_cast<MaskType>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(control), group_bytes)));
+#else
+		MaskType mask = 0;
+		for (size_t index = 0_z; index < group_width; ++index)
+		{
+			mask |= static_cast<MaskType>(group[index] == control) << index;
+		}
+
+		return mask;
+#endif
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MaskType
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MatchEmpty(const ControlType* group)
+	{
+		return MatchControl(group, empty_control);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MaskType
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MatchEmptyOrDeleted(const ControlType* group)
+	{
+		// Empty and deleted are the only negative control values, so the sign bits are the mask
+#ifdef FLAT_HASH_MAP_SSE2
+		return static_cast<MaskType>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+#else
+		MaskType mask = 0;
+		for (size_t index = 0_z; index < group_width; ++index)
+		{
+			mask |= static_cast<MaskType>(group[index] < 0) << index;
+		}
+
+		return mask;
+#endif
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::FindIndex(const TKey& key, const size_t hash) const
+	{
+		if (capacity == 0_z)
+		{
+			return capacity;
+		}
+
+		EqualityFunctor eq{};
+		const ControlType control = static_cast<ControlType>(hash & 0x7F);
+		const size_t group_mask = (capacity / group_width) - 1_z;
+
+		size_t group_index = (hash >> 7) & group_mask;
+		for (size_t probe = 0_z; probe <= group_mask; ++probe)
+		{
+			const size_t group_start = group_index * group_width;
+			const ControlType* group = controls + group_start;
+
+			for (MaskType mask = MatchControl(group, control); mask != 0; mask &= (mask - 1))
+			{
+				const size_t index = group_start + static_cast<size_t>(std::countr_zero(mask));
+				if (eq(slots[index].first, key))
+				{
+					return index;
+				}
+			}
+
+			if (MatchEmpty(group) != 0)
+			{
+				break;
+			}
+
+			// Triangular steps visit every group exactly once when the group count is a power of two
+			group_index = (group_index + probe + 1_z) & group_mask;
+		}
+
+		return capacity;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::FindInsertIndex(const size_t hash) const
+	{
+		const size_t group_mask = (capacity / group_width) - 1_z;
+
+		size_t group_index = (hash >> 7) & group_mask;
+		for (size_t probe = 0_z; probe <= group_mask; ++probe)
+		{
+			const size_t group_start = group_index * group_width;
+			const MaskType mask = MatchEmptyOrDeleted(controls + group_start);
+			if (mask != 0)
+			{
+				return group_start + static_cast<size_t>(std::countr_zero(mask));
+			}
+
+			group_index = (group_index + probe + 1_z) & group_mask;
+		}
+
+		throw std::runtime_error("No free slot found. Was the map grown before inserting?");
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::NextOccupied(size_t index) const
+	{
+		while (index < capacity && controls[index] < 0)
+		{
+			++index;
+		}
+
+		return index;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	template <typename Pair>
+	inline std::tuple<bool, typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator>
+		FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Emplace(Pair&& pair)
+	{
+		const size_t hash = MixHash(pair.first);
+		const size_t found_index = FindIndex(pair.first, hash);
+		if (found_index != capacity)
+		{
+			return std::make_tuple(false, Iterator(*this, found_index));
+		}
+
+		GrowIfNeeded();
+
+		const size_t index = FindInsertIndex(hash);
+		new(slots + index) PairType(std::forward<Pair>(pair));
+
+		if (controls[index] == deleted_control)
+		{
+			--deleted;
+		}
+
+		controls[index] = static_cast<ControlType>(hash & 0x7F);
+		++size;
+
+		return std::make_tuple(true, Iterator(*this, index));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::GrowIfNeeded()
+	{
+		const float max_used = max_load_factor * static_cast<float>(capacity);
+		if (static_cast<float>(size + deleted + 1_z) > max_used)
+		{
+			// Mostly tombstones: rebuild in place rather than doubling
+			const bool should_double = (static_cast<float>(size + 1_z) * 2.0f > max_used);
+			Rehash(should_double ? capacity * 2_z : capacity);
+			return true;
+		}
+
+		return false;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Relocate(const size_t slot_count)
+	{
+		PairType* old_slots = slots;
+		ControlType* old_controls = controls;
+		const size_t old_capacity = capacity;
+
+		Allocate(slot_count);
+		deleted = 0_z;
+
+		for (size_t index = 0_z; index < old_capacity; ++index)
+		{
+			if (old_controls[index] >= 0)
+			{
+				PairType& pair = old_slots[index];
+				const size_t hash = MixHash(pair.first);
+				const size_t new_index = FindInsertIndex(hash);
+
+				new(slots + new_index) PairType(std::move(pair));
+				controls[new_index] = static_cast<ControlType>(hash & 0x7F);
+				pair.~PairType();
+			}
+		}
+
+		std::free(old_slots);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Allocate(const size_t slot_count)
+	{
+		// Slots and control bytes share one block, with the control bytes trailing the slots
+		void* block = std::malloc((slot_count * sizeof(PairType)) + slot_count);
+		if (block == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		slots = reinterpret_cast<PairType*>(block);
+		controls = reinterpret_cast<ControlType*>(slots + slot_count);
+		std::memset(controls, empty_control, slot_count);
+		capacity = slot_count;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Release()
+	{
+		Clear();
+		std::free(slots);
+
+		slots = nullptr;
+		controls = nullptr;
+		capacity = 0_z;
+	}
+
+#pragma endregion FlatHashMap
+}
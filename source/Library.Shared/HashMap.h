@@ -86,7 +86,7 @@ namespace FieaGameEngine
 			/// Increments a Iterator by altering the list Iterator to look at the next element in that list
 			/// </summary>
 			/// <remarks> Specifically handles the prefix increment case </remarks>
-			/// <exception cref="std::runtime_error"> If the owning list is null </exception>
+			/// <exception cref="std::runtime_error"> If the owning list is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <returns> The altered Iterator </returns>
 			Iterator& operator++();
 			
@@ -101,7 +101,7 @@ namespace FieaGameEngine
 			/// <summary>
 			/// The overloaded dereference operator which retrieves the Iterator's data at the index
 			/// </summary>
-			/// <exception cref="std::runtime_error"> If the owner is null </exception>
+			/// <exception cref="std::runtime_error"> If the owner is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <remarks> Does not alter the list in the Iterator </remarks>
 			/// <returns> The data that the List's Iterator's node points at </returns>
 			PairType& operator*() const;
@@ -109,7 +109,7 @@ namespace FieaGameEngine
 			/// <summary>
 			/// The overloaded dereference operator which retrieves the Iterator's data at the index
 			/// </summary>
-			/// <exception cref="std::runtime_error"> If the node is null </exception>
+			/// <exception cref="std::runtime_error"> If the node is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <remarks> Does not alter the list in the Iterator </remarks>
 			/// <returns> A pointer to the data that the Iterator's vector (at index) points at </returns>
 			PairType* operator->() const;
@@ -196,7 +196,7 @@ namespace FieaGameEngine
 			/// Increments a ConstIterator by altering the list ConstIterator to look at the next element in that list
 			/// </summary>
 			/// <remarks> Specifically handles the prefix increment case </remarks>
-			/// <exception cref="std::runtime_error"> If the owning list is null </exception>
+			/// <exception cref="std::runtime_error"> If the owning list is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <returns> The altered Iterator </returns>
 			ConstIterator& operator++();
 			
@@ -211,7 +211,7 @@ namespace FieaGameEngine
 			/// <summary>
 			/// The overloaded dereference operator which retrieves the ConstIterator's data at the index
 			/// </summary>
-			/// <exception cref="std::runtime_error"> If the owner is null </exception>
+			/// <exception cref="std::runtime_error"> If the owner is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <remarks> Does not alter the list in the Iterator </remarks>
 			/// <returns> The data that the List's ConstIterator's node points at </returns>
 			const PairType& operator*() const;
@@ -219,7 +219,7 @@ namespace FieaGameEngine
 			/// <summary>
 			/// The overloaded dereference operator which retrieves the ConstIterator's data at the index
 			/// </summary>
-			/// <exception cref="std::runtime_error"> If the owner is null </exception>
+			/// <exception cref="std::runtime_error"> If the owner is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <remarks> Does not alter the list in the Iterator </remarks>
 			/// <returns> A pointer to the data that the Iterator's vector (at index) points at </returns>
 			const PairType* operator->() const;
@@ -293,6 +293,24 @@ namespace FieaGameEngine
 		/// <remarks> The returned ConstIterator will point past the end of the list if the key isn't found </remarks>
 		/// <returns> A ConstIterator that contains a reference to the hashmap, the index of the data, and the ConstIterator pointing at the list </returns>
 		ConstIterator Find(const TKey& key) const;
+
+		/// <summary>
+		/// Finds the value associated with the key, using a hash the caller already computed
+		/// </summary>
+		/// <param name="key"> The key associated with the pair that could be in the hashmap </param>
+		/// <param name="hash"> The result of HashFunctor for the key, e.g. cached by an Atom </param>
+		/// <remarks> Passing a hash that doesn't match the key will simply fail to find it </remarks>
+		/// <returns> An Iterator that contains a reference to the hashmap, the index of the data, and the Iterator pointing at the list </returns>
+		Iterator Find(const TKey& key, const size_t hash);
+
+		/// <summary>
+		/// Finds the value associated with the key, using a hash the caller already computed
+		/// </summary>
+		/// <param name="key"> The key associated with the pair that could be in the hashmap </param>
+		/// <param name="hash"> The result of HashFunctor for the key, e.g. cached by an Atom </param>
+		/// <remarks> Passing a hash that doesn't match the key will simply fail to find it </remarks>
+		/// <returns> A ConstIterator that contains a reference to the hashmap, the index of the data, and the ConstIterator pointing at the list </returns>
+		ConstIterator Find(const TKey& key, const size_t hash) const;
 		
 		/// <summary>
 		/// Adds a new element to the hashmap if the pair is not found
@@ -310,6 +328,16 @@ namespace FieaGameEngine
 		/// <returns> A tuple with a bool indicating whether or not the key was inserted, and an
 		///  iterator that contains this index and the current Hashmap </returns>
 		std::tuple<bool, Iterator> Insert(PairType&& pair);
+
+		/// <summary>
+		/// Adds a new element to the hashmap if the pair is not found, using a hash the caller already computed
+		/// </summary>
+		/// <param name="pair"> The pair to move into the hashmap </param>
+		/// <param name="hash"> The result of HashFunctor for the pair's key, e.g. cached by an Atom </param>
+		/// <remarks> The hash must match the key, otherwise the pair lands in a bucket no other lookup will search </remarks>
+		/// <returns> A tuple with a bool indicating whether or not the key was inserted, and an
+		///  iterator that contains this index and the current Hashmap </returns>
+		std::tuple<bool, Iterator> Insert(PairType&& pair, const size_t hash);
 		
 		/// <summary>
 		/// Finds the value associated with the key 
@@ -335,10 +363,47 @@ namespace FieaGameEngine
 		void Remove(const TKey& key);
 
 		/// <summary>
-		/// Resizes the map to be of the parameter's size. Creates a new map and re-hashes all of them.
+		/// Resizes the map to be of the parameter's size and re-hashes every element into the new buckets
 		/// </summary>
-		/// <param name="new_size"> The new size of the map on initialize </param>
+		/// <param name="new_size"> The new amount of buckets </param>
+		/// <remarks> Ignores the max load factor, use Rehash to respect it </remarks>
+		/// <exception cref="std::invalid_argument"> If the new size is 0 </exception>
 		void Resize(const size_t new_size);
+
+		/// <summary>
+		/// Re-hashes every element into at least the parameter's amount of buckets
+		/// </summary>
+		/// <param name="bucket_count"> The requested amount of buckets </param>
+		/// <remarks> Grows the request if it would push the load factor past the max load factor </remarks>
+		/// <remarks> Nodes are relinked rather than copied, so references to pairs stay valid. Iterators do not </remarks>
+		void Rehash(const size_t bucket_count);
+
+		/// <summary>
+		/// Sets the amount of buckets so that the parameter's amount of elements fit without a rehash
+		/// </summary>
+		/// <param name="element_count"> The amount of elements the map should hold </param>
+		/// <remarks> Never shrinks the amount of buckets </remarks>
+		void Reserve(const size_t element_count);
+
+		/// <summary>
+		/// Queries the average amount of elements per bucket
+		/// </summary>
+		/// <returns> The size of the map divided by the amount of buckets </returns>
+		float LoadFactor() const;
+
+		/// <summary>
+		/// Queries the load factor that triggers an automatic rehash on insert
+		/// </summary>
+		/// <returns> The max load factor of the map </returns>
+		float MaxLoadFactor() const;
+
+		/// <summary>
+		/// Sets the load factor that triggers an automatic rehash on insert
+		/// </summary>
+		/// <param name="new_max_load_factor"> The new max load factor </param>
+		/// <remarks> Rehashes immediately if the current load factor is already past the new max </remarks>
+		/// <exception cref="std::invalid_argument"> If the max load factor is not positive </exception>
+		void SetMaxLoadFactor(const float new_max_load_factor);
 		
 		/// <summary>
 		/// Removes all elements from the hashmap
@@ -420,9 +485,17 @@ namespace FieaGameEngine
 
 	private:
 		std::tuple<bool, size_t, ChainIteratorType> KeySearch(const TKey& key) const;
+		std::tuple<bool, size_t, ChainIteratorType> KeySearch(const TKey& key, const size_t hash) const;
+		bool GrowIfNeeded();
+		void RelinkBuckets(const size_t bucket_count);
+		ChainType& Bucket(const size_t index);
+		const ChainType& Bucket(const size_t index) const;
+
+		inline static const float default_max_load_factor = 1.0f;
 
 		BucketType buckets;
 		size_t size = 0_z;
+		float max_load_factor = default_max_load_factor;
 	};
 }
 
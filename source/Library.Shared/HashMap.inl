@@ -2,6 +2,8 @@
 #include "HashMap.h"
 #include "SizeLiteral.h"
 #include <tuple>
+#include <cmath>
+#include <algorithm>
 
 namespace FieaGameEngine
 {
@@ -30,25 +32,27 @@ namespace FieaGameEngine
 	inline typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator&
 		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator++()
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
 		}
+#endif
 
 		if (owner->size != 0)
 		{
 			++list_iterator;
 
-			while (list_iterator == owner->buckets.at(index).end())
+			while (list_iterator == owner->Bucket(index).end())
 			{
 				++index;
 				if (index == owner->buckets.Size())
 				{
-					list_iterator = owner->buckets.at(index - 1).end();
+					list_iterator = owner->Bucket(index - 1).end();
 					break;
 				}
 
-				list_iterator = owner->buckets.at(index).begin();
+				list_iterator = owner->Bucket(index).begin();
 			}
 		}
 
@@ -69,10 +73,12 @@ namespace FieaGameEngine
 	inline typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType&
 		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator*() const
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
 		}
+#endif
 
 		return *list_iterator;
 	}
@@ -81,10 +87,12 @@ namespace FieaGameEngine
 	inline typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType*
 		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator->() const
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
 		}
+#endif
 
 		return &(*list_iterator);
 	}
@@ -123,25 +131,27 @@ namespace FieaGameEngine
 	inline typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator&
 		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator++()
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
 		}
+#endif
 
 		if (owner->size != 0)
 		{
 			++list_constiterator;
 
-			while (list_constiterator == owner->buckets.at(index).end())
+			while (list_constiterator == owner->Bucket(index).end())
 			{
 				++index;
 				if (index == owner->buckets.Size())
 				{
-					list_constiterator = owner->buckets.at(index - 1).end();
+					list_constiterator = owner->Bucket(index - 1).end();
 					break;
 				}
 
-				list_constiterator = owner->buckets.at(index).begin();
+				list_constiterator = owner->Bucket(index).begin();
 			}
 		}
 
@@ -162,10 +172,12 @@ namespace FieaGameEngine
 	inline const typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType&
 		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator*() const
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
 		}
+#endif
 
 		return *list_constiterator;
 	}
@@ -174,10 +186,12 @@ namespace FieaGameEngine
 	inline const typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType*
 		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator->() const
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
 		}
+#endif
 
 		return &(*list_constiterator);
 	}
@@ -211,6 +225,21 @@ namespace FieaGameEngine
 		return const_cast<HashMap*>(this)->Find(key);
 	}
 
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator
+		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Find(const TKey& key, const size_t hash)
+	{
+		auto [was_found, bucket_index, chain_iterator] = KeySearch(key, hash);
+		return was_found ? Iterator(*this, bucket_index, chain_iterator) : end();
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator
+		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Find(const TKey& key, const size_t hash) const
+	{
+		return const_cast<HashMap*>(this)->Find(key, hash);
+	}
+
 	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
 	inline std::tuple<bool, typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator>
 		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Insert(const PairType& pair)
@@ -221,6 +250,11 @@ namespace FieaGameEngine
 			return std::make_tuple(false, Iterator(*this, bucket_index, chain_iterator));
 		}
 
+		if (GrowIfNeeded())
+		{
+			bucket_index = HashFunctor{}(pair.first) % buckets.Size();
+		}
+
 		ChainIteratorType it_new = buckets.at(bucket_index).PushBack(pair);
 		++size;
 
@@ -231,12 +265,25 @@ namespace FieaGameEngine
 	inline std::tuple<bool, typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator>
 		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Insert(PairType&& pair)
 	{
-		auto [was_found, bucket_index, chain_iterator] = KeySearch(pair.first);
+		const size_t hash = HashFunctor{}(pair.first);
+		return Insert(std::move(pair), hash);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline std::tuple<bool, typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator>
+		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Insert(PairType&& pair, const size_t hash)
+	{
+		auto [was_found, bucket_index, chain_iterator] = KeySearch(pair.first, hash);
 		if (was_found)
 		{
 			return std::make_tuple(false, Iterator(*this, bucket_index, chain_iterator));
 		}
 
+		if (GrowIfNeeded())
+		{
+			bucket_index = hash % buckets.Size();
+		}
+
 		ChainIteratorType it_new = buckets.at(bucket_index).PushBack(std::move(pair));
 		++size;
 
@@ -270,14 +317,56 @@ namespace FieaGameEngine
 	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
 	inline void HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Resize(const size_t new_size)
 	{
-		HashMap map(new_size);
+		if (new_size == 0_z)
+		{
+			throw std::invalid_argument("Do not resize to an empty HashMap.");
+		}
+
+		RelinkBuckets(new_size);
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Rehash(const size_t bucket_count)
+	{
+		const size_t minimum_count = static_cast<size_t>(std::ceil(size / max_load_factor));
+		RelinkBuckets(std::max({ 1_z, bucket_count, minimum_count }));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Reserve(const size_t element_count)
+	{
+		const size_t bucket_count = static_cast<size_t>(std::ceil(element_count / max_load_factor));
+		if (bucket_count > buckets.Size())
+		{
+			Rehash(bucket_count);
+		}
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline float HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::LoadFactor() const
+	{
+		return static_cast<float>(size) / static_cast<float>(buckets.Size());
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline float HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MaxLoadFactor() const
+	{
+		return max_load_factor;
+	}
 
-		for (auto& item : *this)
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::SetMaxLoadFactor(const float new_max_load_factor)
+	{
+		if (!(new_max_load_factor > 0.0f))
 		{
-			map.Insert(std::move(item));
+			throw std::invalid_argument("The max load factor must be positive.");
 		}
 
-		*this = std::move(map);
+		max_load_factor = new_max_load_factor;
+		if (LoadFactor() > max_load_factor)
+		{
+			Rehash(buckets.Size());
+		}
 	}
 
 	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
@@ -408,14 +497,43 @@ namespace FieaGameEngine
 		return ConstIterator(*this, buckets.Size(), buckets.at(buckets.Size() - 1).cend());
 	}
 
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ChainType&
+		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Bucket(const size_t index)
+	{
+#if FIEA_DEBUG_ITERATORS
+		return buckets.at(index);
+#else
+		return buckets.Data()[index];
+#endif
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline const typename HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ChainType&
+		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Bucket(const size_t index) const
+	{
+#if FIEA_DEBUG_ITERATORS
+		return buckets.at(index);
+#else
+		return buckets.Data()[index];
+#endif
+	}
+
 	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
 	inline std::tuple<bool, size_t, typename SList<std::pair<const TKey, TValue>>::Iterator> 
 		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::KeySearch(const TKey& key) const
 	{
 		HashFunctor hash_functor{};
+		return KeySearch(key, hash_functor(key));
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline std::tuple<bool, size_t, typename SList<std::pair<const TKey, TValue>>::Iterator> 
+		HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::KeySearch(const TKey& key, const size_t hash) const
+	{
 		EqualityFunctor eq{};
 
-		const size_t index_ref = (hash_functor(key)) % (buckets.Size());
+		const size_t index_ref = hash % (buckets.Size());
 		ChainType& list = buckets.at(index_ref);
 
 		ChainIteratorType it = list.begin();
@@ -430,5 +548,43 @@ namespace FieaGameEngine
 		return std::make_tuple(false, index_ref, it);
 	}
 
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::GrowIfNeeded()
+	{
+		if (static_cast<float>(size + 1_z) > max_load_factor * static_cast<float>(buckets.Size()))
+		{
+			Rehash((buckets.Size() * 2_z) + 1_z);
+			return true;
+		}
+
+		return false;
+	}
+
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void HashMap<TKey, TValue, HashFunctor, EqualityFunctor>::RelinkBuckets(const size_t bucket_count)
+	{
+		if (bucket_count == buckets.Size())
+		{
+			return;
+		}
+
+		HashFunctor hash_functor{};
+
+		BucketType new_buckets;
+		new_buckets.Resize(bucket_count);
+
+		for (size_t index_ref = 0_z; index_ref < buckets.Size(); ++index_ref)
+		{
+			ChainType& chain = buckets.at(index_ref);
+			while (!chain.IsEmpty())
+			{
+				const size_t new_index = hash_functor(chain.Front().first) % bucket_count;
+				chain.MoveFrontTo(new_buckets.at(new_index));
+			}
+		}
+
+		buckets = std::move(new_buckets);
+	}
+
 #pragma endregion HashMap
 }
\ No newline at end of file
@@ -53,6 +53,6 @@ namespace FieaGameEngine
 		/// Creates a new version of the particular helper. 
 		/// <remarks> Pure virtual indicating that you cannot instantiate this base helper </remarks>
 		/// </summary>
-		virtual gsl::owner<IJsonParseHelper*> Create() const = 0 {};
+		virtual gsl::owner<IJsonParseHelper*> Create() const = 0;
 	};
 }
\ No newline at end of file
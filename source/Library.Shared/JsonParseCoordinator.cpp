@@ -10,6 +10,10 @@ namespace FieaGameEngine
 
 #pragma region SharedData
 
+	JsonParseCoordinator::SharedData::~SharedData()
+	{
+	}
+
 	void JsonParseCoordinator::SharedData::Initialize()
 	{
 		coordinator = nullptr;
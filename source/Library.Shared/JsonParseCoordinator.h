@@ -70,7 +70,7 @@ namespace FieaGameEngine
 			/// <summary>
 			/// Pure virtual destructor meant to be overriden in each helper's class
 			/// </summary>
-			virtual ~SharedData() = 0 {};
+			virtual ~SharedData() = 0;
 
 			/// <summary>
 			/// Essentially "default constructs" this shareddata. Resets its members to the default
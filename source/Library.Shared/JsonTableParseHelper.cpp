@@ -102,13 +102,25 @@ namespace FieaGameEngine
 
 	void JsonTableParseHelper::SetDatumValue(Datum& datum, const Json::Value& value, size_t index)
 	{
+		// String values are parsed straight out of the json document, anything else is converted to text first
+		std::string converted;
+		const char* begin = nullptr;
+		const char* end = nullptr;
+		if (!value.isString() || !value.getString(&begin, &end))
+		{
+			converted = value.asString();
+			begin = converted.data();
+			end = begin + converted.size();
+		}
+
+		const std::string_view text(begin, static_cast<size_t>(end - begin));
 		if (datum.IsExternal())
 		{
-			datum.SetFromString(value.asString(), index);
+			datum.SetFromString(text, index);
 		}
 		else
 		{
-			datum.PushBackFromString(value.asString());
+			datum.PushBackFromString(text);
 		}
 	}
 }
\ No newline at end of file
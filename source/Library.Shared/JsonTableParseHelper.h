@@ -139,7 +139,7 @@ namespace FieaGameEngine
 		{
 			const std::string& key;
 			std::string class_name;
-			Datum::DatumTypes type;
+			Datum::DatumTypes type = Datum::DatumTypes::Unknown;
 			Scope& scope;
 		};
 
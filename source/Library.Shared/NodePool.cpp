@@ -0,0 +1,117 @@
+#include "pch.h"
+#include "NodePool.h"
+#include "SizeLiteral.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+
+namespace FieaGameEngine
+{
+	NodePool::NodePool(const size_t new_chunk_size, const size_t chunk_alignment, const size_t new_chunks_per_block) :
+		chunks_per_block(new_chunks_per_block)
+	{
+		if (new_chunk_size == 0_z || new_chunks_per_block == 0_z)
+		{
+			throw std::invalid_argument("The chunk size and the chunks per block must be greater than zero.");
+		}
+
+		if (chunk_alignment == 0_z || (chunk_alignment & (chunk_alignment - 1)) != 0_z)
+		{
+			throw std::invalid_argument("The chunk alignment must be a power of two.");
+		}
+
+		// Blocks come from malloc, so chunks can be aligned up to max_align_t without any extra padding
+		const size_t alignment = std::max({ chunk_alignment, alignof(FreeChunk), alignof(BlockHeader) });
+		if (alignment > alignof(std::max_align_t))
+		{
+			throw std::invalid_argument("The chunk alignment is larger than malloc guarantees.");
+		}
+
+		chunk_size = (std::max(new_chunk_size, sizeof(FreeChunk)) + alignment - 1) & ~(alignment - 1);
+		header_size = (sizeof(BlockHeader) + alignment - 1) & ~(alignment - 1);
+	}
+
+	NodePool::~NodePool()
+	{
+		FreeBlocks();
+	}
+
+	void* NodePool::Allocate()
+	{
+		if (free_list == nullptr)
+		{
+			AddBlock();
+		}
+
+		FreeChunk* chunk = free_list;
+		free_list = chunk->next;
+		++live_count;
+
+		return chunk;
+	}
+
+	void NodePool::Deallocate(void* chunk)
+	{
+		if (chunk == nullptr)
+		{
+			return;
+		}
+
+		FreeChunk* freed = reinterpret_cast<FreeChunk*>(chunk);
+		freed->next = free_list;
+		free_list = freed;
+
+		if (--live_count == 0_z)
+		{
+			FreeBlocks();
+		}
+	}
+
+	void NodePool::Release()
+	{
+		if (live_count != 0_z)
+		{
+			throw std::runtime_error("Cannot release a pool with chunks still in use.");
+		}
+
+		FreeBlocks();
+	}
+
+	void NodePool::AddBlock()
+	{
+		void* memory = malloc(header_size + chunk_size * chunks_per_block);
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		BlockHeader* block = reinterpret_cast<BlockHeader*>(memory);
+		block->next = blocks;
+		blocks = block;
+		++block_count;
+
+		// Thread the chunks back to front so the first allocations walk the block in address order
+		std::byte* first_chunk = reinterpret_cast<std::byte*>(memory) + header_size;
+		for (size_t index = chunks_per_block; index > 0_z; --index)
+		{
+			FreeChunk* chunk = reinterpret_cast<FreeChunk*>(first_chunk + (index - 1_z) * chunk_size);
+			chunk->next = free_list;
+			free_list = chunk;
+		}
+	}
+
+	void NodePool::FreeBlocks()
+	{
+		while (blocks != nullptr)
+		{
+			BlockHeader* next = blocks->next;
+			free(blocks);
+			blocks = next;
+		}
+
+		free_list = nullptr;
+		block_count = 0_z;
+	}
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// A slab allocator for fixed-size chunks
+	/// Chunks are carved out of blocks of chunks_per_block at a time, and freed chunks go onto an intrusive free list for reuse
+	/// Every block is handed back to the heap once the last live chunk is returned
+	/// </summary>
+	/// <remarks> Not thread safe, every pool is expected to be used from a single thread </remarks>
+	class NodePool final
+	{
+	public:
+		/// <summary>
+		/// Deleted default constructor, a pool needs to know its chunk size
+		/// </summary>
+		NodePool() = delete;
+
+		/// <summary>
+		/// Creates an empty pool, no memory is allocated until the first chunk is requested
+		/// </summary>
+		/// <param name="chunk_size"> The amount of bytes in every chunk </param>
+		/// <param name="chunk_alignment"> The alignment every chunk must satisfy, a power of two </param>
+		/// <param name="chunks_per_block"> The amount of chunks each block of memory holds </param>
+		/// <exception cref="std::invalid_argument"> If any parameter is zero or the alignment is not a power of two </exception>
+		NodePool(const size_t chunk_size, const size_t chunk_alignment, const size_t chunks_per_block = 64);
+
+		/// <summary>
+		/// Deleted copy constructor, chunks belong to exactly one pool
+		/// </summary>
+		NodePool(const NodePool& other) = delete;
+
+		/// <summary>
+		/// Deleted move constructor, chunks belong to exactly one pool
+		/// </summary>
+		NodePool(NodePool&& other) noexcept = delete;
+
+		/// <summary>
+		/// Deleted copy assignment, chunks belong to exactly one pool
+		/// </summary>
+		NodePool& operator=(const NodePool& other) = delete;
+
+		/// <summary>
+		/// Deleted move assignment, chunks belong to exactly one pool
+		/// </summary>
+		NodePool& operator=(NodePool&& other) noexcept = delete;
+
+		/// <summary>
+		/// Frees every block, whether or not chunks are still in use
+		/// </summary>
+		~NodePool();
+
+		/// <summary>
+		/// Retrieves an uninitialized chunk, reusing a freed one when possible
+		/// </summary>
+		/// <remarks> Only touches the heap when the free list is empty </remarks>
+		/// <returns> The address of a chunk of at least ChunkSize bytes </returns>
+		void* Allocate();
+
+		/// <summary>
+		/// Returns a chunk to the free list
+		/// </summary>
+		/// <param name="chunk"> A chunk previously retrieved from Allocate on this pool, or null </param>
+		/// <remarks> Releases every block once no chunks are in use </remarks>
+		void Deallocate(void* chunk);
+
+		/// <summary>
+		/// Frees every block, only valid when no chunks are in use
+		/// </summary>
+		/// <exception cref="std::runtime_error"> If chunks are still in use </exception>
+		void Release();
+
+		/// <summary>
+		/// Queries the size of every chunk handed out by this pool
+		/// </summary>
+		/// <returns> The chunk size, rounded up to the chunk alignment </returns>
+		size_t ChunkSize() const { return chunk_size; }
+
+		/// <summary>
+		/// Queries the amount of chunks that were allocated and not yet deallocated
+		/// </summary>
+		/// <returns> The amount of live chunks </returns>
+		size_t LiveCount() const { return live_count; }
+
+		/// <summary>
+		/// Queries the amount of blocks currently held from the heap
+		/// </summary>
+		/// <returns> The amount of blocks </returns>
+		size_t BlockCount() const { return block_count; }
+
+	private:
+		struct FreeChunk final
+		{
+			FreeChunk* next = nullptr;
+		};
+
+		struct BlockHeader final
+		{
+			BlockHeader* next = nullptr;
+		};
+
+		/// <summary>
+		/// Allocates one more block and threads all of its chunks onto the free list
+		/// </summary>
+		void AddBlock();
+
+		/// <summary>
+		/// Hands every block back to the heap and empties the free list
+		/// </summary>
+		void FreeBlocks();
+
+		size_t chunk_size = 0;
+		size_t header_size = 0;
+		size_t chunks_per_block = 0;
+
+		BlockHeader* blocks = nullptr;
+		FreeChunk* free_list = nullptr;
+		size_t block_count = 0;
+		size_t live_count = 0;
+	};
+}
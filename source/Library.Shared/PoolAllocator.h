@@ -0,0 +1,62 @@
+#pragma once
+
+#include "NodePool.h"
+#include <cstddef>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Node allocation policy which sends every node straight to the global heap through new and delete
+	/// </summary>
+	struct HeapAllocator final
+	{
+		/// <summary>
+		/// Allocates and constructs a single object
+		/// </summary>
+		/// <param name="args"> The arguments forwarded to the object's constructor </param>
+		/// <returns> The newly constructed object </returns>
+		template <typename U, typename... Args>
+		U* Create(Args&&... args) const;
+
+		/// <summary>
+		/// Destructs and frees a single object created by Create
+		/// </summary>
+		/// <param name="object"> The object to destroy, can be null </param>
+		template <typename U>
+		void Destroy(U* object) const;
+	};
+
+	/// <summary>
+	/// Node allocation policy which recycles objects through one NodePool per object type
+	/// Pools are shared by every container using the same node type, so nodes can move between those containers freely
+	/// </summary>
+	/// <remarks> Pools are not thread safe and hand their blocks back to the heap once every node of their type is destroyed </remarks>
+	template <std::size_t ChunksPerBlock = 64>
+	struct PoolAllocator final
+	{
+		/// <summary>
+		/// Constructs a single object in a chunk taken from this type's pool
+		/// </summary>
+		/// <param name="args"> The arguments forwarded to the object's constructor </param>
+		/// <returns> The newly constructed object </returns>
+		template <typename U, typename... Args>
+		U* Create(Args&&... args) const;
+
+		/// <summary>
+		/// Destructs a single object created by Create and returns its chunk to the pool
+		/// </summary>
+		/// <param name="object"> The object to destroy, can be null </param>
+		template <typename U>
+		void Destroy(U* object) const;
+
+		/// <summary>
+		/// Retrieves the pool shared by every object of type U
+		/// </summary>
+		/// <remarks> The pool is never destructed, so containers with static storage can still free their nodes during shutdown </remarks>
+		/// <returns> The pool for type U </returns>
+		template <typename U>
+		static NodePool& Pool();
+	};
+}
+
+#include "PoolAllocator.inl"
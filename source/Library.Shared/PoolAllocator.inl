@@ -0,0 +1,65 @@
+#include "pch.h"
+#include "PoolAllocator.h"
+#include <new>
+#include <utility>
+
+namespace FieaGameEngine
+{
+#pragma region HeapAllocator
+
+	template <typename U, typename... Args>
+	inline U* HeapAllocator::Create(Args&&... args) const
+	{
+		return new U(std::forward<Args>(args)...);
+	}
+
+	template <typename U>
+	inline void HeapAllocator::Destroy(U* object) const
+	{
+		delete object;
+	}
+
+#pragma endregion HeapAllocator
+
+#pragma region PoolAllocator
+
+	template <std::size_t ChunksPerBlock>
+	template <typename U, typename... Args>
+	inline U* PoolAllocator<ChunksPerBlock>::Create(Args&&... args) const
+	{
+		NodePool& pool = Pool<U>();
+		void* chunk = pool.Allocate();
+
+		try
+		{
+			return new(chunk)U(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			pool.Deallocate(chunk);
+			throw;
+		}
+	}
+
+	template <std::size_t ChunksPerBlock>
+	template <typename U>
+	inline void PoolAllocator<ChunksPerBlock>::Destroy(U* object) const
+	{
+		if (object != nullptr)
+		{
+			object->~U();
+			Pool<U>().Deallocate(object);
+		}
+	}
+
+	template <std::size_t ChunksPerBlock>
+	template <typename U>
+	inline NodePool& PoolAllocator<ChunksPerBlock>::Pool()
+	{
+		alignas(NodePool) static std::byte storage[sizeof(NodePool)];
+		static NodePool* pool = new(storage) NodePool(sizeof(U), alignof(U), ChunksPerBlock);
+		return *pool;
+	}
+
+#pragma endregion PoolAllocator
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <array>
 #include <string>
+#include <string_view>
 #include <cstddef>
 
 namespace FieaGameEngine
@@ -9,37 +11,122 @@ namespace FieaGameEngine
 	{
 	public:
 		using IdType = std::size_t;
+
+		/// <summary>
+		/// The deepest hierarchy (counting from the first type derived from RTTI) a type can declare
+		/// </summary>
+		static constexpr std::size_t MaxTypeDepth = 16;
+
+		/// <summary>
+		/// The precomputed ancestry of a type, built once per type from its parent's descriptor
+		/// Slot (depth - 1) of a type holds itself, and every ancestor sits at its own depth, so a type check is a single compare
+		/// </summary>
+		struct TypeDescriptor final
+		{
+			/// <summary>
+			/// Constructs the descriptor of RTTI itself, which has no ancestors
+			/// </summary>
+			TypeDescriptor() = default;
+
+			/// <summary>
+			/// Constructs the descriptor of a type from the one of its parent
+			/// </summary>
+			/// <param name="parent"> The descriptor of the type's parent </param>
+			/// <param name="id"> The id of the type </param>
+			/// <param name="name"> The name of the type, which must outlive the descriptor (a string literal) </param>
+			TypeDescriptor(const TypeDescriptor& parent, const IdType id, const std::string_view name) :
+				depth(parent.depth + 1), ancestor_ids(parent.ancestor_ids), ancestor_names(parent.ancestor_names)
+			{
+				ancestor_ids[depth - 1] = id;
+				ancestor_names[depth - 1] = name;
+			}
+
+			std::size_t depth = 0;
+			std::array<IdType, MaxTypeDepth> ancestor_ids{};
+			std::array<std::string_view, MaxTypeDepth> ancestor_names{};
+		};
+
+		static constexpr std::size_t TypeDepth = 0;
 		static IdType TypeIdClass() { return 0; }
 
+		static const TypeDescriptor& TypeDescriptorClass()
+		{
+			static const TypeDescriptor descriptor;
+			return descriptor;
+		}
+
 		virtual ~RTTI() = default;
 
 		virtual FieaGameEngine::RTTI::IdType TypeIdInstance() const = 0;
 
-		virtual RTTI* QueryInterface(const IdType)
+		virtual const TypeDescriptor& TypeDescriptorInstance() const = 0;
+
+		RTTI* QueryInterface(const IdType id)
 		{
-			return nullptr;
+			return (Is(id) ? this : nullptr);
 		}
 
-		virtual bool Is(IdType) const
+		/// <summary>
+		/// Checks whether this object is of the type with the given id, or derives from it
+		/// </summary>
+		/// <param name="id"> The id of the type to check against </param>
+		/// <returns> True if the id is found in this object's ancestry </returns>
+		/// <remarks> The depth of the id isn't known, so this scans the ancestry. Prefer Is<T>() when the type is known </remarks>
+		bool Is(const IdType id) const
 		{
+			const TypeDescriptor& descriptor = TypeDescriptorInstance();
+			for (std::size_t index = 0; index < descriptor.depth; ++index)
+			{
+				if (descriptor.ancestor_ids[index] == id)
+				{
+					return true;
+				}
+			}
+
 			return false;
 		}
 
-		virtual bool Is(const std::string&) const
+		/// <summary>
+		/// Checks whether this object is of the type with the given name, or derives from it
+		/// </summary>
+		/// <param name="rtti_name"> The name of the type to check against </param>
+		/// <returns> True if the name is found in this object's ancestry </returns>
+		bool Is(const std::string_view rtti_name) const
 		{
+			const TypeDescriptor& descriptor = TypeDescriptorInstance();
+			for (std::size_t index = 0; index < descriptor.depth; ++index)
+			{
+				if (descriptor.ancestor_names[index] == rtti_name)
+				{
+					return true;
+				}
+			}
+
 			return false;
 		}
 
+		/// <summary>
+		/// Checks whether this object is a T, or derives from it
+		/// </summary>
+		/// <returns> True if T sits at its depth in this object's ancestry </returns>
+		/// <remarks> Unused slots hold 0, which is never a type id, so the depth doesn't need checking </remarks>
+		template <typename T>
+		bool Is() const
+		{
+			static_assert(T::TypeDepth > 0, "Every object is an RTTI, query a derived type instead.");
+			return (TypeDescriptorInstance().ancestor_ids[T::TypeDepth - 1] == T::TypeIdClass());
+		}
+
 		template <typename T>
 		const T* As() const
 		{
-			return (Is(T::TypeIdClass()) ? reinterpret_cast<const T*>(this) : nullptr);
+			return (Is<T>() ? reinterpret_cast<const T*>(this) : nullptr);
 		}
 
 		template <typename T>
 		T* As()
 		{
-			return (Is(T::TypeIdClass()) ? reinterpret_cast<T*>(const_cast<RTTI*>(this)) : nullptr);
+			return (Is<T>() ? reinterpret_cast<T*>(const_cast<RTTI*>(this)) : nullptr);
 		}
 
 		virtual std::string ToString() const
@@ -58,20 +145,17 @@ namespace FieaGameEngine
 			static std::string TypeName() { return std::string(#Type); }														\
 			static FieaGameEngine::RTTI::IdType TypeIdClass() { return sRunTimeTypeId; }										\
 			FieaGameEngine::RTTI::IdType TypeIdInstance() const override { return TypeIdClass(); }								\
-			FieaGameEngine::RTTI* QueryInterface(const RTTI::IdType id) override												\
-            {																													\
-				return (id == sRunTimeTypeId ? reinterpret_cast<FieaGameEngine::RTTI*>(this) : ParentType::QueryInterface(id)); \
-            }																													\
-			bool Is(FieaGameEngine::RTTI::IdType id) const override																\
-			{																													\
-				return (id == sRunTimeTypeId ? true : ParentType::Is(id));														\
-			}																													\
-			bool Is(const std::string& rtti_name) const override																\
+			static constexpr std::size_t TypeDepth = ParentType::TypeDepth + 1;												\
+			static_assert(TypeDepth <= FieaGameEngine::RTTI::MaxTypeDepth, "RTTI hierarchy is deeper than MaxTypeDepth.");		\
+			static const FieaGameEngine::RTTI::TypeDescriptor& TypeDescriptorClass()											\
 			{																													\
-				return (rtti_name == TypeName() ? true : ParentType::Is(rtti_name));											\
+				static const FieaGameEngine::RTTI::TypeDescriptor descriptor(ParentType::TypeDescriptorClass(),				\
+					reinterpret_cast<FieaGameEngine::RTTI::IdType>(&sRunTimeTypeId), #Type);									\
+				return descriptor;																								\
 			}																													\
+			const FieaGameEngine::RTTI::TypeDescriptor& TypeDescriptorInstance() const override { return TypeDescriptorClass(); } \
 			private:																											\
 				static const FieaGameEngine::RTTI::IdType sRunTimeTypeId;
 
 #define RTTI_DEFINITIONS(Type) const FieaGameEngine::RTTI::IdType Type::sRunTimeTypeId = reinterpret_cast<FieaGameEngine::RTTI::IdType>(&Type::sRunTimeTypeId);
-}
\ No newline at end of file
+}
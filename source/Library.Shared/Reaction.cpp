@@ -11,6 +11,10 @@ namespace FieaGameEngine
 
 	}
 
+	Reaction::~Reaction()
+	{
+	}
+
 	void Reaction::Update(WorldState&)
 	{
 		assert(false);
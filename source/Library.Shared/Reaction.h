@@ -45,7 +45,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Pure virtual destructor which indicates an abstract base class
 		/// </summary>
-		virtual ~Reaction() = 0 {};
+		virtual ~Reaction() = 0;
 
 		/// <summary>
 		/// Update method override with no defined implementation, this is intentional
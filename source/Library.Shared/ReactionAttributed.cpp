@@ -36,11 +36,30 @@ namespace FieaGameEngine
 				EventMessageAttributed& message = const_cast<EventMessageAttributed&>(attributed_event->Message());
 				for (auto const& attribute : message.AuxiliaryAttributes())
 				{
-					Datum& datum = message.AppendAuxililaryAttribute(attribute->first);
-					datum.SetType(attribute->second.Type());
-					for (size_t index = 0; index < attribute->second.Size(); ++index)
+					const Datum& source = attribute->second;
+					if (source.Type() == Datum::DatumTypes::Table)
 					{
-						datum[index] = attribute->second[index];
+						// The scopes a previous event handed over are replaced, not kept behind this event's
+						Datum& received = AppendAuxililaryAttribute(attribute->first);
+						if (received.Type() == Datum::DatumTypes::Unknown)
+						{
+							received.SetType(Datum::DatumTypes::Table);
+						}
+
+						while (received.Type() == Datum::DatumTypes::Table && received.Size() > 0_z)
+						{
+							Scope::Destroy(received.Back<Scope>());
+						}
+
+						for (size_t index = 0; index < source.Size(); ++index)
+						{
+							Adopt(*source[index].Clone(), attribute->first);
+						}
+					}
+					else
+					{
+						// The reaction takes the event's arguments as its own, sharing the arrays until either side writes
+						AppendAuxililaryAttribute(attribute->first) = source;
 					}
 				}
 
@@ -66,6 +66,7 @@ namespace FieaGameEngine
 		/// the derived class
 		/// </summary>
 		/// <param name="event"> The event which carries the payload </param>
+		/// <remarks> Each argument replaces whatever an earlier event passed under the same name, nested scopes included </remarks>
 		virtual void Notify(const class EventPublisher& event) override;
 
 		/// <summary>
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "DebugIterators.h"
 #include "DefaultEquality.h"
+#include "PoolAllocator.h"
 
 namespace FieaGameEngine
 { 
@@ -10,8 +12,9 @@ namespace FieaGameEngine
 	/// front refers to the node at the front of the list
 	/// back refers to the node at the back of the list
 	/// size refers to the size of the list
+	/// Nodes are created and destroyed through the Allocator policy, which recycles them through a NodePool by default
 	/// </summary>
-	template <typename T>
+	template <typename T, typename Allocator = PoolAllocator<>>
 	class SList final
 	{
 		private:
@@ -118,7 +121,7 @@ namespace FieaGameEngine
 				/// Increments a Iterator by altering the node pointer to look at its next
 				/// </summary>
 				/// <remarks> Specifically handles the prefix increment case </remarks>
-				/// <exception cref="std::runtime_error"> If the owning list is null </exception>
+				/// <exception cref="std::runtime_error"> If the owning list is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 				/// <returns> The altered Iterator </returns>
 				Iterator& operator++();
 
@@ -133,7 +136,7 @@ namespace FieaGameEngine
 				/// <summary>
 				/// The overloaded dereference operator which retrieves the Iterator's node's data
 				/// </summary>
-				/// <exception cref="std::runtime_error"> If the node is null (or = to end()) </exception>
+				/// <exception cref="std::runtime_error"> If the node is null (or = to end()), only when FIEA_DEBUG_ITERATORS is on </exception>
 				/// <remarks> Does not alter the list in the iterator </remarks>
 				/// <returns> The data that the Iterator's node points at </returns>
 				T& operator*() const;
@@ -150,7 +153,6 @@ namespace FieaGameEngine
 				Node* current = nullptr;		// Use this to mutate the list
 			};
 
-			using value_type = T;
 			/// <summary>
 			/// A templated class which defines a non-inheritable ConstIterator
 			/// Stores a reference the owning list and the node this iterator is referring to
@@ -167,7 +169,7 @@ namespace FieaGameEngine
 				using value_type = T;
 				using reference = T;
 				using pointer = T*;
-				using iterator_category = std::random_access_iterator_tag;
+				using iterator_category = std::forward_iterator_tag;
 
 				/// <summary>
 				/// The default constructor with a const list and a node pointer 
@@ -232,7 +234,7 @@ namespace FieaGameEngine
 				/// Increments a ConstIterator by altering the node pointer to look at its next
 				/// </summary>
 				/// <remarks> Specifically handles the prefix increment case </remarks>
-				/// <exception cref="std::runtime_error"> If the owning list is null </exception>
+				/// <exception cref="std::runtime_error"> If the owning list is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 				/// <returns> The altered ConstIterator </returns>
 				ConstIterator& operator++();
 
@@ -247,7 +249,7 @@ namespace FieaGameEngine
 				/// <summary>
 				/// The overloaded dereference operator which retrieves the ConstIterator's node's data
 				/// </summary>
-				/// <exception cref="std::runtime_error"> If the node is null (or = to end()) </exception>
+				/// <exception cref="std::runtime_error"> If the node is null (or = to end()), only when FIEA_DEBUG_ITERATORS is on </exception>
 				/// <returns> The data that the ConstIterator's node points at </returns>
 				const T& operator*() const;
 
@@ -323,6 +325,14 @@ namespace FieaGameEngine
 			/// <remarks> Also sets the new front of the list </remarks>
 			void PopFront();
 
+			/// <summary>
+			/// Unlinks the front node from this list and links it onto the back of the destination list
+			/// </summary>
+			/// <param name="destination"> The list that receives the node </param>
+			/// <remarks> No allocation or copy occurs, so references to the moved element stay valid </remarks>
+			/// <exception cref="std::runtime_error"> If this list is empty </exception>
+			void MoveFrontTo(SList& destination);
+
 			/// <summary>
 			/// Adds a new node to the back of the list
 			/// </summary>
@@ -480,7 +490,7 @@ namespace FieaGameEngine
 			/// </summary>
 			/// <param name="other"> The list used to construct the new list</param>
 			/// <returns> The new, duplicated list </returns>
-			SList<T>& DeepCopyList(const SList& other);
+			SList& DeepCopyList(const SList& other);
 
 			Node* front = nullptr;
 			Node* back = nullptr;
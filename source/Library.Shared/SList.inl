@@ -6,14 +6,14 @@ namespace FieaGameEngine
 {
 #pragma region Node 
 
-	template <typename T>
-	inline SList<T>::Node::Node(const T& new_data, Node* node_next) :
+	template <typename T, typename Allocator>
+	inline SList<T, Allocator>::Node::Node(const T& new_data, Node* node_next) :
 		data(new_data),
 		next(node_next)
 	{}
 
-	template <typename T>
-	inline SList<T>::Node::Node(T&& new_data, Node* node_next) :
+	template <typename T, typename Allocator>
+	inline SList<T, Allocator>::Node::Node(T&& new_data, Node* node_next) :
 		data(std::forward<T>(new_data)),
 		next(node_next)
 	{}
@@ -21,31 +21,33 @@ namespace FieaGameEngine
 #pragma endregion Node
 
 #pragma region Iterator
-	template <typename T>
-	inline SList<T>::Iterator::Iterator(const SList& owner, Node* node) :
+	template <typename T, typename Allocator>
+	inline SList<T, Allocator>::Iterator::Iterator(const SList& owner, Node* node) :
 		owner(&owner), 
 		current(node)
 	{}
 
-	template <typename T>
-	inline bool SList<T>::Iterator::operator==(const Iterator& other) const
+	template <typename T, typename Allocator>
+	inline bool SList<T, Allocator>::Iterator::operator==(const Iterator& other) const
 	{
 		return !(operator!=(other));
 	}
 
-	template <typename T>
-	inline bool SList<T>::Iterator::operator!=(const Iterator& other) const
+	template <typename T, typename Allocator>
+	inline bool SList<T, Allocator>::Iterator::operator!=(const Iterator& other) const
 	{
 		return ((owner != other.owner) || (current != other.current));
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator& SList<T>::Iterator::operator++()
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::Iterator& SList<T, Allocator>::Iterator::operator++()
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("owner shouldn't be null. Is this the correct iterator?");
 		}
+#endif
 
 		if (current != nullptr)
 		{
@@ -55,8 +57,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator SList<T>::Iterator::operator++(int)
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::Iterator SList<T, Allocator>::Iterator::operator++(int)
 	{
 		Iterator temp(*this);
 		operator++();
@@ -64,13 +66,15 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template <typename T>
-	inline T& SList<T>::Iterator::operator*() const
+	template <typename T, typename Allocator>
+	inline T& SList<T, Allocator>::Iterator::operator*() const
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (current == nullptr)
 		{
 			throw std::runtime_error("current shouldn't be null. Is this iterator == end()?");
 		}
+#endif
 
 		return current->data;
 	}
@@ -79,35 +83,37 @@ namespace FieaGameEngine
 
 #pragma region ConstIterator
 
-	template <typename T>
-	inline SList<T>::ConstIterator::ConstIterator(const SList& owner, Node* node) :
+	template <typename T, typename Allocator>
+	inline SList<T, Allocator>::ConstIterator::ConstIterator(const SList& owner, Node* node) :
 		owner(&owner), current(node)
 	{}
 
-	template <typename T>
-	inline SList<T>::ConstIterator::ConstIterator(const Iterator& other) :
+	template <typename T, typename Allocator>
+	inline SList<T, Allocator>::ConstIterator::ConstIterator(const Iterator& other) :
 		owner(other.owner), current(other.current)
 	{}
 
-	template<typename T>
-	inline bool SList<T>::ConstIterator::operator==(const ConstIterator & other) const
+	template <typename T, typename Allocator>
+	inline bool SList<T, Allocator>::ConstIterator::operator==(const ConstIterator & other) const
 	{
 		return !(operator!=(other));
 	}
 
-	template <typename T>
-	inline bool SList<T>::ConstIterator::operator!=(const ConstIterator& other) const
+	template <typename T, typename Allocator>
+	inline bool SList<T, Allocator>::ConstIterator::operator!=(const ConstIterator& other) const
 	{
 		return ((owner != other.owner) || (current != other.current));
 	}
 
-	template <typename T>
-	inline typename SList<T>::ConstIterator& SList<T>::ConstIterator::operator++()
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::ConstIterator& SList<T, Allocator>::ConstIterator::operator++()
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("owner shouldn't be null. Is this the correct iterator?");
 		}
+#endif
 
 		if (current != nullptr)
 		{
@@ -117,8 +123,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	inline typename SList<T>::ConstIterator SList<T>::ConstIterator::operator++(int)
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::ConstIterator SList<T, Allocator>::ConstIterator::operator++(int)
 	{
 		ConstIterator temp(*this);
 		operator++();
@@ -126,13 +132,15 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template <typename T>
-	inline const T& SList<T>::ConstIterator::operator*() const
+	template <typename T, typename Allocator>
+	inline const T& SList<T, Allocator>::ConstIterator::operator*() const
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (current == nullptr)
 		{
 			throw std::runtime_error("current shouldn't be null. Is this iterator == end()?");
 		}
+#endif
 
 		return current->data;
 	}
@@ -141,8 +149,8 @@ namespace FieaGameEngine
 
 #pragma region SList
 
-	template <typename T>
-	inline SList<T>::SList(const SList<T>& other) :
+	template <typename T, typename Allocator>
+	inline SList<T, Allocator>::SList(const SList<T, Allocator>& other) :
 		front(nullptr),
 		back(nullptr),
 		size(0_z)
@@ -150,8 +158,8 @@ namespace FieaGameEngine
 		DeepCopyList(other);
 	}
 
-	template <typename T>
-	inline SList<T>::SList(SList<T>&& other) noexcept : 
+	template <typename T, typename Allocator>
+	inline SList<T, Allocator>::SList(SList<T, Allocator>&& other) noexcept : 
 		front(other.front),
 		back(other.back),
 		size(other.size)
@@ -161,8 +169,8 @@ namespace FieaGameEngine
 		other.size = 0_z;
 	}
 
-	template <typename T>
-	inline SList<T>& SList<T>::operator=(const SList<T>& other)
+	template <typename T, typename Allocator>
+	inline SList<T, Allocator>& SList<T, Allocator>::operator=(const SList<T, Allocator>& other)
 	{
 		if (this != &other)
 		{
@@ -173,8 +181,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	inline SList<T>& SList<T>::operator=(SList<T>&& other) noexcept
+	template <typename T, typename Allocator>
+	inline SList<T, Allocator>& SList<T, Allocator>::operator=(SList<T, Allocator>&& other) noexcept
 	{
 		if (this != &other)
 		{
@@ -192,16 +200,17 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	inline SList<T>::~SList()
+	template <typename T, typename Allocator>
+	inline SList<T, Allocator>::~SList()
 	{
 		Clear();
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator SList<T>::PushFront(const T& other_data)
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::Iterator SList<T, Allocator>::PushFront(const T& other_data)
 	{
-		front = new Node(other_data, front);
+		Allocator allocator{};
+		front = allocator.template Create<Node>(other_data, front);
 
 		if (IsEmpty())
 		{
@@ -213,10 +222,11 @@ namespace FieaGameEngine
 		return begin();
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator SList<T>::PushFront(T&& other_data)
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::Iterator SList<T, Allocator>::PushFront(T&& other_data)
 	{
-		front = new Node(std::forward<T>(other_data), front);
+		Allocator allocator{};
+		front = allocator.template Create<Node>(std::forward<T>(other_data), front);
 
 		if (IsEmpty())
 		{
@@ -228,13 +238,14 @@ namespace FieaGameEngine
 		return begin();
 	}
 
-	template <typename T>
-	inline void SList<T>::PopFront()
+	template <typename T, typename Allocator>
+	inline void SList<T, Allocator>::PopFront()
 	{
 		if (!IsEmpty())
 		{
 			Node* temp_head_next = front->next;
-			delete front;
+			Allocator allocator{};
+			allocator.Destroy(front);
 			front = temp_head_next;
 
 			--size;
@@ -247,11 +258,43 @@ namespace FieaGameEngine
 		}
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator SList<T>::PushBack(const T& other_data)
+	template <typename T, typename Allocator>
+	inline void SList<T, Allocator>::MoveFrontTo(SList& destination)
 	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("front should not be null. Is the list empty?");
+		}
+
+		Node* node = front;
+		front = front->next;
+		--size;
+
+		if (IsEmpty())
+		{
+			back = nullptr;
+		}
+
+		node->next = nullptr;
+		if (destination.IsEmpty())
+		{
+			destination.front = node;
+		}
+		else
+		{
+			destination.back->next = node;
+		}
+
+		destination.back = node;
+		++destination.size;
+	}
+
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::Iterator SList<T, Allocator>::PushBack(const T& other_data)
+	{
+		Allocator allocator{};
 		Node* old_tail = back;
-		back = new Node(other_data);
+		back = allocator.template Create<Node>(other_data);
 		if (IsEmpty())
 		{
 			front = back;
@@ -266,11 +309,12 @@ namespace FieaGameEngine
 		return Iterator(*this, back);
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator SList<T>::PushBack(T&& other_data)
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::Iterator SList<T, Allocator>::PushBack(T&& other_data)
 	{
+		Allocator allocator{};
 		Node* old_tail = back;
-		back = new Node(std::forward<T>(other_data), nullptr);
+		back = allocator.template Create<Node>(std::forward<T>(other_data), nullptr);
 		if (IsEmpty())
 		{
 			front = back;
@@ -285,14 +329,14 @@ namespace FieaGameEngine
 		return Iterator(*this, back);
 	}
 
-	template <typename T>
-	inline bool SList<T>::IsEmpty() const
+	template <typename T, typename Allocator>
+	inline bool SList<T, Allocator>::IsEmpty() const
 	{
 		return (size == 0_z);
 	}
 
-	template <typename T>
-	inline T& SList<T>::Front()
+	template <typename T, typename Allocator>
+	inline T& SList<T, Allocator>::Front()
 	{
 		if (front == nullptr)
 		{
@@ -301,8 +345,8 @@ namespace FieaGameEngine
 		return front->data;
 	}
 
-	template <typename T>
-	inline const T& SList<T>::Front() const
+	template <typename T, typename Allocator>
+	inline const T& SList<T, Allocator>::Front() const
 	{
 		if (front == nullptr)
 		{
@@ -311,8 +355,8 @@ namespace FieaGameEngine
 		return front->data;
 	}
 
-	template <typename T>
-	inline T& SList<T>::Back()
+	template <typename T, typename Allocator>
+	inline T& SList<T, Allocator>::Back()
 	{
 		if (back == nullptr)
 		{
@@ -321,8 +365,8 @@ namespace FieaGameEngine
 		return back->data;
 	}
 
-	template <typename T>
-	inline const T& SList<T>::Back() const
+	template <typename T, typename Allocator>
+	inline const T& SList<T, Allocator>::Back() const
 	{
 		if (back == nullptr)
 		{
@@ -331,93 +375,95 @@ namespace FieaGameEngine
 		return back->data;
 	}
 
-	template <typename T>
-	inline size_t SList<T>::Size() const
+	template <typename T, typename Allocator>
+	inline size_t SList<T, Allocator>::Size() const
 	{
 		return size;
 	}
 
-	template <typename T>
-	inline void SList<T>::Clear()
+	template <typename T, typename Allocator>
+	inline void SList<T, Allocator>::Clear()
 	{
+		Allocator allocator{};
 		Node* currentNode = front;
 		while (currentNode != nullptr)
 		{
 			Node* nodeToDelete = currentNode;
 			currentNode = currentNode->next;
-			delete nodeToDelete;
+			allocator.Destroy(nodeToDelete);
 		}
 
 		size = 0_z;
 		front = back = nullptr;
 	}
 
-	template <typename T>
-	void SList<T>::PopBack()
+	template <typename T, typename Allocator>
+	void SList<T, Allocator>::PopBack()
 	{
 		if (!IsEmpty())
 		{
-			Node* temp_pre_tail = front;
+			Allocator allocator{};
 
-			if (size != 1)
+			if (size == 1)
+			{
+				allocator.Destroy(back);
+				front = back = nullptr;
+			}
+			else
 			{
+				Node* temp_pre_tail = front;
 				while (temp_pre_tail->next->next != nullptr)
 				{
 					temp_pre_tail = temp_pre_tail->next;
 				}
-			}
 
-			delete back;
-			temp_pre_tail->next = nullptr;
-			back = temp_pre_tail;
+				allocator.Destroy(back);
+				temp_pre_tail->next = nullptr;
+				back = temp_pre_tail;
+			}
 
 			--size;
-
-			if (IsEmpty())
-			{
-				front = nullptr;
-			}
 		}
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::begin()
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::Iterator SList<T, Allocator>::begin()
 	{
 		return Iterator(*this, front);
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::end()
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::Iterator SList<T, Allocator>::end()
 	{
 		return Iterator(*this, nullptr);
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::begin() const
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::ConstIterator SList<T, Allocator>::begin() const
 	{
 		return ConstIterator(*this, front);
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::cbegin() const
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::ConstIterator SList<T, Allocator>::cbegin() const
 	{
 		return ConstIterator(*this, front);
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::end() const
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::ConstIterator SList<T, Allocator>::end() const
 	{
 		return ConstIterator(*this, nullptr);
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::cend() const
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::ConstIterator SList<T, Allocator>::cend() const
 	{
 		return ConstIterator(*this, nullptr);
 	}
 
-	template <typename T>
-	inline SList<T>& SList<T>::DeepCopyList(const SList<T>& other)
+	template <typename T, typename Allocator>
+	inline SList<T, Allocator>& SList<T, Allocator>::DeepCopyList(const SList<T, Allocator>& other)
 	{
 		for (const T& value : other)
 		{
@@ -427,8 +473,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator SList<T>::InsertAfter(const T& other_data, const Iterator& it)
+	template <typename T, typename Allocator>
+	inline typename SList<T, Allocator>::Iterator SList<T, Allocator>::InsertAfter(const T& other_data, const Iterator& it)
 	{
 		if (it.owner != this)
 		{
@@ -440,16 +486,17 @@ namespace FieaGameEngine
 			return PushBack(other_data);
 		}
 
-		Node* node = new Node(other_data, it.current->next);
+		Allocator allocator{};
+		Node* node = allocator.template Create<Node>(other_data, it.current->next);
 		it.current->next = node;
 		++size;
 
 		return Iterator(*this, node);
 	}
 
-	template <typename T>
+	template <typename T, typename Allocator>
 	template <typename EqualityFunctor>
-	inline typename SList<T>::Iterator SList<T>::Find(const T& value)
+	inline typename SList<T, Allocator>::Iterator SList<T, Allocator>::Find(const T& value)
 	{
 		EqualityFunctor eq{};
 
@@ -465,22 +512,22 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template <typename T>
+	template <typename T, typename Allocator>
 	template <typename EqualityFunctor>
-	inline typename SList<T>::ConstIterator SList<T>::Find(const T& value) const
+	inline typename SList<T, Allocator>::ConstIterator SList<T, Allocator>::Find(const T& value) const
 	{
 		return const_cast<SList*>(this)->Find<EqualityFunctor>(value);
 	}
 
-	template <typename T>
+	template <typename T, typename Allocator>
 	template <typename EqualityFunctor>
-	inline bool SList<T>::Remove(const T& value)
+	inline bool SList<T, Allocator>::Remove(const T& value)
 	{
 		return Remove(Find<EqualityFunctor>(value));
 	}
 
-	template <typename T>
-	inline bool SList<T>::Remove(const Iterator& it)
+	template <typename T, typename Allocator>
+	inline bool SList<T, Allocator>::Remove(const Iterator& it)
 	{
 		if (it.owner != this)
 		{
@@ -502,7 +549,8 @@ namespace FieaGameEngine
 				it.current->data.~T();
 				new(&it.current->data)T(std::move(node_to_delete->data));
 				it.current->next = node_to_delete->next;
-				delete node_to_delete;
+				Allocator allocator{};
+				allocator.Destroy(node_to_delete);
 
 				if (it.current->next == nullptr)
 				{
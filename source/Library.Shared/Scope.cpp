@@ -1,18 +1,67 @@
 #include "pch.h"
 #include "Scope.h"
+#include "ScopeSlab.h"
+#include <algorithm>
+#include <bit>
+
+#if defined(__SSE2__) && defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#define SCOPE_SSE2 1
+#include <emmintrin.h>
+#endif
 
 namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Scope)
 
+	size_t Scope::latest_generation = 0_z;
+
+	namespace
+	{
+		// Smallest lookup table built once a scope outgrows Scope::SmallScopeSize
+		constexpr size_t MinimumLookupSize = 32;
+
+		/// <summary>
+		/// Compares a key hash against the first SmallScopeSize hashes of a scope
+		/// </summary>
+		/// <param name="hashes"> The hashes to compare, readable for SmallScopeSize elements even if fewer are in use </param>
+		/// <param name="hash"> The hash to search for </param>
+		/// <returns> A mask with bit i set when hashes[i] matches </returns>
+		template <size_t Count>
+		uint32_t MatchHashes(const size_t* hashes, const size_t hash)
+		{
+			uint32_t matches = 0;
+#ifdef SCOPE_SSE2
+			// SSE2 has no 64 bit compare, so both 32 bit halves have to match
+			const __m128i needle = _mm_set1_epi64x(static_cast<long long>(hash));
+			for (size_t index = 0; index < Count; index += 2)
+			{
+				__m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hashes + index)), needle);
+				equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+				matches |= static_cast<uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(equal))) << index;
+			}
+#else
+			for (size_t index = 0; index < Count; ++index)
+			{
+				matches |= static_cast<uint32_t>(hashes[index] == hash) << index;
+			}
+#endif
+			return matches;
+		}
+	}
+
 #pragma region RuleOf6
 
 	Scope::Scope(const size_t initial_capacity) :
-		order(initial_capacity)
+		entries(initial_capacity), hashes(initial_capacity)
 	{
+		if (initial_capacity > SmallScopeSize)
+		{
+			RebuildLookup(std::bit_ceil(std::max(initial_capacity * 2_z, MinimumLookupSize)));
+		}
 	}
 
-	Scope::Scope(const Scope& other)
+	Scope::Scope(const Scope& other) :
+		Scope()
 	{
 		DeepCopyScope(other);
 	}
@@ -53,13 +102,61 @@ namespace FieaGameEngine
 
 	Datum* Scope::Find(const std::string& entry)
 	{
-		auto datum = map.Find(entry);
-		if (datum == map.end())
+		return Find(entry, DefaultHash<std::string>{}(entry));
+	}
+
+	Datum* Scope::Find(const std::string& entry, const size_t hash)
+	{
+		const size_t entry_index = FindEntry(entry, hash);
+		return (entry_index < entries.Size()) ? &entries[entry_index].second : nullptr;
+	}
+
+	size_t Scope::FindEntry(const std::string& entry, const size_t hash) const
+	{
+		if (!lookup.IsEmpty())
+		{
+			return FindIndexed(entry, hash);
+		}
+
+		const size_t size = entries.Size();
+		if (size == 0_z)
+		{
+			return size;
+		}
+
+		uint32_t matches = MatchHashes<SmallScopeSize>(hashes.Data(), hash) & ((1u << size) - 1u);
+		while (matches != 0u)
+		{
+			const size_t entry_index = static_cast<size_t>(std::countr_zero(matches));
+			if (entries[entry_index].first == entry)
+			{
+				return entry_index;
+			}
+
+			matches &= matches - 1u;
+		}
+
+		return size;
+	}
+
+	size_t Scope::FindIndexed(const std::string& entry, const size_t hash) const
+	{
+		const size_t mask = lookup.Size() - 1_z;
+		for (size_t slot = hash & mask; lookup[slot] != 0u; slot = (slot + 1_z) & mask)
 		{
-			return nullptr;
+			const size_t entry_index = lookup[slot] - 1_z;
+			if (hashes[entry_index] == hash && entries[entry_index].first == entry)
+			{
+				return entry_index;
+			}
 		}
 
-		return &datum->second;
+		return entries.Size();
+	}
+
+	const Datum* Scope::Find(const std::string& entry, const size_t hash) const
+	{
+		return const_cast<Scope*>(this)->Find(entry, hash);
 	}
 
 	const Datum* Scope::Find(const std::string& entry) const
@@ -69,11 +166,40 @@ namespace FieaGameEngine
 
 	std::tuple<Datum*, Scope*> Scope::Search(const std::string& entry)
 	{
-		Datum* found = Find(entry);
+		return Search(entry, DefaultHash<std::string>{}(entry), nullptr);
+	}
 
-		if (found)
+	const std::tuple<Datum*, Scope*> Scope::Search(const std::string& entry) const
+	{
+		return const_cast<Scope*>(this)->Search(entry);
+	}
+
+	Datum* Scope::Find(const Atom& entry)
+	{
+		return Find(entry.String(), entry.Hash());
+	}
+
+	const Datum* Scope::Find(const Atom& entry) const
+	{
+		return const_cast<Scope*>(this)->Find(entry);
+	}
+
+	std::tuple<Datum*, Scope*> Scope::Search(const Atom& entry)
+	{
+		return Search(entry.String(), entry.Hash(), &entry);
+	}
+
+	const std::tuple<Datum*, Scope*> Scope::Search(const Atom& entry) const
+	{
+		return const_cast<Scope*>(this)->Search(entry);
+	}
+
+	std::tuple<Datum*, Scope*> Scope::Search(const std::string& entry, const size_t hash, const Atom* interned)
+	{
+		Datum* local = Find(entry, hash);
+		if (local != nullptr)
 		{
-			return std::make_tuple(found, this);
+			return std::make_tuple(local, this);
 		}
 
 		if (parent == nullptr)
@@ -81,30 +207,90 @@ namespace FieaGameEngine
 			return std::make_tuple(nullptr, nullptr);
 		}
 
-		return parent->Search(entry);
+		if (ancestor_cache == nullptr)
+		{
+			ancestor_cache = new AncestorCacheType();
+		}
+
+		// Searches through an atom pass the interned string itself, so the key compare is usually an address compare
+		AncestorResult& cached = (*ancestor_cache)[hash % AncestorCacheSize];
+		const std::string& cached_key = cached.key.String();
+		const bool same_key = (cached.key.Hash() == hash) && (&cached_key == &entry || cached_key == entry);
+		if (same_key && IsUnchangedSince(cached.generation, cached.scope))
+		{
+			return std::make_tuple(cached.datum, cached.scope);
+		}
+
+		std::tuple<Datum*, Scope*> result(nullptr, nullptr);
+		for (Scope* scope = parent; scope != nullptr; scope = scope->parent)
+		{
+			Datum* found = scope->Find(entry, hash);
+			if (found != nullptr)
+			{
+				result = std::make_tuple(found, scope);
+				break;
+			}
+		}
+
+		if (!same_key)
+		{
+			cached.key = (interned != nullptr) ? *interned : Atom(entry);
+		}
+
+		std::tie(cached.datum, cached.scope) = result;
+		cached.generation = latest_generation;
+
+		return result;
 	}
 
-	const std::tuple<Datum*, Scope*> Scope::Search(const std::string& entry) const
+	bool Scope::IsUnchangedSince(const size_t since, const Scope* ancestor) const
 	{
-		return const_cast<Scope*>(this)->Search(entry);
+		for (const Scope* scope = this; scope != nullptr; scope = scope->parent)
+		{
+			if (scope->generation > since)
+			{
+				return false;
+			}
+
+			if (scope == ancestor)
+			{
+				return true;
+			}
+		}
+
+		return (ancestor == nullptr);
 	}
 
 	Datum& Scope::Append(const std::string& entry, bool& entry_created)
+	{
+		return Append(entry, DefaultHash<std::string>{}(entry), entry_created);
+	}
+
+	Datum& Scope::Append(const std::string& entry, const size_t hash, bool& entry_created)
+	{
+		return entries[AppendEntry(entry, hash, entry_created)].second;
+	}
+
+	size_t Scope::AppendEntry(const std::string& entry, const size_t hash, bool& entry_created)
 	{
 		if (entry.empty())
 		{
 			throw std::invalid_argument("The key is equivalent to the empty string.");
 		}
 
-		auto [was_inserted, hash_iterator] = map.Insert(ScopePairType(entry, Datum(Datum::DatumTypes::Unknown)));
-		HashMap<std::string, Datum>::PairType& pair = *hash_iterator;
-		entry_created = was_inserted;
-		if (entry_created)
+		const size_t found = FindEntry(entry, hash);
+		entry_created = (found == entries.Size());
+		if (!entry_created)
 		{
-			order.PushBack(&pair);
+			return found;
 		}
 
-		return pair.second;
+		entries.EmplaceBack(entry, Datum(Datum::DatumTypes::Unknown));
+		hashes.PushBack(hash);
+		IndexEntry(found);
+		MarkChanged();
+
+		return found;
 	}
 
 	Datum& Scope::Append(const std::string& entry)
@@ -113,29 +299,28 @@ namespace FieaGameEngine
 		return Append(entry, entry_created);
 	}
 
-	Scope& Scope::AppendScope(const std::string& entry)
+	Datum& Scope::Append(const Atom& entry)
 	{
-		if (entry.empty())
-		{
-			throw std::invalid_argument("The key is equivalent to the empty string.");
-		}
+		bool entry_created;
+		return Append(entry.String(), entry.Hash(), entry_created);
+	}
 
-		auto [was_inserted, hash_iterator] = map.Insert(ScopePairType(entry, Datum(Datum::DatumTypes::Table)));
-		if (!was_inserted)
+	Scope& Scope::AppendScope(const std::string& entry)
+	{
+		bool entry_created;
+		const size_t entry_index = AppendEntry(entry, DefaultHash<std::string>{}(entry), entry_created);
+		Datum& datum = entries[entry_index].second;
+		if (entry_created)
 		{
-			if (hash_iterator->second.Type() != Datum::DatumTypes::Table)
-			{
-				throw std::runtime_error("Item exists but not of type scope.");
-			}
+			datum.SetType(Datum::DatumTypes::Table);
 		}
-		else
+		else if (datum.Type() != Datum::DatumTypes::Table)
 		{
-			order.PushBack(&(*hash_iterator));
+			throw std::runtime_error("Item exists but not of type scope.");
 		}
 
-		Scope* child = new Scope();
-		child->parent = this;
-		hash_iterator->second.PushBack(*child);
+		Scope* child = (slab != nullptr) ? &slab->Create() : new Scope();
+		AttachChild(*child, entry_index);
 
 		return *child;
 	}
@@ -157,27 +342,56 @@ namespace FieaGameEngine
 			throw std::invalid_argument("The key is equivalent to the empty string");
 		}
 
-		auto [was_inserted, hash_iterator] = map.Insert(ScopePairType(entry, Datum(Datum::DatumTypes::Table)));
-		if (!was_inserted)
+		bool entry_created;
+		const size_t entry_index = AppendEntry(entry, DefaultHash<std::string>{}(entry), entry_created);
+		Datum& datum = entries[entry_index].second;
+		if (entry_created)
 		{
-			// Already in map
-			if (hash_iterator->second.Type() != Datum::DatumTypes::Table)
-			{
-				throw std::runtime_error("The datum found is not of type Table");
-			}
+			datum.SetType(Datum::DatumTypes::Table);
 		}
-		else
+		else if (datum.Type() != Datum::DatumTypes::Table)
 		{
-			order.PushBack(&(*hash_iterator));
+			throw std::runtime_error("The datum found is not of type Table");
 		}
 
 		child.Orphan();
-		hash_iterator->second.PushBack(child);
+		AttachChild(child, entry_index);
+	}
+
+	void Scope::AttachChild(Scope& child, const size_t entry_index)
+	{
+		assert(child.parent == nullptr);
+		Datum& datum = entries[entry_index].second;
 		child.parent = this;
+		child.parent_entry = entry_index;
+		child.parent_index = datum.Size();
+		child.MarkChanged();
+		datum.PushBack(child);
 	}
 
 	std::tuple<Datum*, size_t> Scope::FindContainedScope(const Scope& other) const
 	{
+		if (other.parent == this && other.parent_entry < entries.Size())
+		{
+			// The recorded index is exact unless the datum was edited without going through this scope, e.g. by Datum::RemoveAt.
+			// Then only the datum's addresses are scanned, the siblings themselves aren't touched
+			Datum& datum = const_cast<Datum&>(entries[other.parent_entry].second);
+			if (datum.Type() == Datum::DatumTypes::Table)
+			{
+				if (other.parent_index < datum.Size() && &datum.Get<Scope>(other.parent_index) == &other)
+				{
+					return { &datum, other.parent_index };
+				}
+
+				const size_t index = datum.IndexOf(other);
+				if (index < datum.Size())
+				{
+					return { &datum, index };
+				}
+			}
+		}
+
+		// The datum was edited without going through this scope
 		size_t index = std::numeric_limits<size_t>::max();
 		Datum* found_datum = nullptr;
 		ForEachNestedScopeIn([&other, &index, &found_datum](const Scope&, Datum& datum, size_t datum_index)
@@ -201,19 +415,36 @@ namespace FieaGameEngine
 
 		ForEachNestedScopeIn([](const Scope& _parent, Datum& datum, size_t datum_index)
 		{
-			_parent;
+			UNREFERENCED_LOCAL(_parent);
 			Scope& scope = datum.Get<Scope>(datum_index);
 #ifdef DEBUG
 			assert(scope.parent == &_parent);
 #endif
 
 			scope.parent = nullptr;
-			delete &scope;
+			Destroy(scope);
 			return false;
 		});
 
-		order.Clear();
-		map.Clear();
+		entries.Clear();
+		hashes.Clear();
+		lookup.Clear();
+		MarkChanged();
+
+		delete ancestor_cache;
+		ancestor_cache = nullptr;
+	}
+
+	void Scope::Destroy(Scope& scope)
+	{
+		if (scope.slab != nullptr)
+		{
+			scope.slab->Destroy(scope);
+		}
+		else
+		{
+			delete &scope;
+		}
 	}
 
 	bool Scope::Equals(const RTTI* rhs) const
@@ -225,17 +456,18 @@ namespace FieaGameEngine
 			return false;
 		}
 
-		const size_t size = order.Size();
+		const size_t size = entries.Size();
 		if (size == other->Size())
 		{
 			for (size_t index = 0; index < size; ++index)
 			{
-				if (order[index]->first == "this")
+				const ScopePairType& pair = entries[index];
+				if (pair.first == "this")
 				{
 					continue;
 				}
 
-				if (*order[index] != *other->order[index])
+				if (pair != other->entries[index])
 				{
 					return false;
 				}
@@ -253,8 +485,17 @@ namespace FieaGameEngine
 		{
 			auto [datum, index] = parent->FindContainedScope(*this);
 			assert(datum != nullptr);
+
+			// Siblings behind this one shift down a slot, so actions and entities keep running in the order they were added.
+			// That makes removal linear in the siblings after this one, which get their recorded index moved down with them
 			datum->RemoveAt(index);
+			for (size_t sibling = index; sibling < datum->Size(); ++sibling)
+			{
+				datum->Get<Scope>(sibling).parent_index = sibling;
+			}
+
 			parent = nullptr;
+			MarkChanged();
 		}
 	}
 
@@ -279,11 +520,54 @@ namespace FieaGameEngine
 		return false;
 	}
 
+	void Scope::IndexEntry(const size_t entry_index)
+	{
+		const size_t size = entry_index + 1_z;
+		if (lookup.IsEmpty() && size <= SmallScopeSize)
+		{
+			return;
+		}
+
+		// Kept at most half full so probes stay short
+		if (size * 2_z > lookup.Size())
+		{
+			RebuildLookup(std::bit_ceil(std::max(size * 2_z, MinimumLookupSize)));
+			return;
+		}
+
+		const size_t mask = lookup.Size() - 1_z;
+		size_t slot = hashes[entry_index] & mask;
+		while (lookup[slot] != 0u)
+		{
+			slot = (slot + 1_z) & mask;
+		}
+
+		lookup[slot] = static_cast<uint32_t>(size);
+	}
+
+	void Scope::RebuildLookup(const size_t slot_count)
+	{
+		lookup.Clear();
+		lookup.Resize(slot_count);
+
+		const size_t mask = slot_count - 1_z;
+		for (size_t entry_index = 0_z; entry_index < entries.Size(); ++entry_index)
+		{
+			size_t slot = hashes[entry_index] & mask;
+			while (lookup[slot] != 0u)
+			{
+				slot = (slot + 1_z) & mask;
+			}
+
+			lookup[slot] = static_cast<uint32_t>(entry_index + 1_z);
+		}
+	}
+
 	void Scope::ForEachNestedScopeIn(NestedScopeFunction func) const
 	{
-		for (const auto& pair : order)
+		for (ScopePairType& pair : const_cast<SegmentedVector<ScopePairType>&>(entries))
 		{
-			Datum& datum = pair->second;
+			Datum& datum = pair.second;
 			if (datum.Type() == Datum::DatumTypes::Table)
 			{
 				for (size_t datum_index = 0_z; datum_index < datum.Size(); ++datum_index)
@@ -299,15 +583,21 @@ namespace FieaGameEngine
 
 	void Scope::MoveScope(Scope&& other)
 	{
-		order = std::move(other.order);
-		map = std::move(other.map);
+		entries = std::move(other.entries);
+		hashes = std::move(other.hashes);
+		lookup = std::move(other.lookup);
 		parent = other.parent;
+		parent_entry = other.parent_entry;
+		parent_index = other.parent_index;
+		MarkChanged();
+		other.MarkChanged();
 
 		if (other.parent)
 		{
 			auto [datum, index] = other.parent->FindContainedScope(other);
 			assert(datum != nullptr);
 			datum->SetScope(*this, index);
+			parent_index = index;
 			other.parent = nullptr;
 		}
 
@@ -315,33 +605,53 @@ namespace FieaGameEngine
 		{
 			Scope& child = datum.Get<Scope>(datum_index);
 			child.parent = this;
+			child.MarkChanged();
 			return false;
 		});
 	}
 
 	void Scope::DeepCopyScope(const Scope& other)
 	{
-		for (auto const& element : other.order)
+		// Only ever fills an empty scope, so the keys can't collide and the lookup table carries over as is
+		assert(entries.IsEmpty());
+		entries.Reserve(other.entries.Size());
+		hashes.Reserve(other.hashes.Size());
+		lookup = other.lookup;
+
+		for (size_t index = 0_z; index < other.entries.Size(); ++index)
 		{
-			auto &[key, existingDatum] = *element;
-			Datum& newDatum = Append(key);
+			const ScopePairType& pair = other.entries[index];
+			const Datum& existingDatum = pair.second;
+			hashes.PushBack(other.hashes[index]);
 
 			if (existingDatum.Type() == Datum::DatumTypes::Table)
 			{
-				newDatum.SetType(Datum::DatumTypes::Table);
-				newDatum.Reserve(existingDatum.Size());
-
+				entries.EmplaceBack(pair.first, Datum(Datum::DatumTypes::Table)).second.Reserve(existingDatum.Size());
 				for (size_t i = 0_z; i < existingDatum.Size(); ++i)
 				{
-					Scope* newScope = existingDatum.Get<Scope>(i).Clone();
-					newScope->parent = this;
-					newDatum.PushBack(*newScope);
+					AttachChild(*CopyNestedScope(existingDatum.Get<Scope>(i)), index);
 				}
 			}
 			else
 			{
-				newDatum = existingDatum;
+				// Shares the other datum's array until either scope writes to it
+				entries.PushBack(pair);
 			}
 		}
+
+		MarkChanged();
+	}
+
+	Scope* Scope::CopyNestedScope(const Scope& child) const
+	{
+		// Derived classes only know how to clone themselves onto the heap
+		if (slab == nullptr || child.TypeIdInstance() != Scope::TypeIdClass())
+		{
+			return child.Clone();
+		}
+
+		Scope& copy = slab->Create();
+		copy.DeepCopyScope(child);
+		return &copy;
 	}
 }
\ No newline at end of file
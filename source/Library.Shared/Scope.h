@@ -2,24 +2,33 @@
 
 #include "RTTI.h"
 #include "Vector.h"
+#include "SegmentedVector.h"
+#include "SmallVector.h"
 #include "HashMap.h"
 #include "Datum.h"
+#include "Atom.h"
 #include "Factory.h"
+#include <array>
 #include <gsl/gsl>
 
 namespace FieaGameEngine
 {
+	class ScopeSlab;
+
 	/// <summary>
 	/// A class which defines a non-templated scope which is simply a string, datum pair which 
 	/// can be used to refer to tables of data
 	/// parent refers to this scope's parent
-	/// map refers an unordered map of all of elements that's appended to the scope
-	/// order refers an ordered vector ofall of elements that's appended to the scope
+	/// entries refers to all of the elements appended to the scope, in the order they were appended. They never move, so a Datum&
+	/// stays valid until the scope is cleared or destroyed, however many entries are appended after it
+	/// lookup refers to an index table over the entries, only built once the scope outgrows SmallScopeSize
 	/// </summary>
 	class Scope : public RTTI
 	{
 		RTTI_DECLARATIONS(Scope, RTTI)
 
+		friend class ScopeSlab;
+
 	public:
 		using ScopePairType = std::pair<const std::string, Datum>;
 
@@ -65,8 +74,8 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Queries the vectors size
 		/// </summary>
-		/// <returns> The amount of elements present in the order vector </returns>
-		size_t Size() const { return order.Size(); }
+		/// <returns> The amount of elements present in the scope </returns>
+		size_t Size() const { return entries.Size(); }
 
 		/// <summary>
 		/// Determines if an element is in the current scope or not based on the key parameter
@@ -83,10 +92,27 @@ namespace FieaGameEngine
 		/// <returns> The datum pointer at that specific key </returns>
 		const Datum* Find(const std::string& entry) const;
 
+		/// <summary>
+		/// Determines if an element is in the current scope or not based on the interned key parameter
+		/// </summary>
+		/// <param name="entry"> The interned key to search for </param>
+		/// <remarks> Uses the atom's cached hash instead of hashing the key again </remarks>
+		/// <returns> The datum pointer at that specific key </returns>
+		Datum* Find(const Atom& entry);
+
+		/// <summary>
+		/// Determines if an element is in the current scope or not based on the interned key parameter
+		/// </summary>
+		/// <param name="entry"> The interned key to search for </param>
+		/// <remarks> Specifically the const version of the non-const Find() </remarks>
+		/// <returns> The datum pointer at that specific key </returns>
+		const Datum* Find(const Atom& entry) const;
+
 		/// <summary>
 		/// Determines if an element is in the current scope or any of its parents based on the key parameter
 		/// </summary>
 		/// <param name="entry"> The key to search for</param>
+		/// <remarks> Results found in ancestors are cached in this scope until a scope on the searched path changes structure, see IsUnchangedSince() </remarks>
 		/// <returns> A tuple that contains the datum pointer at the key and a pointer to the scope it was found in </returns>
 		std::tuple<Datum*, Scope*> Search(const std::string& entry);
 		
@@ -99,7 +125,23 @@ namespace FieaGameEngine
 		const std::tuple<Datum*, Scope*> Search(const std::string& entry) const;
 
 		/// <summary>
-		/// Adds an element to the hashmap. If that element doesn't exist, also add it to the order vector
+		/// Determines if an element is in the current scope or any of its parents based on the interned key parameter
+		/// </summary>
+		/// <param name="entry"> The interned key to search for </param>
+		/// <remarks> The key is hashed once for the whole parent chain rather than once per scope </remarks>
+		/// <returns> A tuple that contains the datum pointer at the key and a pointer to the scope it was found in </returns>
+		std::tuple<Datum*, Scope*> Search(const Atom& entry);
+
+		/// <summary>
+		/// Determines if an element is in the current scope or any of its parents based on the interned key parameter
+		/// </summary>
+		/// <param name="entry"> The interned key to search for </param>
+		/// <remarks> Specifically the const version of the non-const Search() </remarks>
+		/// <returns> A tuple that contains the datum pointer at the key and a pointer to the scope it was found in </returns>
+		const std::tuple<Datum*, Scope*> Search(const Atom& entry) const;
+
+		/// <summary>
+		/// Adds an element to the end of the scope if that element doesn't exist yet
 		/// Creates a datum that has an unknown type
 		/// </summary>
 		/// <param name="entry"> The key to append </param>
@@ -108,7 +150,7 @@ namespace FieaGameEngine
 		Datum& Append(const std::string& entry);
 
 		/// <summary>
-		/// Adds an element to the hashmap. If that element doesn't exist, also add it to the order vector
+		/// Adds an element to the end of the scope if that element doesn't exist yet
 		/// Creates a datum that has an unknown type
 		/// </summary>
 		/// <param name="entry"> The key to append </param>
@@ -116,9 +158,19 @@ namespace FieaGameEngine
 		/// <exception cref="std::invalid_argument"> If the key is the empty string </exception>
 		/// <returns> A Datum with type unknown (the value in the pair) </returns>
 		Datum& Append(const std::string& entry, bool& entry_created);
+
+		/// <summary>
+		/// Adds an element to the end of the scope if that element doesn't exist yet
+		/// Creates a datum that has an unknown type
+		/// </summary>
+		/// <param name="entry"> The interned key to append </param>
+		/// <remarks> Uses the atom's hash, so the key is never hashed again </remarks>
+		/// <exception cref="std::invalid_argument"> If the key is the empty string or the null atom </exception>
+		/// <returns> A Datum with type unknown (the value in the pair) </returns>
+		Datum& Append(const Atom& entry);
 		
 		/// <summary>
-		/// Adds an element to the hashmap. If that element doesn't exist, also add it to the order vector
+		/// Adds an element to the end of the scope if that element doesn't exist yet
 		/// Creates a datum that has a type Table
 		/// Childs a scope to this scope (must be created here)
 		/// </summary>
@@ -128,7 +180,7 @@ namespace FieaGameEngine
 		Scope& AppendScope(const std::string& entry);
 
 		/// <summary>
-		/// Adds an element to the hashmap. If that element doesn't exist, also add it to the order vector
+		/// Adds an element to the end of the scope if that element doesn't exist yet
 		/// Creates a datum that has a type Table
 		/// Childs a scope to this scope (parameterized)
 		/// </summary>
@@ -145,27 +197,47 @@ namespace FieaGameEngine
 		/// <returns> The parent pointer </returns>
 		Scope* GetParent() const { return parent; }
 
+		/// <summary>
+		/// Queries the slab this scope was created in
+		/// </summary>
+		/// <remarks> Scopes appended to (or deep copied into) a scope owned by a slab are created in the same slab </remarks>
+		/// <returns> The owning slab, or nullptr if the scope wasn't created by one </returns>
+		ScopeSlab* Slab() const { return slab; }
+
+		/// <summary>
+		/// Destroys a scope and frees it the way it was allocated, on the heap or in its slab
+		/// </summary>
+		/// <param name="scope"> The scope to destroy, which is orphaned first </param>
+		static void Destroy(Scope& scope);
+
 		/// <summary>
 		/// Wrapper for Append() for convenient syntax
 		/// </summary>
 		/// <param name="entry"> The key to append </param>
 		/// <returns> A Datum with type unknown (the value in the pair) </returns>
 		Datum& operator[](const std::string& entry) { return Append(entry); }
+
+		/// <summary>
+		/// Wrapper for Append() for convenient syntax
+		/// </summary>
+		/// <param name="entry"> The interned key to append </param>
+		/// <returns> A Datum with type unknown (the value in the pair) </returns>
+		Datum& operator[](const Atom& entry) { return Append(entry); }
 		
 		/// <summary>
-		/// Queries the order vector and returns the value associated with the key at that index
+		/// Queries the entries in order and returns the value associated with the key at that index
 		/// </summary>
 		/// <param name="index"> The index to query into the vector </param>
-		/// <returns> The value at the index of the order vector </returns>
-		Datum& operator[](const uint32_t index) { return order[index]->second; }
+		/// <returns> The value of the entry at the index </returns>
+		Datum& operator[](const uint32_t index) { return entries[index].second; }
 		
 		/// <summary>
-		/// Queries the order vector and returns the value associated with the key at that index
+		/// Queries the entries in order and returns the value associated with the key at that index
 		/// </summary>
 		/// <param name="index"> The index to query into the vector </param>
 		/// <remarks> Specifically the const version of the non-const operator[] </remarks>
-		/// <returns> The value at the index of the order vector </returns>
-		const Datum& operator[](const uint32_t index) const { return order[index]->second; }
+		/// <returns> The value of the entry at the index </returns>
+		const Datum& operator[](const uint32_t index) const { return entries[index].second; }
 
 		/// <summary>
 		/// Determines if two Scopes are identical; wraps the overridden Equals method
@@ -186,6 +258,7 @@ namespace FieaGameEngine
 		/// Finds the parameterized scope within the current scope by going down to its children scopes and searching 
 		/// </summary>
 		/// <param name="other"> The scope to find </param>
+		/// <remarks> A direct child is found through the slot it recorded when it was parented, or by scanning that one datum if an earlier sibling was orphaned since. Anything else falls back to searching every table </remarks>
 		/// <returns> A tuple which contains the datum (of type Table) which refers to the other scope, and the index of that datum </returns>
 		std::tuple<Datum*, size_t> FindContainedScope(const Scope& other) const;
 
@@ -205,7 +278,8 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// Removes the scope at the current index and removes the reference to the parent
-		/// <remarks> This does not reparent this scope, only removes it from its parent </remarks>
+		/// <remarks> This does not reparent this scope, only removes it from its parent. The siblings after it in the same datum shift down, so their order is preserved </remarks>
+		/// <remarks> Finding this scope in its parent is constant time, but the shift is linear in the siblings after it. Removing the most recently added child first is constant time </remarks>
 		/// </summary>
 		void Orphan();
 
@@ -230,10 +304,145 @@ namespace FieaGameEngine
 		/// <returns> A pointer to the new heap allocated scope, meant to be deleted by the caller </returns>
 		virtual gsl::owner<Scope*> Clone() const { return new Scope(*this); }
 
+		/// <summary>
+		/// Queries the newest structural generation handed out to any scope
+		/// </summary>
+		/// <remarks> A scope is stamped with a new generation whenever it's created, gains or loses an entry or changes parents </remarks>
+		/// <returns> The current generation </returns>
+		static size_t Generation() { return latest_generation; }
+
+		/// <summary>
+		/// Determines if neither this scope nor any of its ancestors up to the given one changed structure after a generation
+		/// </summary>
+		/// <param name="since"> A value previously returned by Generation() </param>
+		/// <param name="ancestor"> The last scope checked, this scope or one of its ancestors. Null checks every ancestor up to the root </param>
+		/// <remarks> A Search made at that generation which found its entry in ancestor, or missed when ancestor is null, still gives the same result while this holds </remarks>
+		/// <returns> False if any of those scopes changed, or if ancestor is no longer an ancestor of this scope </returns>
+		bool IsUnchangedSince(const size_t since, const Scope* ancestor = nullptr) const;
+
 	protected:
+		// The newest generation handed out, every scope that changes structure takes the next one
+		static size_t latest_generation;
+
+		// Scopes with up to this many entries are searched by comparing every key hash at once instead of through lookup
+		static constexpr size_t SmallScopeSize = 8;
+
 		Scope* parent = nullptr;
-		HashMap<std::string, Datum> map;
-		Vector<HashMap<const std::string, Datum>::PairType*> order;
+		ScopeSlab* slab = nullptr;
+
+		// The generation this scope's entries or parent last changed in. Changes elsewhere in the hierarchy leave it alone,
+		// so appending to one entity doesn't invalidate searches made from its siblings
+		size_t generation = ++latest_generation;
+
+		// Where this scope sits in its parent: the index of the table entry and the index within that datum.
+		// Entries are never removed one at a time, so parent_entry holds until this scope is moved. Orphaning an earlier sibling shifts this
+		// scope down and updates parent_index along with it, so FindContainedScope only scans the datum after edits made directly to it
+		size_t parent_entry = 0;
+		size_t parent_index = 0;
+
+		// The entries in the order they were appended, with each key's DefaultHash at the same index so hashes are compared before keys.
+		// Growing adds a segment rather than relocating the entries, so pointers to them stay valid until the scope is cleared.
+		// The small search always reads SmallScopeSize hashes, so they're kept inline and a small scope never allocates them
+		SegmentedVector<ScopePairType> entries;
+		SmallVector<size_t, SmallScopeSize> hashes;
+
+		// Open addressing table of entry index + 1 (0 marks an empty slot), probed linearly from the key's hash
+		Vector<uint32_t> lookup;
+
+		// A search that had to walk past this scope, hit or miss, and the generation it was made in
+		struct AncestorResult final
+		{
+			Atom key;
+			Datum* datum = nullptr;
+			Scope* scope = nullptr;
+			size_t generation = 0;
+		};
+
+		// Results are slotted by key hash and a newer search evicts whatever shared its slot, so the cache stays this size
+		// however many keys are searched. Created by the first search that walks past this scope, and only reused while
+		// IsUnchangedSince holds for the result
+		static constexpr size_t AncestorCacheSize = 4;
+		using AncestorCacheType = std::array<AncestorResult, AncestorCacheSize>;
+		gsl::owner<AncestorCacheType*> ancestor_cache = nullptr;
+
+		/// <summary>
+		/// Searches this scope, then its ancestors through the ancestor cache
+		/// </summary>
+		/// <param name="entry"> The key to search for </param>
+		/// <param name="hash"> The key's DefaultHash </param>
+		/// <param name="interned"> The atom entry came from, or null to intern it when the result is cached </param>
+		/// <returns> A tuple that contains the datum pointer at the key and a pointer to the scope it was found in </returns>
+		std::tuple<Datum*, Scope*> Search(const std::string& entry, const size_t hash, const Atom* interned);
+
+		/// <summary>
+		/// Determines if an element is in the current scope using a hash the caller already computed
+		/// </summary>
+		/// <param name="entry"> The key to search for </param>
+		/// <param name="hash"> The key's DefaultHash </param>
+		/// <returns> The datum pointer at that specific key, or nullptr if it isn't found </returns>
+		Datum* Find(const std::string& entry, const size_t hash);
+
+		/// <summary>
+		/// Determines if an element is in the current scope using a hash the caller already computed
+		/// </summary>
+		/// <param name="entry"> The key to search for </param>
+		/// <param name="hash"> The key's DefaultHash </param>
+		/// <remarks> Specifically the const version of the non-const Find() </remarks>
+		/// <returns> The datum pointer at that specific key, or nullptr if it isn't found </returns>
+		const Datum* Find(const std::string& entry, const size_t hash) const;
+
+		/// <summary>
+		/// Appends an element using a hash the caller already computed, if that element doesn't exist yet
+		/// </summary>
+		/// <param name="entry"> The key to append </param>
+		/// <param name="hash"> The key's DefaultHash </param>
+		/// <param name="entry_created"> Output parameter which is true if the entry was created </param>
+		/// <exception cref="std::invalid_argument"> If the key is the empty string </exception>
+		/// <returns> The Datum at the key, with type unknown if it was just created </returns>
+		Datum& Append(const std::string& entry, const size_t hash, bool& entry_created);
+
+		/// <summary>
+		/// Finds the index of an entry using a hash the caller already computed
+		/// </summary>
+		/// <param name="entry"> The key to search for </param>
+		/// <param name="hash"> The key's DefaultHash </param>
+		/// <returns> The index of the entry, or Size() if it isn't found </returns>
+		size_t FindEntry(const std::string& entry, const size_t hash) const;
+
+		/// <summary>
+		/// Appends an element using a hash the caller already computed, if that element doesn't exist yet
+		/// </summary>
+		/// <param name="entry"> The key to append </param>
+		/// <param name="hash"> The key's DefaultHash </param>
+		/// <param name="entry_created"> Output parameter which is true if the entry was created </param>
+		/// <exception cref="std::invalid_argument"> If the key is the empty string </exception>
+		/// <returns> The index of the entry, the last one if it was just created </returns>
+		size_t AppendEntry(const std::string& entry, const size_t hash, bool& entry_created);
+
+		/// <summary>
+		/// Probes the lookup table of a scope which outgrew SmallScopeSize
+		/// </summary>
+		/// <param name="entry"> The key to search for </param>
+		/// <param name="hash"> The key's DefaultHash </param>
+		/// <returns> The index of the entry, or Size() if it isn't found </returns>
+		size_t FindIndexed(const std::string& entry, const size_t hash) const;
+
+		/// <summary>
+		/// Makes a newly appended entry findable, building or growing the lookup table once the scope outgrows SmallScopeSize
+		/// </summary>
+		/// <param name="entry_index"> The index of the new entry, always the last one </param>
+		void IndexEntry(const size_t entry_index);
+
+		/// <summary>
+		/// Discards the lookup table and rebuilds it over every entry
+		/// </summary>
+		/// <param name="slot_count"> The amount of slots in the new table, a power of two </param>
+		void RebuildLookup(const size_t slot_count);
+
+		/// <summary>
+		/// Stamps this scope with a new generation after its entries or parent changed
+		/// </summary>
+		void MarkChanged() { generation = ++latest_generation; }
 
 		/// <summary>
 		/// Handles the logic for moving the parameter scope into this one
@@ -245,8 +454,24 @@ namespace FieaGameEngine
 		/// Handles the logic copying the parameter scope into this one
 		/// </summary>
 		/// <param name="other"> The scope to copy </param>
+		/// <remarks> This scope must be empty. Nested scopes are copied, every other datum shares its array with the original </remarks>
 		void DeepCopyScope(const Scope& other);
 
+		/// <summary>
+		/// Copies a nested scope of another scope so it can be added to this one
+		/// </summary>
+		/// <param name="child"> The nested scope to copy </param>
+		/// <remarks> Plain tables are copied into this scope's slab if it has one, derived classes are cloned on the heap </remarks>
+		/// <returns> The copy, which still has to be parented </returns>
+		Scope* CopyNestedScope(const Scope& child) const;
+
+		/// <summary>
+		/// Pushes a scope onto one of this scope's table datums and records where it went
+		/// </summary>
+		/// <param name="child"> The scope to parent, which must not have a parent yet </param>
+		/// <param name="entry_index"> The index of the entry of type Table to push the child onto </param>
+		void AttachChild(Scope& child, const size_t entry_index);
+
 		using NestedScopeFunction = std::function<bool(const Scope&, Datum&, size_t)>;
 		
 		/// <summary>
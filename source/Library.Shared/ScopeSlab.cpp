@@ -0,0 +1,115 @@
+#include "pch.h"
+#include "ScopeSlab.h"
+#include "SizeLiteral.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+
+namespace FieaGameEngine
+{
+	ScopeSlab::ScopeSlab(const size_t new_block_size) :
+		block_size(new_block_size)
+	{
+		if (new_block_size == 0_z)
+		{
+			throw std::invalid_argument("The block size must be greater than zero.");
+		}
+	}
+
+	ScopeSlab::~ScopeSlab()
+	{
+		Release();
+	}
+
+	void ScopeSlab::Destroy(Scope& scope)
+	{
+		assert(scope.slab == this);
+		Header* header = reinterpret_cast<Header*>(reinterpret_cast<std::byte*>(&scope) - sizeof(Header));
+		assert(header->scope == &scope);
+
+		header->scope = nullptr;
+		--live_count;
+		scope.~Scope();
+	}
+
+	void ScopeSlab::Release()
+	{
+		// Roots come before their children, so destroying them empties most of the slots that follow. Once nothing is alive
+		// the rest of the headers aren't worth touching
+		for (Header* header = first; header != nullptr && live_count > 0_z; header = header->next)
+		{
+			if (header->scope != nullptr)
+			{
+				Destroy(*header->scope);
+			}
+		}
+
+		assert(live_count == 0_z);
+
+		while (blocks != nullptr)
+		{
+			BlockHeader* next = blocks->next;
+			free(blocks);
+			blocks = next;
+		}
+
+		cursor = nullptr;
+		block_end = nullptr;
+		first = nullptr;
+		last = nullptr;
+		block_count = 0_z;
+		bytes_used = 0_z;
+	}
+
+	ScopeSlab::Header* ScopeSlab::Allocate(const size_t size)
+	{
+		constexpr size_t alignment = alignof(Header);
+		const size_t slot_size = (sizeof(Header) + size + alignment - 1) & ~(alignment - 1);
+		const size_t block_header_size = (sizeof(BlockHeader) + alignment - 1) & ~(alignment - 1);
+
+		if (static_cast<size_t>(block_end - cursor) < slot_size)
+		{
+			const size_t capacity = std::max(block_size, slot_size);
+			void* memory = malloc(block_header_size + capacity);
+			if (memory == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+
+			BlockHeader* block = reinterpret_cast<BlockHeader*>(memory);
+			block->next = blocks;
+			blocks = block;
+			++block_count;
+
+			cursor = reinterpret_cast<std::byte*>(memory) + block_header_size;
+			block_end = cursor + capacity;
+		}
+
+		Header* header = reinterpret_cast<Header*>(cursor);
+		header->next = nullptr;
+		header->scope = nullptr;
+		cursor += slot_size;
+		bytes_used += slot_size;
+
+		if (last == nullptr)
+		{
+			first = header;
+		}
+		else
+		{
+			last->next = header;
+		}
+
+		last = header;
+		return header;
+	}
+
+	void ScopeSlab::Adopt(Header& header, Scope& scope)
+	{
+		header.scope = &scope;
+		scope.slab = this;
+		++live_count;
+	}
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Scope.h"
+#include <cstddef>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// A slab of Scope objects
+	/// Scopes are bumped one after another into large blocks, so the Scope objects of a tree built through AppendScope sit next to each other
+	/// in creation order, and the memory of a destroyed scope is only handed back once the whole slab is released
+	/// </summary>
+	/// <remarks>
+	/// This saves one heap allocation per Scope object, nothing more. Their entries, keys, lookup tables and datum arrays are still allocated
+	/// on the heap, so destroying a scope and releasing the slab both run every scope's destructor, one at a time
+	/// Scopes created here carry a pointer back to the slab, so children appended to them or deep copied into them land here as well.
+	/// Never delete a scope owned by a slab, Scope::Clear and Release destroy them in place
+	/// Not thread safe, every slab is expected to be used from a single thread
+	/// </remarks>
+	class ScopeSlab final
+	{
+	public:
+		/// <summary>
+		/// Creates an empty slab, no memory is allocated until the first scope is created
+		/// </summary>
+		/// <param name="block_size"> The amount of bytes each block of memory holds, larger scopes get a block of their own </param>
+		/// <remarks> The default holds about a hundred scopes while staying below the size at which freeing a block makes malloc consolidate its free lists </remarks>
+		/// <exception cref="std::invalid_argument"> If the block size is zero </exception>
+		explicit ScopeSlab(const size_t block_size = 16 * 1024);
+
+		/// <summary>
+		/// Deleted copy constructor, scopes belong to exactly one slab
+		/// </summary>
+		ScopeSlab(const ScopeSlab& other) = delete;
+
+		/// <summary>
+		/// Deleted move constructor, scopes point back to their slab
+		/// </summary>
+		ScopeSlab(ScopeSlab&& other) noexcept = delete;
+
+		/// <summary>
+		/// Deleted copy assignment, scopes belong to exactly one slab
+		/// </summary>
+		ScopeSlab& operator=(const ScopeSlab& other) = delete;
+
+		/// <summary>
+		/// Deleted move assignment, scopes point back to their slab
+		/// </summary>
+		ScopeSlab& operator=(ScopeSlab&& other) noexcept = delete;
+
+		/// <summary>
+		/// Destroys every scope still alive and frees every block
+		/// </summary>
+		~ScopeSlab();
+
+		/// <summary>
+		/// Constructs a scope (or a class derived from Scope) in the slab
+		/// </summary>
+		/// <param name="args"> The arguments forwarded to the scope's constructor </param>
+		/// <returns> The new scope, owned by the slab </returns>
+		template <typename T = Scope, typename... Args>
+		T& Create(Args&&... args);
+
+		/// <summary>
+		/// Destructs a scope owned by this slab, its memory stays reserved until Release
+		/// </summary>
+		/// <param name="scope"> The scope to destroy </param>
+		void Destroy(Scope& scope);
+
+		/// <summary>
+		/// Destroys every scope still alive, in creation order so every root takes its subtree with it, then frees every block
+		/// </summary>
+		/// <remarks> Runs the destructor of every live scope, so the cost grows with the scopes' contents and not just the block count </remarks>
+		void Release();
+
+		/// <summary>
+		/// Queries the amount of scopes that were created and not yet destroyed
+		/// </summary>
+		/// <returns> The amount of live scopes </returns>
+		size_t LiveCount() const { return live_count; }
+
+		/// <summary>
+		/// Queries the amount of blocks currently held from the heap
+		/// </summary>
+		/// <returns> The amount of blocks </returns>
+		size_t BlockCount() const { return block_count; }
+
+		/// <summary>
+		/// Queries the amount of bytes handed out since the slab was last released, headers included
+		/// </summary>
+		/// <returns> The amount of bytes used </returns>
+		size_t BytesUsed() const { return bytes_used; }
+
+	private:
+		// Sits right in front of every scope, so the scope can be found from its header and vice versa
+		struct alignas(std::max_align_t) Header final
+		{
+			Header* next = nullptr;
+			Scope* scope = nullptr; // Null once the scope is destroyed
+		};
+
+		struct BlockHeader final
+		{
+			BlockHeader* next = nullptr;
+		};
+
+		/// <summary>
+		/// Bumps the memory for one scope and its header, links the header behind every other one
+		/// </summary>
+		/// <param name="size"> The size of the scope, every slot is aligned like a header </param>
+		/// <remarks> A slot whose constructor throws simply stays empty until the slab is released </remarks>
+		/// <returns> The header of the new slot, its scope is still null </returns>
+		Header* Allocate(const size_t size);
+
+		/// <summary>
+		/// Links a constructed scope to its header and to this slab
+		/// </summary>
+		/// <param name="header"> The header returned by Allocate </param>
+		/// <param name="scope"> The scope constructed right behind the header </param>
+		void Adopt(Header& header, Scope& scope);
+
+		size_t block_size = 0_z;
+
+		BlockHeader* blocks = nullptr;
+		std::byte* cursor = nullptr;
+		std::byte* block_end = nullptr;
+
+		Header* first = nullptr;
+		Header* last = nullptr;
+
+		size_t block_count = 0;
+		size_t live_count = 0;
+		size_t bytes_used = 0;
+	};
+}
+
+#include "ScopeSlab.inl"
@@ -0,0 +1,21 @@
+#include "pch.h"
+#include "ScopeSlab.h"
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace FieaGameEngine
+{
+	template <typename T, typename... Args>
+	inline T& ScopeSlab::Create(Args&&... args)
+	{
+		static_assert(std::is_base_of_v<Scope, T>, "A slab only owns scopes.");
+		static_assert(alignof(T) <= alignof(Header), "The scope is aligned more strictly than a slab slot.");
+
+		Header* header = Allocate(sizeof(T));
+		T* scope = new(reinterpret_cast<std::byte*>(header) + sizeof(Header))T(std::forward<Args>(args)...);
+		Adopt(*header, *scope);
+
+		return *scope;
+	}
+}
@@ -0,0 +1,517 @@
+#pragma once
+
+#include "DebugIterators.h"
+#include "SizeLiteral.h"
+#include "SmallVector.h"
+#include <cstddef>
+#include <stdexcept>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// A class which defines a templated vector whose elements never move once they're added
+	/// Stores the elements in segments that double in size, the first one as large as the first capacity asked for
+	/// Growing adds a segment instead of relocating the ones already there, so pointers and references to elements stay valid
+	/// until the vector is cleared or destroyed
+	/// </summary>
+	/// <remarks> Elements can only be added at the end and removed all at once, which is all a Scope needs of its entries </remarks>
+	template <typename T>
+	class SegmentedVector final
+	{
+	public:
+		using value_type = T;
+
+		/// <summary>
+		/// A templated class which defines a non-inheritable Iterator
+		/// Stores a reference to the owning vector and the index this iterator is referring to
+		/// This will be mainly used to traverse the vector
+		/// </summary>
+		class Iterator final
+		{
+			friend SegmentedVector;
+			friend class ConstIterator;
+
+		public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using reference = T;
+			using pointer = T*;
+			using iterator_category = std::bidirectional_iterator_tag;
+
+			/// <summary>
+			/// The default constructor with a null owner
+			/// </summary>
+			Iterator() = default;
+
+			/// <summary>
+			/// The default copy constructor which creates a new Iterator based on the existing other Iterator
+			/// </summary>
+			/// <param name="other"> The original Iterator to copy </param>
+			Iterator(const Iterator& other) = default;
+
+			/// <summary>
+			/// The default move constructor which creates a new Iterator based on the existing other Iterator
+			/// </summary>
+			/// <param name="other"> The original Iterator to copy </param>
+			Iterator(Iterator&& other) noexcept = default;
+
+			/// <summary>
+			/// The default assignment operator
+			/// </summary>
+			/// <param name="other"> The Iterator to equate this Iterator to </param>
+			/// <returns> The lhs Iterator (this) after equalizing them </returns>
+			Iterator& operator=(const Iterator& other) = default;
+
+			/// <summary>
+			/// The default move assignment operator
+			/// </summary>
+			/// <param name="other"> The Iterator to equate this Iterator to </param>
+			/// <returns> The lhs Iterator (this) after equalizing them </returns>
+			Iterator& operator=(Iterator&& other) noexcept = default;
+
+			/// <summary>
+			/// The default destructor
+			/// </summary>
+			~Iterator() = default;
+
+			/// <summary>
+			/// Determines if two Iterator's are the same (owner and index)
+			/// </summary>
+			/// <param name = "other"> The Iterator to compare this too </param>
+			/// <returns> A boolean to indicate if two Iterator's are the same </returns>
+			bool operator==(const Iterator& other) const;
+
+			/// <summary>
+			/// Determines if two Iterator's are not the same (owner and index)
+			/// </summary>
+			/// <param name = "other"> The Iterator to compare this too </param>
+			/// <returns> A boolean to indicate if two Iterator's are not the same </returns>
+			bool operator!=(const Iterator& other) const;
+
+			/// <summary>
+			/// Increments a Iterator by altering the index to look at the next element
+			/// </summary>
+			/// <remarks> Specifically handles the prefix increment case </remarks>
+			/// <exception cref="std::runtime_error"> If the owning vector is null, only when FIEA_DEBUG_ITERATORS is on </exception>
+			/// <returns> The altered Iterator </returns>
+			Iterator& operator++();
+
+			/// <summary>
+			/// Increments a Iterator by altering the index to look at the next element
+			/// </summary>
+			/// <remarks> Specifically handles the postfix increment case </remarks>
+			/// <returns> A copy of the old Iterator </returns>
+			Iterator operator++(int);
+
+			/// <summary>
+			/// Decrements a Iterator by altering the index to look at the previous element
+			/// </summary>
+			/// <remarks> Specifically handles the prefix decrement case </remarks>
+			/// <exception cref="std::runtime_error"> If the owning vector is null, only when FIEA_DEBUG_ITERATORS is on </exception>
+			/// <returns> The altered Iterator </returns>
+			Iterator& operator--();
+
+			/// <summary>
+			/// Decrements a Iterator by altering the index to look at the previous element
+			/// </summary>
+			/// <remarks> Specifically handles the postfix decrement case </remarks>
+			/// <returns> A copy of the old Iterator </returns>
+			Iterator operator--(int);
+
+			/// <summary>
+			/// The overloaded dereference operator which retrieves the Iterator's data at the index
+			/// </summary>
+			/// <exception cref="std::runtime_error"> If the owner is null or the index is out of range, only when FIEA_DEBUG_ITERATORS is on </exception>
+			/// <returns> The data that the Iterator's vector (at index) points at </returns>
+			T& operator*() const;
+
+			/// <summary>
+			/// The overloaded dereference operator which retrieves the Iterator's data at the index
+			/// </summary>
+			/// <exception cref="std::runtime_error"> If the owner is null or the index is out of range, only when FIEA_DEBUG_ITERATORS is on </exception>
+			/// <returns> A pointer to the data that the Iterator's vector (at index) points at </returns>
+			T* operator->() const;
+
+		private:
+			/// <summary>
+			/// Private constructor that's used to assign vectors and indexes from only within the SegmentedVector class
+			/// <param name = "owner"> The vector that will own this Iterator </param>
+			/// <param name = "new_index"> The index in the vector this Iterator has a reference to </param>
+			/// </summary>
+			Iterator(SegmentedVector& owner, const size_t new_index);
+
+			SegmentedVector* owner = nullptr;
+			size_t index = 0_z;
+		};
+
+		/// <summary>
+		/// A templated class which defines a non-inheritable Iterator
+		/// Stores a reference to the owning vector and the index this iterator is referring to
+		/// The difference between this and a regular iterator, is that its vector is const and cannot be mutated
+		/// </summary>
+		class ConstIterator final
+		{
+			friend SegmentedVector;
+
+		public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using reference = T;
+			using pointer = T*;
+			using iterator_category = std::bidirectional_iterator_tag;
+
+			/// <summary>
+			/// The default constructor with a null owner
+			/// </summary>
+			ConstIterator() = default;
+
+			/// <summary>
+			/// Type cast constructor which creates a ConstIterator from a regular Iterator
+			/// </summary>
+			/// <param name="other"> The Iterator to convert </param>
+			ConstIterator(const Iterator& other);
+
+			/// <summary>
+			/// The default copy constructor which creates a new ConstIterator based on the existing other ConstIterator
+			/// </summary>
+			/// <param name="other"> The original ConstIterator to copy </param>
+			ConstIterator(const ConstIterator& other) = default;
+
+			/// <summary>
+			/// The default move constructor which creates a new ConstIterator based on the existing other ConstIterator
+			/// </summary>
+			/// <param name="other"> The original ConstIterator to copy </param>
+			ConstIterator(ConstIterator&& other) noexcept = default;
+
+			/// <summary>
+			/// The default assignment operator
+			/// </summary>
+			/// <param name="other"> The ConstIterator to equate this ConstIterator to </param>
+			/// <returns> The lhs ConstIterator (this) after equalizing them </returns>
+			ConstIterator& operator=(const ConstIterator& other) = default;
+
+			/// <summary>
+			/// The default move assignment operator
+			/// </summary>
+			/// <param name="other"> The ConstIterator to equate this ConstIterator to </param>
+			/// <returns> The lhs ConstIterator (this) after equalizing them </returns>
+			ConstIterator& operator=(ConstIterator&& other) noexcept = default;
+
+			/// <summary>
+			/// The default destructor
+			/// </summary>
+			~ConstIterator() = default;
+
+			/// <summary>
+			/// Determines if two ConstIterator's are the same (owner and index)
+			/// </summary>
+			/// <param name = "other"> The ConstIterator to compare this too </param>
+			/// <returns> A boolean to indicate if two ConstIterator's are the same </returns>
+			bool operator==(const ConstIterator& other) const;
+
+			/// <summary>
+			/// Determines if two ConstIterator's are not the same (owner and index)
+			/// </summary>
+			/// <param name = "other"> The ConstIterator to compare this too </param>
+			/// <returns> A boolean to indicate if two ConstIterator's are not the same </returns>
+			bool operator!=(const ConstIterator& other) const;
+
+			/// <summary>
+			/// Increments a ConstIterator by altering the index to look at the next element
+			/// </summary>
+			/// <remarks> Specifically handles the prefix increment case </remarks>
+			/// <exception cref="std::runtime_error"> If the owning vector is null, only when FIEA_DEBUG_ITERATORS is on </exception>
+			/// <returns> The altered ConstIterator </returns>
+			ConstIterator& operator++();
+
+			/// <summary>
+			/// Increments a ConstIterator by altering the index to look at the next element
+			/// </summary>
+			/// <remarks> Specifically handles the postfix increment case </remarks>
+			/// <returns> A copy of the old ConstIterator </returns>
+			ConstIterator operator++(int);
+
+			/// <summary>
+			/// Decrements a ConstIterator by altering the index to look at the previous element
+			/// </summary>
+			/// <remarks> Specifically handles the prefix decrement case </remarks>
+			/// <exception cref="std::runtime_error"> If the owning vector is null, only when FIEA_DEBUG_ITERATORS is on </exception>
+			/// <returns> The altered ConstIterator </returns>
+			ConstIterator& operator--();
+
+			/// <summary>
+			/// Decrements a ConstIterator by altering the index to look at the previous element
+			/// </summary>
+			/// <remarks> Specifically handles the postfix decrement case </remarks>
+			/// <returns> A copy of the old ConstIterator </returns>
+			ConstIterator operator--(int);
+
+			/// <summary>
+			/// The overloaded dereference operator which retrieves the ConstIterator's data at the index
+			/// </summary>
+			/// <exception cref="std::runtime_error"> If the owner is null or the index is out of range, only when FIEA_DEBUG_ITERATORS is on </exception>
+			/// <returns> The data that the ConstIterator's index points at </returns>
+			const T& operator*() const;
+
+			/// <summary>
+			/// The overloaded dereference operator which retrieves the ConstIterator's data at the index
+			/// </summary>
+			/// <exception cref="std::runtime_error"> If the owner is null or the index is out of range, only when FIEA_DEBUG_ITERATORS is on </exception>
+			/// <returns> A pointer to the data that the ConstIterator's index points at </returns>
+			const T* operator->() const;
+
+		private:
+			/// <summary>
+			/// Private constructor that's used to assign vectors and indexes from only within the SegmentedVector class
+			/// <param name = "owner"> The vector that will own this ConstIterator </param>
+			/// <param name = "new_index"> The index in the vector this ConstIterator has a reference to </param>
+			/// </summary>
+			ConstIterator(const SegmentedVector& owner, const size_t new_index);
+
+			const SegmentedVector* owner = nullptr;
+			size_t index = 0_z;
+		};
+
+		/// <summary>
+		/// Constructor for object initialization
+		/// <param name = "new_capacity"> The amount of space to initially make available, which also sizes the first segment </param>
+		/// </summary>
+		explicit SegmentedVector(const size_t new_capacity = 0_z);
+
+		/// <summary>
+		/// Copy constructor which creates a new vector based on the existing other vector
+		/// </summary>
+		/// <param name="other"> The original vector to copy </param>
+		/// <remarks> The copy gets one segment large enough for every element </remarks>
+		SegmentedVector(const SegmentedVector& other);
+
+		/// <summary>
+		/// Move constructor which takes the other vector's segments
+		/// </summary>
+		/// <param name="other"> The vector to take from, left empty afterwards </param>
+		/// <remarks> The elements themselves don't move, so pointers to them stay valid </remarks>
+		SegmentedVector(SegmentedVector&& other) noexcept;
+
+		/// <summary>
+		/// Sets this vector equal to the other vector
+		/// </summary>
+		/// <param name = "other"> The vector to equate this vector to </param>
+		/// <returns> The lhs vector (this) after equalizing them </returns>
+		SegmentedVector& operator=(const SegmentedVector& other);
+
+		/// <summary>
+		/// Takes the other vector's segments, freeing this vector's own
+		/// </summary>
+		/// <param name = "other"> The vector to take from, left empty afterwards </param>
+		/// <returns> The lhs vector (this) after equalizing them </returns>
+		SegmentedVector& operator=(SegmentedVector&& other) noexcept;
+
+		/// <summary>
+		/// Destructor for the vector, destroys every element and frees every segment
+		/// </summary>
+		~SegmentedVector();
+
+		/// <summary>
+		/// Queries the vector and retrieves the data member at the parameter's search_index
+		/// </summary>
+		/// <param name = "search_index"> The index to query </param>
+		/// <exception cref="std::runtime_error"> When the parameter is out of range </exception>
+		/// <returns> A mutable reference to the object's data member at the search_index </returns>
+		T& operator[](const size_t search_index);
+
+		/// <summary>
+		/// Queries the vector and retrieves the data member at the parameter's search_index
+		/// </summary>
+		/// <param name = "search_index"> The index to query </param>
+		/// <remarks> This is the const version of the other operator[] method </remarks>
+		/// <exception cref="std::runtime_error"> When the parameter is out of range </exception>
+		/// <returns> A non-mutable reference to the object's data member at the search_index </returns>
+		const T& operator[](const size_t search_index) const;
+
+		/// <summary>
+		/// Queries the vector and retrieves the data member at the parameter's search_index
+		/// </summary>
+		/// <param name = "search_index"> The index to query </param>
+		/// <exception cref="std::runtime_error"> When the parameter is out of range </exception>
+		/// <returns> A mutable reference to the object's data member at the search_index </returns>
+		T& at(const size_t search_index);
+
+		/// <summary>
+		/// Queries the vector and retrieves the data member at the parameter's search_index
+		/// </summary>
+		/// <param name = "search_index"> The index to query </param>
+		/// <remarks> This is the const version of the other at method </remarks>
+		/// <exception cref="std::runtime_error"> When the parameter is out of range </exception>
+		/// <returns> A non-mutable reference to the object's data member at the search_index </returns>
+		const T& at(const size_t search_index) const;
+
+		/// <summary>
+		/// Queries the vector and determines empty status
+		/// </summary>
+		/// <returns> True/False determining if the list has objects in it </returns>
+		bool IsEmpty() const { return size == 0_z; }
+
+		/// <summary>
+		/// Queries the vector and retrieves the first data member of the vector
+		/// </summary>
+		/// <exception cref="std::runtime_error"> When the vector is empty </exception>
+		/// <returns> A mutable reference to the front object's data member </returns>
+		T& Front();
+
+		/// <summary>
+		/// Queries the vector and retrieves the first data member of the vector
+		/// </summary>
+		/// <remarks> This is the const version of the other Front method </remarks>
+		/// <exception cref="std::runtime_error"> When the vector is empty </exception>
+		/// <returns> A non-mutable reference to the front object's data member </returns>
+		const T& Front() const;
+
+		/// <summary>
+		/// Queries the vector and retrieves the last data member in the vector
+		/// </summary>
+		/// <exception cref="std::runtime_error"> When the vector is empty </exception>
+		/// <returns> A mutable reference to the last data member in the vector </returns>
+		T& Back();
+
+		/// <summary>
+		/// Queries the vector and retrieves the last data member in the vector
+		/// </summary>
+		/// <remarks> This is the const version of the other Back method </remarks>
+		/// <exception cref="std::runtime_error"> When the vector is empty </exception>
+		/// <returns> A non-mutable reference to the last data member in the vector </returns>
+		const T& Back() const;
+
+		/// <summary>
+		/// Queries the vector and determines the amount of objects in the vector
+		/// </summary>
+		/// <returns> Amount of elements in the vector </returns>
+		size_t Size() const { return size; }
+
+		/// <summary>
+		/// Queries the vector and determines the amount of space available across every segment
+		/// </summary>
+		/// <returns> Amount of space available in the vector </returns>
+		size_t Capacity() const;
+
+		/// <summary>
+		/// Queries the amount of segments the elements are spread over
+		/// </summary>
+		/// <returns> The amount of segments allocated </returns>
+		size_t SegmentCount() const { return segments.Size(); }
+
+		/// <summary>
+		/// Creates an Iterator from this vector and the first element of the vector
+		/// </summary>
+		/// <returns> An Iterator referencing to the front of the vector </returns>
+		Iterator begin();
+
+		/// <summary>
+		/// Creates an Iterator from this vector and PAST the last element of the vector
+		/// </summary>
+		/// <returns> An Iterator referencing beyond the back/end of the vector </returns>
+		Iterator end();
+
+		/// <summary>
+		/// Creates a ConstIterator from this vector and the first element of the vector
+		/// </summary>
+		/// <returns> A ConstIterator referencing to the front of the vector </returns>
+		ConstIterator begin() const;
+
+		/// <summary>
+		/// Creates a ConstIterator from this vector and the first element of the vector
+		/// </summary>
+		/// <remarks> In a non-const vector, you can still get a ConstIterator out of a mutable vector </remarks>
+		/// <returns> A ConstIterator referencing to the front of the vector </returns>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// Creates a ConstIterator from this vector and PAST the last element of the vector
+		/// </summary>
+		/// <returns> A ConstIterator referencing beyond the back/end of the vector </returns>
+		ConstIterator end() const;
+
+		/// <summary>
+		/// Creates a ConstIterator from this vector and PAST the last element of the vector
+		/// </summary>
+		/// <remarks> In a non-const vector, you can still get a ConstIterator out of a mutable vector </remarks>
+		/// <returns> A ConstIterator referencing beyond the back/end of the vector </returns>
+		ConstIterator cend() const;
+
+		/// <summary>
+		/// Adds a new element to the end of the vector
+		/// </summary>
+		/// <param name="value"> The data object that will associated with the index </param>
+		/// <returns> A reference to the new element </returns>
+		T& PushBack(const T& value);
+
+		/// <summary>
+		/// Adds a new element to the end of the vector
+		/// </summary>
+		/// <param name="value"> The data object that will associated with the index </param>
+		/// <remarks> Explicitly uses r-values instead of l-values </remarks>
+		/// <returns> A reference to the new element </returns>
+		T& PushBack(T&& value);
+
+		/// <summary>
+		/// Constructs a new element in place at the end of the vector
+		/// </summary>
+		/// <param name="args"> The arguments forwarded to T's constructor </param>
+		/// <remarks> The arguments may refer to elements of this vector, since growing never moves them </remarks>
+		/// <returns> A reference to the new element </returns>
+		template <typename... Args>
+		T& EmplaceBack(Args&&... args);
+
+		/// <summary>
+		/// Adds segments until the provided capacity fits
+		/// </summary>
+		/// <param name="new_capacity"> The amount of capacity to reserve on this vector </param>
+		/// <remarks> Increases capacity, NEVER decreases it. An empty vector sizes its first segment to fit the whole capacity </remarks>
+		void Reserve(const size_t new_capacity);
+
+		/// <summary>
+		/// Removes all elements from the vector
+		/// </summary>
+		/// <remarks> Keeps the segments for reuse, call ShrinkToFit to give them back </remarks>
+		void Clear();
+
+		/// <summary>
+		/// Frees every segment once the vector is empty
+		/// </summary>
+		/// <remarks> Elements never move, so a vector that still has elements keeps its segments </remarks>
+		void ShrinkToFit();
+
+	private:
+		// The first segment never holds fewer than 8 elements, so a Scope small enough to go without a lookup table fits in it
+		static constexpr size_t MinimumSegmentShift = 3;
+
+		// Segments double in size, so a vector of less than (2^InlineSegmentCount - 1) times its first segment never allocates its segment list
+		static constexpr size_t InlineSegmentCount = 4;
+
+		/// <summary>
+		/// Finds an element without any bounds checking
+		/// </summary>
+		/// <param name="index"> The index of the element, which must be below the capacity </param>
+		/// <returns> A pointer to the element's slot </returns>
+		T* Locate(const size_t index) const;
+
+		/// <summary>
+		/// Allocates the next segment, twice the size of the last one
+		/// </summary>
+		void AddSegment();
+
+		/// <summary>
+		/// Makes room for one more element
+		/// </summary>
+		/// <returns> The uninitialized slot the next element goes in </returns>
+		T* NextSlot();
+
+		SmallVector<T*, InlineSegmentCount> segments;
+		T* first_segment = nullptr; // Also segments[0], kept apart so most lookups skip the segment list entirely
+		size_t size = 0_z;
+		size_t first_segment_shift = MinimumSegmentShift;
+	};
+}
+
+#include "SegmentedVector.inl"
@@ -0,0 +1,523 @@
+#include "pch.h"
+#include "SegmentedVector.h"
+#include "SizeLiteral.h"
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+namespace FieaGameEngine
+{
+#pragma region Iterator
+
+	template <typename T>
+	inline SegmentedVector<T>::Iterator::Iterator(SegmentedVector& owner, const size_t new_index) :
+		owner(&owner),
+		index(new_index)
+	{}
+
+	template <typename T>
+	inline bool SegmentedVector<T>::Iterator::operator==(const Iterator& other) const
+	{
+		return !(operator!=(other));
+	}
+
+	template <typename T>
+	inline bool SegmentedVector<T>::Iterator::operator!=(const Iterator& other) const
+	{
+		return ((owner != other.owner) || (index != other.index));
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::Iterator& SegmentedVector<T>::Iterator::operator++()
+	{
+#if FIEA_DEBUG_ITERATORS
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
+		}
+
+		if (index < owner->size)
+		{
+			++index;
+		}
+#else
+		++index;
+#endif
+
+		return *this;
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::Iterator SegmentedVector<T>::Iterator::operator++(int)
+	{
+		Iterator temp(*this);
+		operator++();
+
+		return temp;
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::Iterator& SegmentedVector<T>::Iterator::operator--()
+	{
+#if FIEA_DEBUG_ITERATORS
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
+		}
+
+		if (index <= owner->size)
+		{
+			--index;
+		}
+#else
+		--index;
+#endif
+
+		return *this;
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::Iterator SegmentedVector<T>::Iterator::operator--(int)
+	{
+		Iterator temp(*this);
+		operator--();
+
+		return temp;
+	}
+
+	template <typename T>
+	inline T& SegmentedVector<T>::Iterator::operator*() const
+	{
+#if FIEA_DEBUG_ITERATORS
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
+		}
+
+		return owner->at(index);
+#else
+		return *owner->Locate(index);
+#endif
+	}
+
+	template <typename T>
+	inline T* SegmentedVector<T>::Iterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+
+	template <typename T>
+	inline SegmentedVector<T>::ConstIterator::ConstIterator(const SegmentedVector& owner, const size_t new_index) :
+		owner(&owner), index(new_index)
+	{}
+
+	template <typename T>
+	inline SegmentedVector<T>::ConstIterator::ConstIterator(const Iterator& other) :
+		owner(other.owner), index(other.index)
+	{}
+
+	template <typename T>
+	inline bool SegmentedVector<T>::ConstIterator::operator==(const ConstIterator& other) const
+	{
+		return !(operator!=(other));
+	}
+
+	template <typename T>
+	inline bool SegmentedVector<T>::ConstIterator::operator!=(const ConstIterator& other) const
+	{
+		return ((owner != other.owner) || (index != other.index));
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::ConstIterator& SegmentedVector<T>::ConstIterator::operator++()
+	{
+#if FIEA_DEBUG_ITERATORS
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
+		}
+
+		if (index < owner->size)
+		{
+			++index;
+		}
+#else
+		++index;
+#endif
+
+		return *this;
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::ConstIterator SegmentedVector<T>::ConstIterator::operator++(int)
+	{
+		ConstIterator temp(*this);
+		operator++();
+
+		return temp;
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::ConstIterator& SegmentedVector<T>::ConstIterator::operator--()
+	{
+#if FIEA_DEBUG_ITERATORS
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
+		}
+
+		if (index <= owner->size)
+		{
+			--index;
+		}
+#else
+		--index;
+#endif
+
+		return *this;
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::ConstIterator SegmentedVector<T>::ConstIterator::operator--(int)
+	{
+		ConstIterator temp(*this);
+		operator--();
+
+		return temp;
+	}
+
+	template <typename T>
+	inline const T& SegmentedVector<T>::ConstIterator::operator*() const
+	{
+#if FIEA_DEBUG_ITERATORS
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
+		}
+
+		return owner->at(index);
+#else
+		return *owner->Locate(index);
+#endif
+	}
+
+	template <typename T>
+	inline const T* SegmentedVector<T>::ConstIterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+#pragma endregion ConstIterator
+
+#pragma region SegmentedVector
+
+	template <typename T>
+	inline SegmentedVector<T>::SegmentedVector(const size_t new_capacity)
+	{
+		Reserve(new_capacity);
+	}
+
+	template <typename T>
+	inline SegmentedVector<T>::SegmentedVector(const SegmentedVector& other)
+	{
+		Reserve(other.size);
+		for (const T& value : other)
+		{
+			PushBack(value);
+		}
+	}
+
+	template <typename T>
+	inline SegmentedVector<T>::SegmentedVector(SegmentedVector&& other) noexcept :
+		segments(std::move(other.segments)),
+		first_segment(other.first_segment),
+		size(other.size),
+		first_segment_shift(other.first_segment_shift)
+	{
+		other.first_segment = nullptr;
+		other.size = 0_z;
+		other.first_segment_shift = MinimumSegmentShift;
+	}
+
+	template <typename T>
+	inline SegmentedVector<T>& SegmentedVector<T>::operator=(const SegmentedVector& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			ShrinkToFit();
+
+			Reserve(other.size);
+			for (const T& value : other)
+			{
+				PushBack(value);
+			}
+		}
+
+		return *this;
+	}
+
+	template <typename T>
+	inline SegmentedVector<T>& SegmentedVector<T>::operator=(SegmentedVector&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Clear();
+			ShrinkToFit();
+
+			segments = std::move(other.segments);
+			first_segment = other.first_segment;
+			size = other.size;
+			first_segment_shift = other.first_segment_shift;
+
+			other.first_segment = nullptr;
+			other.size = 0_z;
+			other.first_segment_shift = MinimumSegmentShift;
+		}
+
+		return *this;
+	}
+
+	template <typename T>
+	inline SegmentedVector<T>::~SegmentedVector()
+	{
+		Clear();
+		ShrinkToFit();
+	}
+
+	template <typename T>
+	inline T& SegmentedVector<T>::operator[](const size_t search_index)
+	{
+		if (search_index >= size)
+		{
+			throw std::runtime_error("The index is out of range.");
+		}
+
+		return *Locate(search_index);
+	}
+
+	template <typename T>
+	inline const T& SegmentedVector<T>::operator[](const size_t search_index) const
+	{
+		if (search_index >= size)
+		{
+			throw std::runtime_error("The index is out of range.");
+		}
+
+		return *Locate(search_index);
+	}
+
+	template <typename T>
+	inline T& SegmentedVector<T>::at(const size_t search_index)
+	{
+		return operator[](search_index);
+	}
+
+	template <typename T>
+	inline const T& SegmentedVector<T>::at(const size_t search_index) const
+	{
+		return operator[](search_index);
+	}
+
+	template <typename T>
+	inline T& SegmentedVector<T>::Front()
+	{
+		if (size == 0_z)
+		{
+			throw std::runtime_error("The size should not be 0. Is the vector empty?");
+		}
+
+		return *Locate(0_z);
+	}
+
+	template <typename T>
+	inline const T& SegmentedVector<T>::Front() const
+	{
+		return const_cast<SegmentedVector*>(this)->Front();
+	}
+
+	template <typename T>
+	inline T& SegmentedVector<T>::Back()
+	{
+		if (size == 0_z)
+		{
+			throw std::runtime_error("The last element does not exist. Is the vector empty?");
+		}
+
+		return *Locate(size - 1_z);
+	}
+
+	template <typename T>
+	inline const T& SegmentedVector<T>::Back() const
+	{
+		return const_cast<SegmentedVector*>(this)->Back();
+	}
+
+	template <typename T>
+	inline size_t SegmentedVector<T>::Capacity() const
+	{
+		return ((1_z << segments.Size()) - 1_z) << first_segment_shift;
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::Iterator SegmentedVector<T>::begin()
+	{
+		return Iterator(*this, 0_z);
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::Iterator SegmentedVector<T>::end()
+	{
+		return Iterator(*this, size);
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::ConstIterator SegmentedVector<T>::begin() const
+	{
+		return ConstIterator(*this, 0_z);
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::ConstIterator SegmentedVector<T>::cbegin() const
+	{
+		return ConstIterator(*this, 0_z);
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::ConstIterator SegmentedVector<T>::end() const
+	{
+		return ConstIterator(*this, size);
+	}
+
+	template <typename T>
+	inline typename SegmentedVector<T>::ConstIterator SegmentedVector<T>::cend() const
+	{
+		return ConstIterator(*this, size);
+	}
+
+	template <typename T>
+	inline T& SegmentedVector<T>::PushBack(const T& value)
+	{
+		return EmplaceBack(value);
+	}
+
+	template <typename T>
+	inline T& SegmentedVector<T>::PushBack(T&& value)
+	{
+		return EmplaceBack(std::move(value));
+	}
+
+	template <typename T>
+	template <typename... Args>
+	inline T& SegmentedVector<T>::EmplaceBack(Args&&... args)
+	{
+		T* slot = new(NextSlot())T(std::forward<Args>(args)...);
+		++size;
+
+		return *slot;
+	}
+
+	template <typename T>
+	inline void SegmentedVector<T>::Reserve(const size_t new_capacity)
+	{
+		if (segments.IsEmpty())
+		{
+			// Sizes the first segment to fit the whole capacity, rounded up to a power of two
+			first_segment_shift = std::max(MinimumSegmentShift, static_cast<size_t>(std::bit_width(std::max(new_capacity, 1_z) - 1_z)));
+		}
+
+		while (Capacity() < new_capacity)
+		{
+			AddSegment();
+		}
+	}
+
+	template <typename T>
+	inline void SegmentedVector<T>::Clear()
+	{
+		for (size_t index = 0_z; index < size; ++index)
+		{
+			Locate(index)->~T();
+		}
+
+		size = 0_z;
+	}
+
+	template <typename T>
+	inline void SegmentedVector<T>::ShrinkToFit()
+	{
+		if (size == 0_z)
+		{
+			for (T* segment : segments)
+			{
+				free(segment);
+			}
+
+			segments.Clear();
+			segments.ShrinkToFit();
+			first_segment = nullptr;
+			first_segment_shift = MinimumSegmentShift;
+		}
+	}
+
+	template <typename T>
+	inline T* SegmentedVector<T>::Locate(const size_t index) const
+	{
+		if (index < (1_z << first_segment_shift))
+		{
+			return first_segment + index;
+		}
+
+		// Segment k starts at (2^k - 1) times the first segment's size
+		const size_t block = (index >> first_segment_shift) + 1_z;
+		const size_t segment = static_cast<size_t>(std::bit_width(block)) - 1_z;
+		const size_t offset = index - (((1_z << segment) - 1_z) << first_segment_shift);
+
+		return segments.Data()[segment] + offset;
+	}
+
+	template <typename T>
+	inline void SegmentedVector<T>::AddSegment()
+	{
+		const size_t count = 1_z << (first_segment_shift + segments.Size());
+		T* segment = reinterpret_cast<T*>(malloc(count * sizeof(T)));
+		if (segment == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		try
+		{
+			segments.PushBack(segment);
+		}
+		catch (...)
+		{
+			free(segment);
+			throw;
+		}
+
+		if (segments.Size() == 1_z)
+		{
+			first_segment = segment;
+		}
+	}
+
+	template <typename T>
+	inline T* SegmentedVector<T>::NextSlot()
+	{
+		if (size == Capacity())
+		{
+			AddSegment();
+		}
+
+		return Locate(size);
+	}
+
+#pragma endregion SegmentedVector
+}
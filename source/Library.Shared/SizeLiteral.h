@@ -1,5 +1,5 @@
 #pragma once
 
-_inline size_t operator"" _z(unsigned long long int x) {
+inline size_t operator"" _z(unsigned long long int x) {
 	return static_cast<size_t>(x);
 }
\ No newline at end of file
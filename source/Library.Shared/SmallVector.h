@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// A Vector that keeps its first InlineCount elements inside the object itself
+	/// The array starts out as the inline buffer and only moves to the heap once more than InlineCount elements are needed
+	/// Meant for the many short lists which would otherwise each cost an allocation
+	/// </summary>
+	/// <remarks> Every algorithm is Vector's, only where the array lives differs. A zero InlineCount is just a Vector </remarks>
+	template <typename T, size_t InlineCount>
+	using SmallVector = Vector<T, InlineCount>;
+}
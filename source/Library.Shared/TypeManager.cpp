@@ -1,50 +1,39 @@
 #include "pch.h"
 #include "TypeManager.h"
+#include <deque>
 
 namespace FieaGameEngine
 {
-    HashMap<RTTI::IdType, TypeManager::TypeInfo> TypeManager::map;
+    TypeManager::MapType<RTTI::IdType, TypeManager::TypeInfo> TypeManager::map;
 
     Signature::Signature(std::string new_name, Datum::DatumTypes new_type, size_t new_size, size_t new_offset) :
         name(std::move(new_name)), type(new_type), size(new_size), storage_offset(new_offset)
     {
     }
 
-    const Vector<Signature> TypeManager::GetSignaturesForType(const RTTI::IdType type)
+    const Vector<Signature>& TypeManager::GetSignaturesForType(const RTTI::IdType type)
     {
-        size_t signature_count = 0;
-        std::deque<const TypeInfo*> queue;
-        auto it = map.Find(type);
-        while (it != map.end())
-        {
-            const TypeInfo& type_info = it->second;
-            queue.push_front(&type_info);
-            signature_count += type_info.signatures.Size();
-            it = map.Find(type_info.parent_id_type);
-        }
+        return GetShape(type).signatures;
+    }
 
-        Vector<Signature> signatures(signature_count);
-        for (const TypeInfo* type_info : queue)
-        {
-            for (const Signature& signature : type_info->signatures)
-            {
-                signatures.PushBack(signature);
-            }
-        }
+    const TypeManager::Shape& TypeManager::GetShape(const RTTI::IdType type)
+    {
+        static const Shape empty_shape;
 
-        return signatures;
+        auto it = map.Find(type);
+        return (it != map.end()) ? *it->second.shape : empty_shape;
     }
 
-    Signature* TypeManager::GetSignature(const RTTI::IdType type, const std::string& entry)
+    const Signature* TypeManager::GetSignature(const RTTI::IdType type, const std::string& entry)
     {
-        Signature* signature = nullptr;
-        Vector<Signature> signatures = GetSignaturesForType(type);
+        const Signature* signature = nullptr;
+        const Vector<Signature>& signatures = GetSignaturesForType(type);
         
         auto found = std::find_if(signatures.begin(), signatures.end(), [&entry](const Signature& signature) { return signature.name == entry; });
         
         if (found != signatures.end())
         {
-            signature = const_cast<Signature*>(&(*found));
+            signature = &(*found);
         }
 
         return signature;
@@ -57,8 +46,68 @@ namespace FieaGameEngine
             throw std::runtime_error("Type already registered.");
         }
 
-        TypeInfo type_info{ signatures, parent_id };
+        TypeInfo type_info{ signatures, parent_id, std::make_unique<Shape>() };
+
+        map.Insert(std::make_pair(type, std::move(type_info)));
+        RebuildShapes(type);
+    }
+
+    void TypeManager::RemoveType(const RTTI::IdType type)
+    {
+        if (map.ContainsKey(type))
+        {
+            map.Remove(type);
+            RebuildShapes(type);
+        }
+    }
+
+    void TypeManager::RebuildShapes(const RTTI::IdType type)
+    {
+        // Types are normally registered base class first, but a derived type registered earlier still has to pick up its new ancestor
+        for (auto& [id_type, type_info] : map)
+        {
+            bool inherits = false;
+            for (auto it = map.Find(id_type); it != map.end(); it = map.Find(it->second.parent_id_type))
+            {
+                if (it->first == type || it->second.parent_id_type == type)
+                {
+                    inherits = true;
+                    break;
+                }
+            }
+
+            if (inherits)
+            {
+                // Assigned in place so references handed out for this type stay valid
+                *type_info.shape = BuildShape(id_type);
+            }
+        }
+    }
+
+    TypeManager::Shape TypeManager::BuildShape(const RTTI::IdType type)
+    {
+        size_t signature_count = 0;
+        std::deque<const TypeInfo*> queue;
+        auto it = map.Find(type);
+        while (it != map.end())
+        {
+            const TypeInfo& type_info = it->second;
+            queue.push_front(&type_info);
+            signature_count += type_info.signatures.Size();
+            it = map.Find(type_info.parent_id_type);
+        }
+
+        Shape shape{ Vector<Signature>(signature_count), Vector<size_t>(signature_count) };
+        DefaultHash<std::string> hash_functor;
+        for (const TypeInfo* type_info : queue)
+        {
+            for (const Signature& signature : type_info->signatures)
+            {
+                shape.signatures.PushBack(signature);
+                shape.name_hashes.PushBack(hash_functor(signature.name));
+            }
+        }
 
-        map.Insert(std::make_pair(type, type_info));
+        return shape;
     }
 }
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "RTTI.h"
-#include "HashMap.h"
+#include "Vector.h"
+#include "FlatHashMap.h"
 #include "Datum.h"
+#include <memory>
 
 namespace FieaGameEngine
 {
@@ -57,18 +59,37 @@ namespace FieaGameEngine
 		~Signature() = default;
 
 		std::string name;
-		Datum::DatumTypes type;
-		size_t size;
-		size_t storage_offset;
+		Datum::DatumTypes type = Datum::DatumTypes::Unknown;
+		size_t size = 0_z;
+		size_t storage_offset = 0_z;
 	};
 
 	class TypeManager final
 	{
 	public:
+		/// <summary>
+		/// The layout every instance of a type is populated with, built when the type (or an ancestor) is registered
+		/// </summary>
+		struct Shape final
+		{
+			/// <summary>
+			/// Every signature of the type and its registered ancestors, base class first
+			/// </summary>
+			Vector<Signature> signatures;
+
+			/// <summary>
+			/// The DefaultHash of every signature's name, in the same order, so instances never hash their prescribed keys
+			/// </summary>
+			Vector<size_t> name_hashes;
+		};
+
 		struct TypeInfo
 		{
-			const Vector<Signature> signatures;
-			RTTI::IdType parent_id_type;
+			Vector<Signature> signatures;
+			RTTI::IdType parent_id_type = 0;
+
+			/// <remarks> Heap allocated so references to it survive the map relocating its slots </remarks>
+			std::unique_ptr<Shape> shape;
 		};
 
 		/// <summary>
@@ -115,19 +136,29 @@ namespace FieaGameEngine
 		~TypeManager() = default;
 
 		/// <summary>
-		/// Queries the map's values at the given key
+		/// Queries the signatures of a type, including the ones inherited from its registered ancestors
 		/// </summary>
 		/// <param name="type"> The key to query the map with </param>
-		/// <returns> The map's value at the key </returns>
-		static const Vector<Signature> GetSignaturesForType(const RTTI::IdType type);
+		/// <remarks> Part of the type's shape, so this never copies or allocates </remarks>
+		/// <remarks> The reference stays valid until the type is removed or the manager is cleared </remarks>
+		/// <returns> The type's signatures, base class first, or an empty vector if the type isn't registered </returns>
+		static const Vector<Signature>& GetSignaturesForType(const RTTI::IdType type);
 		
 		/// <summary>
 		/// Retrieves the type's signature based on the given entry key
 		/// </summary>
 		/// <param name="type"> The key to query the map with </param>
 		/// <param name="entry"> Used for comparing with the name associated with the signature </param>
-		/// <returns> A pointer to the signature found (if any) </returns>
-		static Signature* GetSignature(const RTTI::IdType type, const std::string& entry);
+		/// <returns> A pointer to the signature found (if any), owned by the type manager </returns>
+		static const Signature* GetSignature(const RTTI::IdType type, const std::string& entry);
+
+		/// <summary>
+		/// Queries the layout instances of a type are populated with
+		/// </summary>
+		/// <param name="type"> The key to query the map with </param>
+		/// <remarks> The reference stays valid until the type is removed or the manager is cleared </remarks>
+		/// <returns> The type's shape, or an empty shape if the type isn't registered </returns>
+		static const Shape& GetShape(const RTTI::IdType type);
 		
 		/// <summary>
 		/// Queries the map's containskey
@@ -145,10 +176,10 @@ namespace FieaGameEngine
 		static void AddType(const RTTI::IdType type, const Vector<Signature>& signatures, RTTI::IdType parent_id =std::numeric_limits<size_t>::max());
 		
 		/// <summary>
-		/// Queries the map's remove 
+		/// Queries the map's remove, types derived from it lose the signatures they inherited through it
 		/// <param name="type"> The key to remove from the map </param>
 		/// </summary>
-		static void RemoveType(const RTTI::IdType type) { map.Remove(type); }
+		static void RemoveType(const RTTI::IdType type);
 
 		/// <summary>
 		/// Queries the map's size
@@ -161,7 +192,22 @@ namespace FieaGameEngine
 		static void Clear() { map.Clear(); }
 
 	private:
-		//static HashMap<RTTI::IdType, const Vector<Signature>> map;
-		static HashMap<RTTI::IdType, TypeInfo> map;
+		template <typename TKey, typename TValue>
+		using MapType = FlatHashMap<TKey, TValue>;
+
+		/// <summary>
+		/// Rebuilds the shape of the given type and of every registered type that inherits from it
+		/// </summary>
+		/// <param name="type"> The type whose registration changed </param>
+		static void RebuildShapes(const RTTI::IdType type);
+
+		/// <summary>
+		/// Walks the type's registered ancestors and concatenates their signatures, base class first
+		/// </summary>
+		/// <param name="type"> The type to build the shape of </param>
+		/// <returns> The flattened signatures and their hashes </returns>
+		static Shape BuildShape(const RTTI::IdType type);
+
+		static MapType<RTTI::IdType, TypeInfo> map;
 	};
 }
\ No newline at end of file
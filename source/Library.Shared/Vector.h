@@ -1,18 +1,73 @@
 #pragma once
 
+#include "DebugIterators.h"
 #include "DefaultEquality.h"
 #include "DefaultIncrement.h"
+#include "SizeLiteral.h"
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// The buffer a vector keeps its first InlineCount elements in before it needs the heap
+	/// </summary>
+	template <typename T, size_t InlineCount>
+	class VectorInlineStorage
+	{
+	protected:
+		/// <summary>
+		/// Retrieves the inline buffer as an array of T
+		/// </summary>
+		/// <returns> A pointer to the first inline element </returns>
+		T* InlineData();
+
+		/// <summary>
+		/// Retrieves the inline buffer as an array of T
+		/// </summary>
+		/// <remarks> This is the const version of the other InlineData method </remarks>
+		/// <returns> A pointer to the first inline element </returns>
+		const T* InlineData() const;
+
+	private:
+		alignas(T) std::byte inline_buffer[InlineCount * sizeof(T)];
+	};
+
+	/// <summary>
+	/// No inline buffer at all, an empty vector holds a null array
+	/// </summary>
+	/// <remarks> Empty, so it takes no space in the vector deriving from it </remarks>
+	template <typename T>
+	class VectorInlineStorage<T, 0>
+	{
+	protected:
+		/// <summary>
+		/// Stands in for the inline buffer of a vector that has none
+		/// </summary>
+		/// <returns> Null, the array of a vector with nothing reserved </returns>
+		T* InlineData();
+
+		/// <summary>
+		/// Stands in for the inline buffer of a vector that has none
+		/// </summary>
+		/// <remarks> This is the const version of the other InlineData method </remarks>
+		/// <returns> Null, the array of a vector with nothing reserved </returns>
+		const T* InlineData() const;
+	};
+
 	/// <summary>
 	/// A class which defines a templated Vector. 
 	/// Stores a reference to the array that's used, the size of the vector, and the capacity
 	/// Size refers to the amount of elements in the vector
 	/// Capacity refers to the amount of space that's available in the vector
+	/// With an InlineCount, the first InlineCount elements live inside the vector itself and the array only moves to the heap once more are needed
 	/// </summary>
-	template <typename T>
-	class Vector final
+	/// <remarks> Moving a vector whose elements are inline moves each element, so pointers into it don't survive the move </remarks>
+	template <typename T, size_t InlineCount = 0>
+	class Vector final : private VectorInlineStorage<T, InlineCount>
 	{
 	public:
 		using value_type = T;
@@ -33,7 +88,7 @@ namespace FieaGameEngine
 			using value_type = T;
 			using reference = T;
 			using pointer = T*;
-			using iterator_category = std::random_access_iterator_tag;
+			using iterator_category = std::bidirectional_iterator_tag;
 
 			/// <summary>
 			/// The default constructor with a reference to the vector and the index (position) 
@@ -92,7 +147,7 @@ namespace FieaGameEngine
 			/// Increments a Iterator by altering the index to look at the next element
 			/// </summary>
 			/// <remarks> Specifically handles the prefix increment case </remarks>
-			/// <exception cref="std::runtime_error"> If the owning list is null </exception>
+			/// <exception cref="std::runtime_error"> If the owning list is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <returns> The altered Iterator </returns>
 			Iterator& operator++();
 			
@@ -108,7 +163,7 @@ namespace FieaGameEngine
 			/// Decrements a Iterator by altering the index to look at the previous element
 			/// </summary>
 			/// <remarks> Specifically handles the prefix decrement case </remarks>
-			/// <exception cref="std::runtime_error"> If the owning list is null </exception>
+			/// <exception cref="std::runtime_error"> If the owning list is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <returns> The altered Iterator </returns>
 			Iterator& operator--();
 			
@@ -123,7 +178,7 @@ namespace FieaGameEngine
 			/// <summary>
 			/// The overloaded dereference operator which retrieves the Iterator's data at the index
 			/// </summary>
-			/// <exception cref="std::runtime_error"> If the node is null </exception>
+			/// <exception cref="std::runtime_error"> If the node is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <remarks> Does not alter the vector in the iterator </remarks>
 			/// <returns> The data that the Iterator's vector (at index) points at </returns>
 			T& operator*() const;
@@ -131,7 +186,7 @@ namespace FieaGameEngine
 			/// <summary>
 			/// The overloaded dereference operator which retrieves the Iterator's data at the index
 			/// </summary>
-			/// <exception cref="std::runtime_error"> If the node is null </exception>
+			/// <exception cref="std::runtime_error"> If the node is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <remarks> Does not alter the vector in the iterator </remarks>
 			/// <returns> A pointer to the data that the Iterator's vector (at index) points at </returns>
 			T* operator->() const;
@@ -148,8 +203,6 @@ namespace FieaGameEngine
 			size_t index = 0_z;
 		};
 
-		using value_type = T;
-
 		/// <summary>
 		/// A templated class which defines a non-inheritable Iterator
 		/// Stores a reference to the owning vector and the index this iterator is referring to
@@ -166,7 +219,7 @@ namespace FieaGameEngine
 			using value_type = T;
 			using reference = T;
 			using pointer = T*;
-			using iterator_category = std::random_access_iterator_tag;
+			using iterator_category = std::bidirectional_iterator_tag;
 
 			/// <summary>
 			/// The default constructor with a const list and a node pointer 
@@ -231,7 +284,7 @@ namespace FieaGameEngine
 			/// Increments a Iterator by altering the index to look at the next element
 			/// </summary>
 			/// <remarks> Specifically handles the prefix increment case </remarks>
-			/// <exception cref="std::runtime_error"> If the owning list is null </exception>
+			/// <exception cref="std::runtime_error"> If the owning list is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <returns> The altered ConstIterator </returns>
 			ConstIterator& operator++();
 			
@@ -247,7 +300,7 @@ namespace FieaGameEngine
 			/// Decrements a Iterator by altering the index to look at the next element
 			/// </summary>
 			/// <remarks> Specifically handles the prefix decrement case </remarks>
-			/// <exception cref="std::runtime_error"> If the owning list is null </exception>
+			/// <exception cref="std::runtime_error"> If the owning list is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <returns> The altered ConstIterator </returns>
 			ConstIterator& operator--();
 			
@@ -262,7 +315,7 @@ namespace FieaGameEngine
 			/// <summary>
 			/// The overloaded dereference operator which retrieves the ConstIterator's index's data
 			/// </summary>
-			/// <exception cref="std::runtime_error"> If the owner is null </exception>
+			/// <exception cref="std::runtime_error"> If the owner is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <remarks> Does not alter the vector in the iterator </remarks>
 			/// <returns> The data that the ConstIterator's index points at </returns>
 			const T& operator*() const;
@@ -270,7 +323,7 @@ namespace FieaGameEngine
 			/// <summary>
 			/// The overloaded dereference operator which retrieves the ConstIterator's node's data
 			/// </summary>
-			/// <exception cref="std::runtime_error"> If the node is null </exception>
+			/// <exception cref="std::runtime_error"> If the node is null, only when FIEA_DEBUG_ITERATORS is on </exception>
 			/// <remarks> Does not alter the vector in the iterator </remarks>
 			/// <returns> A pointer to the data that the Iterator's node points at </returns>
 			const T* operator->() const;
@@ -305,6 +358,7 @@ namespace FieaGameEngine
 		/// Copy constructor which creates a new vector based on the existing other vector
 		/// </summary>
 		/// <param name="other"> The original vector to copy </param>
+		/// <remarks> Only reserves what the other's elements need, whatever its capacity </remarks>
 		Vector(const Vector& other);
 		
 		/// <summary>
@@ -312,13 +366,14 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="other"> The original vector to copy</param>
 		/// <remarks> Copy constructor uses r-values instead of l-values </remarks>
+		/// <remarks> A heap array is taken as is, inline elements are moved one at a time </remarks>
 		Vector(Vector&& other) noexcept;
 		
 		/// <summary>
 		/// Sets this vector equal to the other vector
 		/// </summary>
 		/// <param name = "other"> The vector to equate this vector to </param>
-		/// <remarks> Clears and shrinks "this" vector before copying </remarks>
+		/// <remarks> Clears "this" vector before copying, keeping its array if the other's elements fit in it </remarks>
 		/// <returns> The lhs vector (this) after equalizing them </returns>
 		Vector& operator=(const Vector& other);
 		
@@ -369,6 +424,20 @@ namespace FieaGameEngine
 		/// <returns> A mutable reference to the object's data member at the search_index </returns>
 		T& at(const size_t search_index) const;
 
+		/// <summary>
+		/// Retrieves the vector's underlying array without any bounds checking
+		/// </summary>
+		/// <remarks> Only valid until the vector next reallocates </remarks>
+		/// <returns> A pointer to the first element, or null if nothing has been reserved and there's no InlineCount </returns>
+		T* Data();
+
+		/// <summary>
+		/// Retrieves the vector's underlying array without any bounds checking
+		/// </summary>
+		/// <remarks> This is the const version of the other Data method </remarks>
+		/// <returns> A pointer to the first element, or null if nothing has been reserved and there's no InlineCount </returns>
+		const T* Data() const;
+
 		/// <summary>
 		/// Removes the last data member of the vector
 		/// </summary>
@@ -380,6 +449,12 @@ namespace FieaGameEngine
 		/// <returns> True/False determining if the list has objects in it </returns>
 		bool IsEmpty() const;
 
+		/// <summary>
+		/// Queries whether the elements are still stored inside the vector rather than on the heap
+		/// </summary>
+		/// <returns> True while the vector hasn't needed more than InlineCount elements of space, always false for a non-empty vector without an InlineCount </returns>
+		bool IsInline() const;
+
 		/// <summary>
 		/// Queries the vector and retrieves the first data member of the vector
 		/// </summary>
@@ -477,6 +552,40 @@ namespace FieaGameEngine
 		template <typename IncrementFunctor = DefaultIncrement>
 		Iterator PushBack(T&& value);
 
+		/// <summary>
+		/// Constructs a new element in place at the end of the vector
+		/// </summary>
+		/// <param name="args"> The arguments forwarded to T's constructor </param>
+		/// <remarks> The arguments may refer to elements of this vector, the element is built before the array grows </remarks>
+		/// <returns> An iterator that contains this index and the current vector </returns>
+		template <typename IncrementFunctor = DefaultIncrement, typename... Args>
+		Iterator EmplaceBack(Args&&... args);
+
+		/// <summary>
+		/// Constructs a new element in place before the given position, shifting the later elements back
+		/// </summary>
+		/// <param name="position"> The iterator to insert before, end() appends </param>
+		/// <param name="args"> The arguments forwarded to T's constructor </param>
+		/// <exception cref="std::runtime_error"> When the Iterator has the incorrect owner or is past the end </exception>
+		/// <returns> An iterator to the new element </returns>
+		template <typename IncrementFunctor = DefaultIncrement, typename... Args>
+		Iterator Emplace(const Iterator& position, Args&&... args);
+
+		/// <summary>
+		/// Copies a range of elements onto the end of the vector, growing at most once
+		/// </summary>
+		/// <param name="values"> The elements to copy, which must not live in this vector </param>
+		template <typename IncrementFunctor = DefaultIncrement>
+		void Append(std::span<const T> values);
+
+		/// <summary>
+		/// Moves every element of another vector onto the end of this one, growing at most once
+		/// </summary>
+		/// <param name="other"> The vector to take the elements from, left empty afterwards </param>
+		/// <remarks> An empty vector too small for the elements takes the other's heap array instead, trading its own if it has one </remarks>
+		template <typename IncrementFunctor = DefaultIncrement>
+		void Append(Vector&& other);
+
 		/// <summary>
 		/// Reallocates memory for the new array with the provided capacity as space
 		/// </summary>
@@ -513,11 +622,12 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Removes all elements from the vector
 		/// </summary>
+		/// <remarks> Keeps a heap array for reuse, call ShrinkToFit to give it back </remarks>
 		void Clear();
 
 		/// <summary>
 		/// Shrinks the data down if there is excessive capacity
-		/// <remarks> If the size of the vector is already 0, frees the array </remarks>
+		/// <remarks> Frees the heap array once the elements fit inline, or once the size is 0 without an InlineCount </remarks>
 		/// </summary>
 		void ShrinkToFit();
 
@@ -548,17 +658,39 @@ namespace FieaGameEngine
 		bool Remove(const Iterator& first_it, const Iterator& last_it);
 			
 	private:
+		using VectorInlineStorage<T, InlineCount>::InlineData;
+
+		/// <summary>
+		/// Takes the other vector's elements, leaving it empty and inline
+		/// </summary>
+		/// <param name="other"> The vector to take from </param>
+		/// <remarks> Assumes this vector is empty and inline </remarks>
+		void MoveFrom(Vector& other) noexcept;
+
+		/// <summary>
+		/// Frees a heap array and points the vector back at its inline buffer
+		/// </summary>
+		/// <remarks> Assumes the vector is empty </remarks>
+		void ReleaseHeap();
+
+		/// <summary>
+		/// Moves the elements into the inline buffer if new_capacity fits there, otherwise into a heap array of exactly new_capacity elements
+		/// </summary>
+		/// <param name="new_capacity"> The capacity needed, at least the size </param>
+		/// <remarks> Trivially copyable elements already on the heap are realloc'd, anything else (e.g. a string pointing into its own small buffer) is move constructed </remarks>
+		void Relocate(const size_t new_capacity);
+
 		/// <summary>
-		/// A helper method that the copy constructor and equality overload uses to create a vector
+		/// Makes room for at least the given amount of additional elements
 		/// </summary>
-		/// <param name="other"> The vector used to construct the new vector</param>
-		/// <remarks> Reserves new space for the vector based on the other vector </remarks>
-		/// <returns> The new, duplicated vector </returns>
-		Vector& DeepCopyVector(const Vector& other);
+		/// <param name="additional"> The amount of elements about to be added </param>
+		/// <remarks> Grows by the increment functor or to the exact amount needed, whichever is larger </remarks>
+		template <typename IncrementFunctor>
+		void GrowFor(const size_t additional);
 
-		T* data = nullptr;
+		T* data = InlineData();
 		size_t size = 0_z;
-		size_t capacity = 0_z;
+		size_t capacity = InlineCount;
 	};
 }
 
@@ -4,32 +4,62 @@
 #include <cassert>
 #include <stdlib.h>
 #include <initializer_list>
+#include <memory>
 
 namespace FieaGameEngine
 {
-#pragma region Iterator
+#pragma region VectorInlineStorage
+
+	template <typename T, size_t InlineCount>
+	inline T* VectorInlineStorage<T, InlineCount>::InlineData()
+	{
+		return reinterpret_cast<T*>(inline_buffer);
+	}
+
+	template <typename T, size_t InlineCount>
+	inline const T* VectorInlineStorage<T, InlineCount>::InlineData() const
+	{
+		return reinterpret_cast<const T*>(inline_buffer);
+	}
 
 	template <typename T>
-	inline Vector<T>::Iterator::Iterator(Vector& owner, const size_t new_index) :
+	inline T* VectorInlineStorage<T, 0>::InlineData()
+	{
+		return nullptr;
+	}
+
+	template <typename T>
+	inline const T* VectorInlineStorage<T, 0>::InlineData() const
+	{
+		return nullptr;
+	}
+
+#pragma endregion VectorInlineStorage
+
+#pragma region Iterator
+
+	template <typename T, size_t InlineCount>
+	inline Vector<T, InlineCount>::Iterator::Iterator(Vector& owner, const size_t new_index) :
 		owner(&owner),
 		index(new_index)
 	{}
 
-	template <typename T>
-	inline bool Vector<T>::Iterator::operator==(const Iterator& other) const
+	template <typename T, size_t InlineCount>
+	inline bool Vector<T, InlineCount>::Iterator::operator==(const Iterator& other) const
 	{
 		return !(operator!=(other));
 	}
 
-	template <typename T>
-	inline bool Vector<T>::Iterator::operator!=(const Iterator& other) const
+	template <typename T, size_t InlineCount>
+	inline bool Vector<T, InlineCount>::Iterator::operator!=(const Iterator& other) const
 	{
 		return ((owner != other.owner) || (index != other.index));
 	}
 
-	template <typename T>
-	inline typename Vector<T>::Iterator& Vector<T>::Iterator::operator++()
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::Iterator& Vector<T, InlineCount>::Iterator::operator++()
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
@@ -39,12 +69,15 @@ namespace FieaGameEngine
 		{
 			++index;
 		}
+#else
+		++index;
+#endif
 
 		return *this;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator++(int)
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::Iterator Vector<T, InlineCount>::Iterator::operator++(int)
 	{
 		Iterator temp(*this);
 		operator++();
@@ -52,9 +85,10 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::Iterator& Vector<T>::Iterator::operator--()
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::Iterator& Vector<T, InlineCount>::Iterator::operator--()
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
@@ -64,12 +98,15 @@ namespace FieaGameEngine
 		{
 			--index;
 		}
+#else
+		--index;
+#endif
 
 		return *this;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator--(int)
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::Iterator Vector<T, InlineCount>::Iterator::operator--(int)
 	{
 		Iterator temp(*this);
 		operator--();
@@ -77,56 +114,65 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template <typename T>
-	inline T& Vector<T>::Iterator::operator*() const
+	template <typename T, size_t InlineCount>
+	inline T& Vector<T, InlineCount>::Iterator::operator*() const
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
 		}
 
 		return owner->at(index);
+#else
+		return owner->data[index];
+#endif
 	}
 
-	template <typename T>
-	inline T* Vector<T>::Iterator::operator->() const
+	template <typename T, size_t InlineCount>
+	inline T* Vector<T, InlineCount>::Iterator::operator->() const
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
 		}
 
 		return &(owner->at(index));
+#else
+		return &(owner->data[index]);
+#endif
 	}
 
 #pragma endregion Iterator
 
 #pragma region ConstIterator
-	template <typename T>
-	inline Vector<T>::ConstIterator::ConstIterator(const Vector& owner, const size_t new_index) :
+	template <typename T, size_t InlineCount>
+	inline Vector<T, InlineCount>::ConstIterator::ConstIterator(const Vector& owner, const size_t new_index) :
 		owner(&owner), index(new_index)
 	{}
 
-	template <typename T>
-	inline Vector<T>::ConstIterator::ConstIterator(const Iterator& other) :
+	template <typename T, size_t InlineCount>
+	inline Vector<T, InlineCount>::ConstIterator::ConstIterator(const Iterator& other) :
 		owner(other.owner), index(other.index)
 	{}
 
-	template<typename T>
-	inline bool Vector<T>::ConstIterator::operator==(const ConstIterator& other) const
+	template <typename T, size_t InlineCount>
+	inline bool Vector<T, InlineCount>::ConstIterator::operator==(const ConstIterator& other) const
 	{
 		return !(operator!=(other));
 	}
 
-	template <typename T>
-	inline bool Vector<T>::ConstIterator::operator!=(const ConstIterator& other) const
+	template <typename T, size_t InlineCount>
+	inline bool Vector<T, InlineCount>::ConstIterator::operator!=(const ConstIterator& other) const
 	{
 		return ((owner != other.owner) || (index != other.index));
 	}
 
-	template <typename T>
-	inline typename Vector<T>::ConstIterator& Vector<T>::ConstIterator::operator++()
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::ConstIterator& Vector<T, InlineCount>::ConstIterator::operator++()
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
@@ -136,12 +182,15 @@ namespace FieaGameEngine
 		{
 			++index;
 		}
+#else
+		++index;
+#endif
 
 		return *this;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator++(int)
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::ConstIterator Vector<T, InlineCount>::ConstIterator::operator++(int)
 	{
 		ConstIterator temp(*this);
 		operator++();
@@ -149,9 +198,10 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::ConstIterator& Vector<T>::ConstIterator::operator--()
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::ConstIterator& Vector<T, InlineCount>::ConstIterator::operator--()
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
@@ -161,12 +211,15 @@ namespace FieaGameEngine
 		{
 			--index;
 		}
+#else
+		--index;
+#endif
 
 		return *this;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator--(int)
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::ConstIterator Vector<T, InlineCount>::ConstIterator::operator--(int)
 	{
 		ConstIterator temp(*this);
 		operator--();
@@ -174,33 +227,41 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template <typename T>
-	inline const T& Vector<T>::ConstIterator::operator*() const
+	template <typename T, size_t InlineCount>
+	inline const T& Vector<T, InlineCount>::ConstIterator::operator*() const
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
 		}
 
 		return owner->at(index);
+#else
+		return owner->data[index];
+#endif
 	}
 
-	template <typename T>
-	inline const T* Vector<T>::ConstIterator::operator->() const
+	template <typename T, size_t InlineCount>
+	inline const T* Vector<T, InlineCount>::ConstIterator::operator->() const
 	{
+#if FIEA_DEBUG_ITERATORS
 		if (owner == nullptr)
 		{
 			throw std::runtime_error("Owner should not be null. Does this iterator have an owner?");
 		}
 
 		return &(owner->at(index));
+#else
+		return &(owner->data[index]);
+#endif
 	}
 
 #pragma endregion ConstIterator
 
 #pragma region Vector	
-	template <typename T>
-	inline Vector<T>::Vector(const size_t new_capacity)
+	template <typename T, size_t InlineCount>
+	inline Vector<T, InlineCount>::Vector(const size_t new_capacity)
 	{
 		if (new_capacity > 0_z)
 		{
@@ -208,8 +269,8 @@ namespace FieaGameEngine
 		}
 	}
 
-	template <typename T>
-	inline Vector<T>::Vector(std::initializer_list<T> init_list)
+	template <typename T, size_t InlineCount>
+	inline Vector<T, InlineCount>::Vector(std::initializer_list<T> init_list)
 	{
 		if (init_list.size() > 0_z)
 		{
@@ -221,65 +282,55 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(const Vector& other)
+	template <typename T, size_t InlineCount>
+	inline Vector<T, InlineCount>::Vector(const Vector& other)
 	{
-		DeepCopyVector(other);
+		Reserve(other.size);
+		Append(std::span<const T>(other.data, other.size));
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(Vector&& other) noexcept :
-		data(other.data),
-		size(other.size),
-		capacity(other.capacity)
+	template <typename T, size_t InlineCount>
+	inline Vector<T, InlineCount>::Vector(Vector&& other) noexcept
 	{
-		other.data = nullptr;
-		other.size = 0_z;
-		other.capacity = 0_z;
+		MoveFrom(other);
 	}
 
-	template <typename T>
-	inline Vector<T>& Vector<T>::operator=(const Vector& other)
+	template <typename T, size_t InlineCount>
+	inline Vector<T, InlineCount>& Vector<T, InlineCount>::operator=(const Vector& other)
 	{
 		if (this != &other)
 		{
+			// Keeps whatever array is already here if the other's elements fit in it
 			Clear();
-			ShrinkToFit();
-			DeepCopyVector(other);
+			Reserve(other.size);
+			Append(std::span<const T>(other.data, other.size));
 		}
 
 		return *this;
 	}
 
-	template <typename T>
-	inline Vector<T>& Vector<T>::operator=(Vector&& other) noexcept
+	template <typename T, size_t InlineCount>
+	inline Vector<T, InlineCount>& Vector<T, InlineCount>::operator=(Vector&& other) noexcept
 	{
 		if (this != &other)
 		{
 			Clear();
-			free(data);
-
-			data = other.data;
-			size = other.size;
-			capacity = other.capacity;
-
-			other.data = nullptr;
-			other.size = 0_z;
-			other.capacity = 0_z;
+			ReleaseHeap();
+			MoveFrom(other);
 		}
 
 		return *this;
 	}
 
-	template <typename T>
-	inline Vector<T>::~Vector()
+	template <typename T, size_t InlineCount>
+	inline Vector<T, InlineCount>::~Vector()
 	{
 		Clear();
-		free(data);
+		ReleaseHeap();
 	}
 
-	template <typename T>
-	inline T& Vector<T>::operator[](const size_t search_index)
+	template <typename T, size_t InlineCount>
+	inline T& Vector<T, InlineCount>::operator[](const size_t search_index)
 	{
 		if (search_index >= size)
 		{
@@ -289,8 +340,8 @@ namespace FieaGameEngine
 		return data[search_index];
 	}
 
-	template <typename T>
-	inline T& Vector<T>::operator[](const size_t search_index) const
+	template <typename T, size_t InlineCount>
+	inline T& Vector<T, InlineCount>::operator[](const size_t search_index) const
 	{
 		if (search_index >= size)
 		{
@@ -300,8 +351,8 @@ namespace FieaGameEngine
 		return data[search_index];
 	}
 
-	template <typename T>
-	inline T& Vector<T>::at(const size_t search_index)
+	template <typename T, size_t InlineCount>
+	inline T& Vector<T, InlineCount>::at(const size_t search_index)
 	{
 		if ((search_index < 0_z) || (search_index >= size))
 		{
@@ -311,8 +362,8 @@ namespace FieaGameEngine
 		return data[search_index];
 	}
 
-	template <typename T>
-	inline T& Vector<T>::at(const size_t search_index) const
+	template <typename T, size_t InlineCount>
+	inline T& Vector<T, InlineCount>::at(const size_t search_index) const
 	{
 		if ((search_index < 0_z) || (search_index >= size))
 		{
@@ -322,8 +373,20 @@ namespace FieaGameEngine
 		return data[search_index];
 	}
 
-	template <typename T>
-	inline void Vector<T>::PopBack()
+	template <typename T, size_t InlineCount>
+	inline T* Vector<T, InlineCount>::Data()
+	{
+		return data;
+	}
+
+	template <typename T, size_t InlineCount>
+	inline const T* Vector<T, InlineCount>::Data() const
+	{
+		return data;
+	}
+
+	template <typename T, size_t InlineCount>
+	inline void Vector<T, InlineCount>::PopBack()
 	{
 		if (size != 0_z)
 		{
@@ -332,14 +395,20 @@ namespace FieaGameEngine
 		}
 	}
 
-	template <typename T>
-	inline bool Vector<T>::IsEmpty() const
+	template <typename T, size_t InlineCount>
+	inline bool Vector<T, InlineCount>::IsEmpty() const
 	{
 		return (size == 0_z);
 	}
 
-	template <typename T>
-	inline T& Vector<T>::Front()
+	template <typename T, size_t InlineCount>
+	inline bool Vector<T, InlineCount>::IsInline() const
+	{
+		return data == InlineData();
+	}
+
+	template <typename T, size_t InlineCount>
+	inline T& Vector<T, InlineCount>::Front()
 	{
 		if (size == 0_z)
 		{
@@ -348,8 +417,8 @@ namespace FieaGameEngine
 		return data[0_z];
 	}
 
-	template <typename T>
-	inline const T& Vector<T>::Front() const
+	template <typename T, size_t InlineCount>
+	inline const T& Vector<T, InlineCount>::Front() const
 	{
 		if (size == 0_z)
 		{
@@ -358,8 +427,8 @@ namespace FieaGameEngine
 		return data[0_z];
 	}
 
-	template <typename T>
-	inline T& Vector<T>::Back()
+	template <typename T, size_t InlineCount>
+	inline T& Vector<T, InlineCount>::Back()
 	{
 		if ((size == 0_z))
 		{
@@ -368,8 +437,8 @@ namespace FieaGameEngine
 		return data[size-1_z];
 	}
 
-	template <typename T>
-	inline const T& Vector<T>::Back() const
+	template <typename T, size_t InlineCount>
+	inline const T& Vector<T, InlineCount>::Back() const
 	{
 		if ((size == 0_z))
 		{
@@ -378,103 +447,195 @@ namespace FieaGameEngine
 		return data[size-1_z];
 	}
 
-	template <typename T>
-	inline size_t Vector<T>::Size() const
+	template <typename T, size_t InlineCount>
+	inline size_t Vector<T, InlineCount>::Size() const
 	{
 		return size;
 	}
 
-	template <typename T>
-	inline size_t Vector<T>::Capacity() const
+	template <typename T, size_t InlineCount>
+	inline size_t Vector<T, InlineCount>::Capacity() const
 	{
 		return capacity;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::begin()
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::Iterator Vector<T, InlineCount>::begin()
 	{
 		return Iterator(*this, 0_z);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::end()
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::Iterator Vector<T, InlineCount>::end()
 	{
 		return Iterator(*this, size);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::begin() const
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::ConstIterator Vector<T, InlineCount>::begin() const
 	{
 		return ConstIterator(*this, 0_z);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cbegin() const
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::ConstIterator Vector<T, InlineCount>::cbegin() const
 	{
 		return ConstIterator(*this, 0_z);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::end() const
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::ConstIterator Vector<T, InlineCount>::end() const
 	{
 		return ConstIterator(*this, size);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cend() const
+	template <typename T, size_t InlineCount>
+	inline typename Vector<T, InlineCount>::ConstIterator Vector<T, InlineCount>::cend() const
 	{
 		return ConstIterator(*this, size);
 	}
 
-	template <typename T>
+	template <typename T, size_t InlineCount>
 	template <typename IncrementFunctor>
-	typename Vector<T>::Iterator Vector<T>::PushBack(const T& value)
+	typename Vector<T, InlineCount>::Iterator Vector<T, InlineCount>::PushBack(const T& value)
 	{
-		IncrementFunctor incrementor{};
+		return EmplaceBack<IncrementFunctor>(value);
+	}
 
+	template <typename T, size_t InlineCount>
+	template <typename IncrementFunctor>
+	typename Vector<T, InlineCount>::Iterator Vector<T, InlineCount>::PushBack(T&& value)
+	{
+		return EmplaceBack<IncrementFunctor>(std::move(value));
+	}
+
+	template <typename T, size_t InlineCount>
+	template <typename IncrementFunctor, typename... Args>
+	typename Vector<T, InlineCount>::Iterator Vector<T, InlineCount>::EmplaceBack(Args&&... args)
+	{
 		if (size == capacity)
 		{
-			size_t new_capacity = capacity + std::max(1_z, incrementor(size, capacity));
-			Reserve(new_capacity);
+			// The arguments may point into the array about to move, so the element is built first
+			T value(std::forward<Args>(args)...);
+			GrowFor<IncrementFunctor>(1_z);
+			new(data + size)T(std::move(value));
+		}
+		else
+		{
+			new(data + size)T(std::forward<Args>(args)...);
 		}
 
-		new(data + size)T(value);
-		
 		return Iterator(*this, size++);
 	}
 
-	template <typename T>
+	template <typename T, size_t InlineCount>
+	template <typename IncrementFunctor, typename... Args>
+	typename Vector<T, InlineCount>::Iterator Vector<T, InlineCount>::Emplace(const Iterator& position, Args&&... args)
+	{
+		if (position.owner != this || position.index > size)
+		{
+			throw std::runtime_error("Invalid iterator, incorrect owner");
+		}
+
+		if (position.index == size)
+		{
+			return EmplaceBack<IncrementFunctor>(std::forward<Args>(args)...);
+		}
+
+		const size_t index = position.index;
+		T value(std::forward<Args>(args)...);
+		GrowFor<IncrementFunctor>(1_z);
+
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			std::memmove(&data[index + 1_z], &data[index], (size - index) * sizeof(T));
+			new(data + index)T(std::move(value));
+		}
+		else
+		{
+			new(data + size)T(std::move(data[size - 1_z]));
+			std::move_backward(data + index, data + size - 1_z, data + size);
+			data[index] = std::move(value);
+		}
+
+		++size;
+		return Iterator(*this, index);
+	}
+
+	template <typename T, size_t InlineCount>
 	template <typename IncrementFunctor>
-	typename Vector<T>::Iterator Vector<T>::PushBack(T&& value)
+	void Vector<T, InlineCount>::Append(std::span<const T> values)
 	{
-		IncrementFunctor incrementor{};
+		GrowFor<IncrementFunctor>(values.size());
 
-		if (size == capacity)
+		if constexpr (std::is_trivially_copyable_v<T>)
 		{
-			size_t new_capacity = capacity + std::max(1_z, incrementor(size, capacity));
-			Reserve(new_capacity);
+			if (!values.empty())
+			{
+				std::memcpy(data + size, values.data(), values.size_bytes());
+			}
+		}
+		else
+		{
+			std::uninitialized_copy(values.begin(), values.end(), data + size);
 		}
 
-		new(data + size)T(std::forward<T>(value)); 
+		size += values.size();
+	}
 
-		return Iterator(*this, size++);
+	template <typename T, size_t InlineCount>
+	template <typename IncrementFunctor>
+	void Vector<T, InlineCount>::Append(Vector&& other)
+	{
+		if (this == &other || other.size == 0_z)
+		{
+			return;
+		}
+
+		if (size == 0_z && capacity < other.size)
+		{
+			// Other can only be holding more than this fits on the heap, so its array is taken as is
+			if (IsInline())
+			{
+				MoveFrom(other);
+			}
+			else
+			{
+				// Trading arrays avoids the copy and leaves the other vector its spare capacity
+				std::swap(data, other.data);
+				std::swap(size, other.size);
+				std::swap(capacity, other.capacity);
+			}
+
+			return;
+		}
+
+		GrowFor<IncrementFunctor>(other.size);
+
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			std::memcpy(data + size, other.data, other.size * sizeof(T));
+		}
+		else
+		{
+			std::uninitialized_move(other.data, other.data + other.size, data + size);
+		}
+
+		size += other.size;
+		other.Clear();
 	}
 
-	template <typename T>
-	inline void Vector<T>::Reserve(const size_t new_capacity)
+	template <typename T, size_t InlineCount>
+	inline void Vector<T, InlineCount>::Reserve(const size_t new_capacity)
 	{
 		if (new_capacity > capacity)
 		{
-			T* new_data = reinterpret_cast<T*>(realloc(data, new_capacity * sizeof(T)));
-			assert(new_data != nullptr);
-
-			data = new_data;
-			capacity = new_capacity;
+			Relocate(new_capacity);
 		}
 	}
 
-	template <typename T>
-	void Vector<T>::Resize(const size_t new_size)
+	template <typename T, size_t InlineCount>
+	void Vector<T, InlineCount>::Resize(const size_t new_size)
 	{
 		if (new_size < size)
 		{
@@ -496,9 +657,9 @@ namespace FieaGameEngine
 		size = new_size;
 	}
 
-	template <typename T>
+	template <typename T, size_t InlineCount>
 	template <typename EqualityFunctor>
-	typename Vector<T>::Iterator Vector<T>::Find(const T& value)
+	typename Vector<T, InlineCount>::Iterator Vector<T, InlineCount>::Find(const T& value)
 	{
 		EqualityFunctor eq{};
 
@@ -514,15 +675,15 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template <typename T>
+	template <typename T, size_t InlineCount>
 	template <typename EqualityFunctor>
-	inline typename Vector<T>::ConstIterator Vector<T>::Find(const T& value) const
+	inline typename Vector<T, InlineCount>::ConstIterator Vector<T, InlineCount>::Find(const T& value) const
 	{
 		return const_cast<Vector*>(this)->Find<EqualityFunctor>(value);
 	}
 
-	template <typename T>
-	void Vector<T>::Clear()
+	template <typename T, size_t InlineCount>
+	void Vector<T, InlineCount>::Clear()
 	{
 		for (size_t i = 0_z; i < size; ++i)
 		{
@@ -532,35 +693,23 @@ namespace FieaGameEngine
 		size = 0_z;
 	}
 
-	template <typename T>
-	inline void Vector<T>::ShrinkToFit()
+	template <typename T, size_t InlineCount>
+	inline void Vector<T, InlineCount>::ShrinkToFit()
 	{
-		if (capacity > size)
+		if (!IsInline() && capacity > size)
 		{
-			if (size == 0)
-			{
-				free(data);
-				data = nullptr;
-			}
-			else
-			{
-				T* new_data = reinterpret_cast<T*>(realloc(data, size * sizeof(T)));
-				assert(new_data != nullptr);
-				data = new_data;
-			}
-
-			capacity = size;
+			Relocate(size);
 		}
 	}
 
-	template <typename T>
-	bool Vector<T>::Remove(const T& value)
+	template <typename T, size_t InlineCount>
+	bool Vector<T, InlineCount>::Remove(const T& value)
 	{
 		return Remove(Find(value));
 	}
 
-	template <typename T>
-	bool Vector<T>::Remove(const Iterator& it)
+	template <typename T, size_t InlineCount>
+	bool Vector<T, InlineCount>::Remove(const Iterator& it)
 	{
 		if (it.owner != this)
 		{
@@ -570,11 +719,19 @@ namespace FieaGameEngine
 		bool found = false;
 		if (it.index < size)
 		{
-			data[it.index].~T();
-			size_t bytes_to_move = ((size - 1_z) - it.index) * sizeof(T);
-			if (bytes_to_move > 0)
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				data[it.index].~T();
+				size_t bytes_to_move = ((size - 1_z) - it.index) * sizeof(T);
+				if (bytes_to_move > 0)
+				{
+					std::memmove(&data[it.index], &data[it.index + 1], bytes_to_move);
+				}
+			}
+			else
 			{
-				std::memmove(&data[it.index], &data[it.index + 1], bytes_to_move);
+				std::move(data + it.index + 1, data + size, data + it.index);
+				data[size - 1_z].~T();
 			}
 
 			--size;
@@ -585,8 +742,8 @@ namespace FieaGameEngine
 		return found;
 	}
 
-	template <typename T>
-	bool Vector<T>::Remove(const Iterator& first_it, const Iterator& last_it)
+	template <typename T, size_t InlineCount>
+	bool Vector<T, InlineCount>::Remove(const Iterator& first_it, const Iterator& last_it)
 	{
 		if ((first_it.owner != this || last_it.owner != this))
 		{
@@ -602,16 +759,27 @@ namespace FieaGameEngine
 		bool found = false;
 		if (elements_to_remove > 0)
 		{
-			for (size_t index_reference = first_it.index; index_reference != last_it.index; ++index_reference)
+			if constexpr (std::is_trivially_copyable_v<T>)
 			{
-				data[index_reference].~T();
-			}
+				for (size_t index_reference = first_it.index; index_reference != last_it.index; ++index_reference)
+				{
+					data[index_reference].~T();
+				}
 
-			size_t bytes_to_move = (size - last_it.index) * sizeof(T);
+				size_t bytes_to_move = (size - last_it.index) * sizeof(T);
 
-			if (bytes_to_move > 0)
+				if (bytes_to_move > 0)
+				{
+					std::memmove(&data[first_it.index], &data[last_it.index], bytes_to_move);
+				}
+			}
+			else
 			{
-				std::memmove(&data[first_it.index], &data[last_it.index], bytes_to_move);
+				std::move(data + last_it.index, data + size, data + first_it.index);
+				for (size_t index_reference = size - elements_to_remove; index_reference != size; ++index_reference)
+				{
+					data[index_reference].~T();
+				}
 			}
 
 			size -= elements_to_remove;
@@ -622,20 +790,116 @@ namespace FieaGameEngine
 		return found;
 	}
 	
-	template <typename T>
-	inline Vector<T>& Vector<T>::DeepCopyVector(const Vector& other)
+	template <typename T, size_t InlineCount>
+	inline void Vector<T, InlineCount>::MoveFrom(Vector& other) noexcept
 	{
-		if (other.capacity > 0_z)
+		assert(size == 0_z && IsInline());
+
+		if (other.IsInline())
 		{
-			Reserve(other.capacity);
+			// Without an InlineCount, an inline vector is an empty one and there's nothing to take
+			if constexpr (InlineCount > 0)
+			{
+				if constexpr (std::is_trivially_copyable_v<T>)
+				{
+					std::memcpy(data, other.data, other.size * sizeof(T));
+				}
+				else
+				{
+					std::uninitialized_move(other.data, other.data + other.size, data);
+				}
+
+				size = other.size;
+				other.Clear();
+			}
+		}
+		else
+		{
+			data = other.data;
+			size = other.size;
+			capacity = other.capacity;
+
+			other.data = other.InlineData();
+			other.size = 0_z;
+			other.capacity = InlineCount;
+		}
+	}
+
+	template <typename T, size_t InlineCount>
+	inline void Vector<T, InlineCount>::ReleaseHeap()
+	{
+		assert(size == 0_z);
 
-			for (const T& value : other)
+		if (!IsInline())
+		{
+			free(data);
+			data = InlineData();
+			capacity = InlineCount;
+		}
+	}
+
+	template <typename T, size_t InlineCount>
+	void Vector<T, InlineCount>::Relocate(const size_t new_capacity)
+	{
+		assert(new_capacity >= size);
+
+		const bool to_inline = (new_capacity <= InlineCount);
+		if (to_inline && IsInline())
+		{
+			return;
+		}
+
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			// realloc takes a null array as well, so only elements in an inline buffer have to be copied out by hand
+			if (!to_inline && (InlineCount == 0 || !IsInline()))
 			{
-				new(data + size++)T(value);
+				T* new_data = reinterpret_cast<T*>(realloc(data, new_capacity * sizeof(T)));
+				assert(new_data != nullptr);
+				data = new_data;
+				capacity = new_capacity;
+				return;
 			}
 		}
 
-		return *this;
+		T* new_data = to_inline ? InlineData() : reinterpret_cast<T*>(malloc(new_capacity * sizeof(T)));
+		assert(new_data != nullptr || to_inline);
+
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			// Without an InlineCount the inline array is null, but it's only ever moved to once the vector is empty
+			if (new_data != nullptr && size > 0_z)
+			{
+				std::memcpy(new_data, data, size * sizeof(T));
+			}
+		}
+		else
+		{
+			for (size_t index = 0_z; index < size; ++index)
+			{
+				new(new_data + index)T(std::move(data[index]));
+				data[index].~T();
+			}
+		}
+
+		if (!IsInline())
+		{
+			free(data);
+		}
+
+		data = new_data;
+		capacity = to_inline ? InlineCount : new_capacity;
+	}
+
+	template <typename T, size_t InlineCount>
+	template <typename IncrementFunctor>
+	inline void Vector<T, InlineCount>::GrowFor(const size_t additional)
+	{
+		if (size + additional > capacity)
+		{
+			IncrementFunctor incrementor{};
+			Reserve(std::max(size + additional, capacity + std::max(1_z, incrementor(size, capacity))));
+		}
 	}
 
 #pragma endregion Vector
@@ -58,8 +58,7 @@ namespace FieaGameEngine
 			assert(potential_action != nullptr);
 			if (potential_action->Name() == name)
 			{
-				delete potential_action;
-				actions->RemoveAt(index);
+				Scope::Destroy(*potential_action); // Orphans the action, which removes it from the datum
 				return;
 			}
 		}
@@ -14,5 +14,5 @@
 #include <algorithm>
 
 #ifndef UNREFERENCED_LOCAL
-#define UNREFERENCED_LOCAL(P) (P)
+#define UNREFERENCED_LOCAL(P) (void)(P)
 #endif
\ No newline at end of file
@@ -278,6 +278,115 @@ namespace UnitTestLibraryDesktop
 			Assert::ExpectException<std::exception>([&increment, &world_state] {increment.Update(world_state); });
 		}
 
+		TEST_METHOD(TestActionIncrementResolution)
+		{
+			using namespace std::string_literals;
+
+			TypeManager::AddType(Action::TypeIdClass(), Action::Signatures());
+			TypeManager::AddType(ActionIncrement::TypeIdClass(), ActionIncrement::Signatures(), Action::TypeIdClass());
+
+			GameTime game_time;
+			WorldState world_state;
+			world_state.SetGameTime(game_time);
+
+			Scope root;
+			Datum& root_a = root.Append("A"s);
+			root_a = 0.0f;
+
+			ActionIncrement* increment = new ActionIncrement;
+			increment->SetTarget("A"s);
+			root.Adopt(*increment, "Actions"s);
+
+			increment->Update(world_state);
+			increment->Update(world_state);
+			Assert::AreEqual(2.0f, root_a.Get<float>());
+
+			// Shadowing the target closer to the action is picked up on the next update
+			const size_t generation = Scope::Generation();
+			Datum& local_a = increment->AppendAuxililaryAttribute("A"s);
+			Assert::AreNotEqual(generation, Scope::Generation());
+			local_a = 10.0f;
+			increment->Update(world_state);
+			Assert::AreEqual(2.0f, root_a.Get<float>());
+			Assert::AreEqual(11.0f, local_a.Get<float>());
+
+			// Reparenting resolves against the new ancestors
+			Scope other_root;
+			Datum& other_b = other_root.Append("B"s);
+			other_b = 5.0f;
+			other_root.Adopt(*increment, "Actions"s);
+			increment->SetTarget("B"s);
+			increment->Update(world_state);
+			Assert::AreEqual(6.0f, other_b.Get<float>());
+
+			// Retargeting through the prescribed attribute or the mutable accessor is noticed as well
+			Datum& other_c = other_root.Append("C"s);
+			other_c = 0.0f;
+			increment->Find("Target"s)->Set("C"s);
+			increment->Update(world_state);
+			Assert::AreEqual(6.0f, other_b.Get<float>());
+			Assert::AreEqual(1.0f, other_c.Get<float>());
+
+			increment->Target() = "B"s;
+			increment->Update(world_state);
+			Assert::AreEqual(7.0f, other_b.Get<float>());
+			Assert::AreEqual(1.0f, other_c.Get<float>());
+
+			increment->Orphan();
+			Assert::ExpectException<std::runtime_error>([&increment, &world_state] { increment->Update(world_state); });
+
+			delete increment;
+		}
+
+		TEST_METHOD(TestActionIncrementIndex)
+		{
+			using namespace std::string_literals;
+
+			GameTime game_time;
+			WorldState world_state;
+			world_state.SetGameTime(game_time);
+
+			TypeManager::AddType(Action::TypeIdClass(), Action::Signatures());
+			TypeManager::AddType(ActionIncrement::TypeIdClass(), ActionIncrement::Signatures(), Action::TypeIdClass());
+
+			ActionIncrement increment;
+			Assert::AreEqual(0, increment.Index());
+			Datum& speeds = increment.AppendAuxililaryAttribute("Speeds"s);
+			speeds.SetType(Datum::DatumTypes::Float);
+			for (size_t index = 0_z; index < 10_z; ++index)
+			{
+				speeds.PushBack(static_cast<float>(index));
+			}
+
+			increment.SetTarget("Speeds"s);
+			increment.SetStep(0.5f);
+			increment.SetIndex(2);
+			increment.Update(world_state);
+			Assert::AreEqual(2.5f, speeds.Get<float>(2_z));
+			Assert::AreEqual(3.f, speeds.Get<float>(3_z));
+
+			increment.SetIndex(ActionIncrement::AllElements);
+			Assert::AreEqual(ActionIncrement::AllElements, increment["Index"s].Get<int>());
+			increment.Update(world_state);
+			Assert::AreEqual(0.5f, speeds.Get<float>());
+			Assert::AreEqual(3.f, speeds.Get<float>(2_z));
+			Assert::AreEqual(9.5f, speeds.Get<float>(9_z));
+
+			// Vectors step every component
+			Datum& velocities = increment.AppendAuxililaryAttribute("Velocities"s);
+			velocities.SetType(Datum::DatumTypes::Vector);
+			velocities.PushBack(glm::vec4(1.f, 2.f, 3.f, 4.f));
+			velocities.PushBack(glm::vec4(0.f));
+			increment.SetTarget("Velocities"s);
+			increment.Update(world_state);
+			Assert::AreEqual(glm::vec4(1.5f, 2.5f, 3.5f, 4.5f), velocities.Get<glm::vec4>());
+			Assert::AreEqual(glm::vec4(0.5f), velocities.Get<glm::vec4>(1_z));
+
+			increment.SetIndex(10);
+			increment.SetTarget("Speeds"s);
+			Assert::ExpectException<std::runtime_error>([&increment, &world_state] { increment.Update(world_state); });
+		}
+
 		TEST_METHOD(TestClone)
 		{
 			using namespace std::string_literals;
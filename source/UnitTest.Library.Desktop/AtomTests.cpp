@@ -0,0 +1,122 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include "Atom.h"
+#include "DefaultHash.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(AtomTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(ClassInitialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF); // Changes the way that "new" works
+			_CrtMemCheckpoint(&sStartMemState);
+#endif // Debug
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+#ifdef _DEBUG
+
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leak"); // Makes this string a wide character
+			}
+#endif // DEBUG
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			Atom null_atom;
+			Assert::IsTrue(null_atom.IsNull());
+			Assert::AreEqual(""s, null_atom.String());
+			Assert::AreEqual(0_z, null_atom.Hash());
+
+			const size_t table_size = Atom::TableSize();
+			Atom a("Health"s);
+			Assert::IsFalse(a.IsNull());
+			Assert::AreEqual("Health"s, a.String());
+			Assert::AreEqual(DefaultHash<std::string>{}("Health"s), a.Hash());
+			Assert::AreEqual(table_size + 1, Atom::TableSize());
+		}
+
+		TEST_METHOD(TestEquality)
+		{
+			Atom a("Health"s);
+			Atom b("Health"s);
+			Atom c("Mana"s);
+
+			Assert::IsTrue(a == b);
+			Assert::IsFalse(a != b);
+			Assert::IsTrue(a != c);
+			Assert::IsTrue(Atom() == Atom());
+			Assert::IsTrue(a != Atom());
+
+			// Equal strings share one entry
+			Assert::AreEqual(&a.String(), &b.String());
+		}
+
+		TEST_METHOD(TestCopyAndMove)
+		{
+			const size_t table_size = Atom::TableSize();
+			{
+				Atom a("Health"s);
+				Atom copy(a);
+				Assert::IsTrue(copy == a);
+
+				Atom moved(std::move(copy));
+				Assert::IsTrue(moved == a);
+				Assert::IsTrue(copy.IsNull());
+
+				Atom assigned;
+				assigned = a;
+				Assert::IsTrue(assigned == a);
+
+				Atom c("Mana"s);
+				assigned = std::move(c);
+				Assert::AreEqual("Mana"s, assigned.String());
+				Assert::IsTrue(c.IsNull());
+				Assert::AreEqual(table_size + 2, Atom::TableSize());
+			}
+
+			Assert::AreEqual(table_size, Atom::TableSize());
+		}
+
+		TEST_METHOD(TestReferenceCounting)
+		{
+			const size_t table_size = Atom::TableSize();
+
+			Atom a("Health"s);
+			{
+				Atom b("Health"s);
+				Assert::AreEqual(table_size + 1, Atom::TableSize());
+			}
+
+			// The entry survives as long as any atom refers to it
+			Assert::AreEqual(table_size + 1, Atom::TableSize());
+			Assert::AreEqual("Health"s, a.String());
+
+			a = Atom();
+			Assert::AreEqual(table_size, Atom::TableSize());
+
+			// Interning again after removal makes a fresh entry with the same hash
+			Atom c("Health"s);
+			Assert::AreEqual(DefaultHash<std::string>{}("Health"s), c.Hash());
+		}
+
+	private:
+		static _CrtMemState sStartMemState; // Static members before C++17 could only be defined separate from declaration
+	};
+
+	_CrtMemState AtomTests::sStartMemState;
+}
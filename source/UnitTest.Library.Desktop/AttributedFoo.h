@@ -22,14 +22,14 @@ namespace UnitTests
 		int ExternalInteger = 0;
 		float ExternalFloat = 0;
 		std::string ExternalString;
-		glm::vec4 ExternalVector;
-		glm::mat4 ExternalMatrix;
-
-		int ExternalIntegerArray[size];
-		float ExternalFloatArray[size];
-		std::string ExternalStringArray[size];
-		glm::vec4 ExternalVectorArray[size];
-		glm::mat4 ExternalMatrixArray[size];
+		glm::vec4 ExternalVector{};
+		glm::mat4 ExternalMatrix{};
+
+		int ExternalIntegerArray[size]{};
+		float ExternalFloatArray[size]{};
+		std::string ExternalStringArray[size]{};
+		glm::vec4 ExternalVectorArray[size]{};
+		glm::mat4 ExternalMatrixArray[size]{};
 
 		gsl::owner<Scope*> Clone() const override;
 		std::string ToString() const override;
@@ -4,6 +4,8 @@
 #include <CppUnitTest.h> 
 #include "Attributed.h"
 #include "AttributedFoo.h"
+#include "AttributeHandle.h"
+#include "ActionIncrement.h"
 #include "ToStringSpecializations.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -153,7 +155,7 @@ namespace UnitTestLibraryDesktop
 			auto& attributes = a.Attributes();
 			for (const auto& attribute : attributes)
 			{
-				Assert::IsTrue(a.IsAttribute(attribute->first));
+				Assert::IsTrue(a.IsAttribute(attribute.first));
 			}
 
 			Assert::IsFalse(a.IsAttribute(""));
@@ -188,11 +190,57 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(a.IsPrescribedAttribute("this"));
 			Assert::IsFalse(a.IsAuxiliaryAttribute("this"));
 			Assert::IsFalse(a.IsPrescribedAttribute("Hello"));
+			Assert::IsTrue(a.IsPrescribedAttribute(Atom("ExternalInteger")));
+			Assert::IsFalse(a.IsPrescribedAttribute(Atom("Hello")));
 
 			auto expressionA = [&a] { a.AppendAuxililaryAttribute("ExternalInteger"); };
 			Assert::ExpectException<std::invalid_argument>(expressionA);
 		}
 
+		TEST_METHOD(TestAttributeHandle)
+		{
+			using namespace std::string_literals;
+			TypeManager::AddType(AttributedFoo::TypeIdClass(), AttributedFoo::Signatures());
+
+			AttributeHandle null_handle;
+			Assert::IsTrue(null_handle.IsNull());
+
+			const AttributeHandle integer_handle(AttributedFoo::TypeIdClass(), "ExternalInteger"s);
+			const AttributeHandle string_array_handle(AttributedFoo::TypeIdClass(), "ExternalStringArray"s);
+			Assert::IsFalse(integer_handle.IsNull());
+			Assert::AreEqual(AttributedFoo::TypeIdClass(), integer_handle.TypeId());
+			Assert::AreEqual(1_z, integer_handle.Index());
+			Assert::IsTrue(integer_handle == AttributeHandle(AttributedFoo::TypeIdClass(), "ExternalInteger"s));
+			Assert::IsTrue(integer_handle != string_array_handle);
+
+			auto expressionA = [] { AttributeHandle handle(AttributedFoo::TypeIdClass(), "Missing"s); };
+			Assert::ExpectException<std::invalid_argument>(expressionA);
+			auto expressionB = [] { AttributeHandle handle(AttributedFoo::TypeIdClass(), "this"s); };
+			Assert::ExpectException<std::invalid_argument>(expressionB);
+
+			AttributedFoo a;
+			a.ExternalInteger = 10;
+			Assert::AreSame(*a.Find("ExternalInteger"s), a[integer_handle]);
+			Assert::AreEqual(10, a[integer_handle].Get<int>());
+			a[integer_handle].Set(20);
+			Assert::AreEqual(20, a.ExternalInteger);
+
+			// The copy's slots are in the same place, and point at the copy's members
+			const AttributedFoo b(a);
+			Assert::AreSame(*b.Find("ExternalStringArray"s), b[string_array_handle]);
+			Assert::AreEqual(&b.ExternalStringArray[0], &b[string_array_handle].Get<std::string>());
+
+			// Inherited attributes keep their slot in derived types
+			TypeManager::AddType(Action::TypeIdClass(), Action::Signatures());
+			TypeManager::AddType(ActionIncrement::TypeIdClass(), ActionIncrement::Signatures(), Action::TypeIdClass());
+			const AttributeHandle name_handle(Action::TypeIdClass(), "Name"s);
+			Assert::AreEqual(name_handle.Index(), AttributeHandle(ActionIncrement::TypeIdClass(), "Name"s).Index());
+
+			ActionIncrement action;
+			action.SetName("Increment"s);
+			Assert::AreEqual("Increment"s, action[name_handle].Get<std::string>());
+		}
+
 	private:
 		static _CrtMemState sStartMemState; // Static members before C++17 could only be defined separate from declaration
 	};
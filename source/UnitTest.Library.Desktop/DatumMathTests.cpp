@@ -0,0 +1,229 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <CppUnitTest.h>
+#include "DatumMath.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(DatumMathTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(ClassInitialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF); // Changes the way that "new" works
+			_CrtMemCheckpoint(&sStartMemState);
+#endif // Debug
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+#ifdef _DEBUG
+
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leak"); // Makes this string a wide character
+			}
+#endif // DEBUG
+		}
+
+		TEST_METHOD(TestAdd)
+		{
+			// Sizes which end in every tail the vector paths leave behind
+			for (size_t count : { 0_z, 1_z, 3_z, 4_z, 7_z, 8_z, 13_z, 64_z })
+			{
+				Datum floats = MakeFloats(count, 1.f);
+				const Datum addends = MakeFloats(count, 10.f);
+				DatumMath::Add(floats, addends);
+				for (size_t index = 0_z; index < count; ++index)
+				{
+					Assert::AreEqual(11.f + 2.f * static_cast<float>(index), floats.Get<float>(index));
+				}
+
+				DatumMath::Add(floats, 0.5f);
+				for (size_t index = 0_z; index < count; ++index)
+				{
+					Assert::AreEqual(11.5f + 2.f * static_cast<float>(index), floats.Get<float>(index));
+				}
+
+				Datum integers(Datum::DatumTypes::Integer);
+				for (size_t index = 0_z; index < count; ++index)
+				{
+					integers.PushBack(static_cast<int>(index));
+				}
+
+				const Datum integer_addends(integers);
+				DatumMath::Add(integers, integer_addends);
+				DatumMath::Add(integers, 3);
+				for (size_t index = 0_z; index < count; ++index)
+				{
+					Assert::AreEqual(static_cast<int>(index) * 2 + 3, integers.Get<int>(index));
+					Assert::AreEqual(static_cast<int>(index), integer_addends.Get<int>(index));
+				}
+			}
+
+			Datum vectors(Datum::DatumTypes::Vector);
+			vectors.PushBack(glm::vec4(1.f, 2.f, 3.f, 4.f));
+			vectors.PushBack(glm::vec4(5.f, 6.f, 7.f, 8.f));
+			DatumMath::Add(vectors, 1);
+			Assert::AreEqual(glm::vec4(2.f, 3.f, 4.f, 5.f), vectors.Get<glm::vec4>());
+			Assert::AreEqual(glm::vec4(6.f, 7.f, 8.f, 9.f), vectors.Get<glm::vec4>(1_z));
+
+			DatumMath::Add(vectors, vectors);
+			Assert::AreEqual(glm::vec4(12.f, 14.f, 16.f, 18.f), vectors.Get<glm::vec4>(1_z));
+
+			// Mismatched datums
+			Datum integers(Datum::DatumTypes::Integer);
+			integers.PushBack(1);
+			Datum floats = MakeFloats(2_z, 0.f);
+			Assert::ExpectException<std::runtime_error>([&integers] { DatumMath::Add(integers, 1.f); });
+			Assert::ExpectException<std::runtime_error>([&floats, &integers] { DatumMath::Add(floats, integers); });
+			Assert::ExpectException<std::runtime_error>([&floats] { DatumMath::Add(floats, MakeFloats(3_z, 0.f)); });
+
+			Datum strings(Datum::DatumTypes::String);
+			Assert::ExpectException<std::runtime_error>([&strings] { DatumMath::Add(strings, 1); });
+		}
+
+		TEST_METHOD(TestScaleAndMultiplyAdd)
+		{
+			Datum positions = MakeFloats(13_z, 0.f);
+			const Datum velocities = MakeFloats(13_z, 2.f);
+			DatumMath::MultiplyAdd(positions, velocities, 0.5f);
+			for (size_t index = 0_z; index < 13_z; ++index)
+			{
+				const float expected = static_cast<float>(index) + (2.f + static_cast<float>(index)) * 0.5f;
+				Assert::AreEqual(expected, positions.Get<float>(index));
+			}
+
+			DatumMath::Scale(positions, 2.f);
+			Assert::AreEqual(2.f, positions.Get<float>());
+			Assert::AreEqual(2.f * (12.f + 7.f), positions.Get<float>(12_z));
+
+			Datum vectors(Datum::DatumTypes::Vector);
+			vectors.PushBack(glm::vec4(1.f, -2.f, 3.f, 0.f));
+			Datum vector_velocities(vectors);
+			DatumMath::MultiplyAdd(vectors, vector_velocities, 2.f);
+			Assert::AreEqual(glm::vec4(3.f, -6.f, 9.f, 0.f), vectors.Get<glm::vec4>());
+			DatumMath::Scale(vectors, -1.f);
+			Assert::AreEqual(glm::vec4(-3.f, 6.f, -9.f, 0.f), vectors.Get<glm::vec4>());
+			Assert::AreEqual(glm::vec4(1.f, -2.f, 3.f, 0.f), vector_velocities.Get<glm::vec4>());
+
+			Datum integers(Datum::DatumTypes::Integer);
+			integers.PushBack(1);
+			Assert::ExpectException<std::runtime_error>([&integers] { DatumMath::Scale(integers, 2.f); });
+			Assert::ExpectException<std::runtime_error>([&integers] { DatumMath::MultiplyAdd(integers, integers, 2.f); });
+		}
+
+		TEST_METHOD(TestClamp)
+		{
+			Datum floats = MakeFloats(13_z, -6.f);
+			DatumMath::Clamp(floats, -2.f, 3.5f);
+			for (size_t index = 0_z; index < 13_z; ++index)
+			{
+				const float expected = std::min(std::max(static_cast<float>(index) - 6.f, -2.f), 3.5f);
+				Assert::AreEqual(expected, floats.Get<float>(index));
+			}
+
+			Datum integers(Datum::DatumTypes::Integer);
+			for (int value = -10; value < 10; ++value)
+			{
+				integers.PushBack(value);
+			}
+
+			DatumMath::Clamp(integers, -3, 4);
+			for (size_t index = 0_z; index < integers.Size(); ++index)
+			{
+				Assert::AreEqual(std::min(std::max(static_cast<int>(index) - 10, -3), 4), integers.Get<int>(index));
+			}
+
+			Datum vectors(Datum::DatumTypes::Vector);
+			vectors.PushBack(glm::vec4(-5.f, 0.5f, 5.f, 1.f));
+			DatumMath::Clamp(vectors, 0, 1);
+			Assert::AreEqual(glm::vec4(0.f, 0.5f, 1.f, 1.f), vectors.Get<glm::vec4>());
+
+			// NaN stays NaN whether it lands in a vectorized group or in the scalar tail
+			Datum nans = MakeFloats(13_z, -6.f);
+			const float nan = std::numeric_limits<float>::quiet_NaN();
+			nans.Set(nan, 3_z);
+			nans.Set(nan, 9_z);
+			nans.Set(nan, 12_z);
+			DatumMath::Clamp(nans, -2.f, 3.5f);
+			Assert::IsTrue(std::isnan(nans.Get<float>(3_z)));
+			Assert::IsTrue(std::isnan(nans.Get<float>(9_z)));
+			Assert::IsTrue(std::isnan(nans.Get<float>(12_z)));
+			Assert::AreEqual(-2.f, nans.Get<float>(2_z));
+			Assert::AreEqual(3.5f, nans.Get<float>(11_z));
+
+			Assert::ExpectException<std::invalid_argument>([&floats] { DatumMath::Clamp(floats, 1.f, 0.f); });
+			Assert::ExpectException<std::invalid_argument>([&integers] { DatumMath::Clamp(integers, 1, 0); });
+		}
+
+		TEST_METHOD(TestLerp)
+		{
+			Datum from = MakeFloats(9_z, 0.f);
+			const Datum to = MakeFloats(9_z, 10.f);
+			DatumMath::Lerp(from, to, 0.5f);
+			for (size_t index = 0_z; index < 9_z; ++index)
+			{
+				Assert::AreEqual(static_cast<float>(index) + 5.f, from.Get<float>(index));
+			}
+
+			DatumMath::Lerp(from, to, 1.f);
+			Assert::IsTrue(from == to);
+
+			Datum vectors(Datum::DatumTypes::Vector);
+			vectors.PushBack(glm::vec4(0.f));
+			Datum targets(Datum::DatumTypes::Vector);
+			targets.PushBack(glm::vec4(4.f, 8.f, -4.f, 0.f));
+			DatumMath::Lerp(vectors, targets, 0.25f);
+			Assert::AreEqual(glm::vec4(1.f, 2.f, -1.f, 0.f), vectors.Get<glm::vec4>());
+
+			Assert::ExpectException<std::runtime_error>([&vectors, &from] { DatumMath::Lerp(vectors, from, 0.5f); });
+		}
+
+		TEST_METHOD(TestSharedAndExternal)
+		{
+			// A shared array is copied before it's written
+			Datum original = MakeFloats(8_z, 0.f);
+			Datum copy(original);
+			Assert::IsTrue(copy.IsShared());
+			DatumMath::Add(copy, 1.f);
+			Assert::IsFalse(copy.IsShared());
+			Assert::AreEqual(0.f, original.Get<float>());
+			Assert::AreEqual(1.f, copy.Get<float>());
+
+			// External storage is written in place
+			float values[5] = { 1.f, 2.f, 3.f, 4.f, 5.f };
+			Datum external(Datum::DatumTypes::Float);
+			external.SetStorage(values, 5_z);
+			DatumMath::Scale(external, 3.f);
+			Assert::AreEqual(15.f, values[4]);
+		}
+
+	private:
+		static Datum MakeFloats(const size_t count, const float first)
+		{
+			Datum datum(Datum::DatumTypes::Float);
+			for (size_t index = 0_z; index < count; ++index)
+			{
+				datum.PushBack(first + static_cast<float>(index));
+			}
+
+			return datum;
+		}
+
+		static _CrtMemState sStartMemState; // Static members before C++17 could only be defined separate from declaration
+	};
+
+	_CrtMemState DatumMathTests::sStartMemState;
+}
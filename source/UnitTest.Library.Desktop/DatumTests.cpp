@@ -57,13 +57,16 @@ namespace UnitTestLibraryDesktop
 			Datum e(d);
 			Assert::AreEqual(e.Type(), d.Type());
 			Assert::AreEqual(e.Size(), d.Size());
-			Assert::AreEqual(e.Capacity(), d.Capacity());
+			Assert::AreEqual(d.Size(), e.Capacity());		// Inline elements are copied right away, the copy only reserves what it holds
+			Assert::IsTrue(e.IsInline());
+			Assert::IsFalse(e.IsShared());
 			Assert::AreEqual(e.Front<int>(), d.Front<int>());
 
 			Datum f(std::move(e));
 			Assert::AreEqual(f.Type(), d.Type());
 			Assert::AreEqual(f.Size(), d.Size());
-			Assert::AreEqual(f.Capacity(), d.Capacity());
+			Assert::AreEqual(d.Size(), f.Capacity());
+			Assert::IsTrue(f.IsInline());
 			Assert::AreEqual(f.Front<int>(), d.Front<int>());
 		}
 		
@@ -79,7 +82,7 @@ namespace UnitTestLibraryDesktop
 				e = d;
 				Assert::AreEqual(e.Type(), d.Type());
 				Assert::AreEqual(e.Size(), d.Size());
-				Assert::AreEqual(e.Capacity(), d.Capacity());
+				Assert::AreEqual(d.Size(), e.Capacity());
 				Assert::AreEqual(e.Front<int>(), d.Front<int>());
 				Assert::AreEqual(e.Back<int>(), d.Back<int>());
 
@@ -117,7 +120,7 @@ namespace UnitTestLibraryDesktop
 
 				i = k; // External = Internal
 				Assert::AreEqual(i.Size(), k.Size());
-				Assert::AreEqual(i.Capacity(), k.Capacity());
+				Assert::AreEqual(k.Size(), i.Capacity());
 				Assert::AreEqual(i.Front<int>(), k.Front<int>());
 				Assert::AreEqual(i.Back<int>(), k.Back<int>());
 
@@ -135,7 +138,7 @@ namespace UnitTestLibraryDesktop
 				Datum e = d;
 				Assert::AreEqual(e.Type(), d.Type());
 				Assert::AreEqual(e.Size(), d.Size());
-				Assert::AreEqual(e.Capacity(), d.Capacity());
+				Assert::AreEqual(d.Size(), e.Capacity());
 				Assert::AreEqual(e.Front<int>(), d.Front<int>());
 				Assert::AreEqual(e.Back<int>(), d.Back<int>());
 
@@ -152,7 +155,7 @@ namespace UnitTestLibraryDesktop
 				Datum e = d;
 				Assert::AreEqual(e.Type(), d.Type());
 				Assert::AreEqual(e.Size(), d.Size());
-				Assert::AreEqual(e.Capacity(), d.Capacity());
+				Assert::AreEqual(d.Size(), e.Capacity());
 				Assert::AreEqual(e.Front<float>(), d.Front<float>());
 				Assert::AreEqual(e.Back<float>(), d.Back<float>());
 
@@ -171,7 +174,7 @@ namespace UnitTestLibraryDesktop
 				Datum e = d;
 				Assert::AreEqual(e.Type(), d.Type());
 				Assert::AreEqual(e.Size(), d.Size());
-				Assert::AreEqual(e.Capacity(), d.Capacity());
+				Assert::AreEqual(d.Capacity(), e.Capacity());
 				Assert::AreEqual(e.Front<std::string>(), d.Front<std::string>());
 				Assert::AreEqual(e.Back<std::string>(), d.Back<std::string>());
 
@@ -190,7 +193,7 @@ namespace UnitTestLibraryDesktop
 				Datum e = d;
 				Assert::AreEqual(e.Type(), d.Type());
 				Assert::AreEqual(e.Size(), d.Size());
-				Assert::AreEqual(e.Capacity(), d.Capacity());
+				Assert::AreEqual(d.Capacity(), e.Capacity());
 				Assert::AreEqual(e.Front<glm::vec4>(), d.Front<glm::vec4>());
 				Assert::AreEqual(e.Back<glm::vec4>(), d.Back<glm::vec4>());
 
@@ -207,7 +210,7 @@ namespace UnitTestLibraryDesktop
 				Datum e = d;
 				Assert::AreEqual(e.Type(), d.Type());
 				Assert::AreEqual(e.Size(), d.Size());
-				Assert::AreEqual(e.Capacity(), d.Capacity());
+				Assert::AreEqual(d.Capacity(), e.Capacity());
 				Assert::AreEqual(e.Front<glm::mat4>(), d.Front<glm::mat4>());
 				Assert::AreEqual(e.Back<glm::mat4>(), d.Back<glm::mat4>());
 
@@ -233,7 +236,7 @@ namespace UnitTestLibraryDesktop
 				Datum e = d;
 				Assert::AreEqual(e.Type(), d.Type());
 				Assert::AreEqual(e.Size(), d.Size());
-				Assert::AreEqual(e.Capacity(), d.Capacity());
+				Assert::AreEqual(d.Capacity(), e.Capacity());
 				Assert::IsTrue(e.Front<RTTI*>() == d.Front<RTTI*>());
 				Assert::IsTrue(e.Back<RTTI*>() == d.Back<RTTI*>());
 
@@ -272,6 +275,258 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(e.Back<int>(), d_back);
 		}
 
+		TEST_METHOD(TestCopyOnWrite)
+		{
+			using namespace std::string_literals;
+
+			// Writes
+			{
+				Datum d(Datum::DatumTypes::String);
+				d.PushBack("A string long enough to live on the heap"s);
+				d.PushBack("Second"s);
+				Datum e(d);
+				const Datum& const_d = d;
+				const Datum& const_e = e;
+				Assert::IsTrue(d.IsShared());
+				Assert::IsTrue(e.IsShared());
+				Assert::AreSame(const_d.Get<std::string>(), const_e.Get<std::string>());
+				Assert::IsTrue(d == e);
+
+				e.Set("Changed"s, 1_z);
+				Assert::IsFalse(d.IsShared());
+				Assert::IsFalse(e.IsShared());
+				Assert::AreEqual("Second"s, const_d.Get<std::string>(1_z));
+				Assert::AreEqual("Changed"s, const_e.Get<std::string>(1_z));
+				Assert::AreEqual(const_d.Get<std::string>(), const_e.Get<std::string>());
+				Assert::AreNotSame(const_d.Get<std::string>(), const_e.Get<std::string>());
+
+				Datum f(d);
+				f.PushBack("Third"s);
+				Assert::AreEqual(2_z, d.Size());
+				Assert::AreEqual(3_z, f.Size());
+
+				Datum g(d);
+				g.RemoveAt(0_z);
+				g.PopBack();
+				Assert::AreEqual(2_z, d.Size());
+				Assert::AreEqual(0_z, g.Size());
+
+				Datum h(d);
+				h.Resize(1_z);
+				Assert::AreEqual("Second"s, const_d.Get<std::string>(1_z));
+
+				// Clearing a shared datum only drops its reference, the others are untouched and nothing is allocated until the next write
+				Datum i(d);
+				i.Clear();
+				Assert::AreEqual(0_z, i.Size());
+				Assert::AreEqual(0_z, i.Capacity());
+				Assert::IsFalse(i.IsShared());
+				Assert::AreEqual(2_z, d.Size());
+				Assert::AreEqual("Second"s, const_d.Get<std::string>(1_z));
+				i.PushBack("Third"s);
+				Assert::AreEqual("Third"s, i.Get<std::string>());
+				Assert::AreEqual(2_z, d.Size());
+			}
+
+			// Writable references
+			{
+				Datum d(Datum::DatumTypes::Integer);
+				d.PushBack(10);
+				Datum e(d);
+				int& value = e.Get<int>();
+				Assert::IsFalse(e.IsShared());
+				value = 20;
+				Assert::AreEqual(10, d.Front<int>());
+
+				// A datum which handed out a writable reference is copied eagerly from then on
+				Datum f(e);
+				Assert::IsFalse(f.IsShared());
+				value = 30;
+				Assert::AreEqual(20, f.Front<int>());
+
+				Datum g(Datum::DatumTypes::Integer);
+				g = e;
+				Assert::IsFalse(g.IsShared());
+			}
+
+			// Tables share the pointers to their scopes, never the scopes themselves
+			{
+				Scope parent;
+				Scope& child = parent.AppendScope("Children"s);
+				parent.AppendScope("Children"s);
+				parent.AppendScope("Children"s);	// Enough pointers to outgrow the inline buffer
+				Datum& d = parent["Children"s];
+				Datum e(d);
+				Assert::IsTrue(e.IsShared());
+				Assert::AreSame(child, e.Get<Scope>());
+				Assert::IsTrue(e.IsShared());
+
+				e.RemoveAt(0_z);
+				Assert::AreEqual(3_z, d.Size());
+				Assert::AreEqual(2_z, e.Size());
+				Assert::AreSame(child, d.Get<Scope>());
+			}
+
+			// External storage is never shared
+			{
+				int values[2] = { 1, 2 };
+				Datum d(Datum::DatumTypes::Integer);
+				d.SetStorage(values, 2_z);
+				Datum e(d);
+				Assert::IsFalse(e.IsShared());
+				e.Set(5, 1_z);
+				Assert::AreEqual(5, values[1]);
+			}
+		}
+
+		TEST_METHOD(TestAsSpan)
+		{
+			using namespace std::string_literals;
+
+			// Writable views
+			{
+				Datum d(Datum::DatumTypes::Vector);
+				d.PushBack(glm::vec4(1.f));
+				d.PushBack(glm::vec4(2.f));
+				d.PushBack(glm::vec4(3.f));
+
+				std::span<glm::vec4> positions = d.AsSpan<glm::vec4>();
+				Assert::AreEqual(3_z, positions.size());
+				Assert::AreSame(d.Get<glm::vec4>(), positions[0]);
+				for (glm::vec4& position : positions)
+				{
+					position += glm::vec4(1.f);
+				}
+
+				Assert::AreEqual(glm::vec4(4.f), d.Get<glm::vec4>(2_z));
+				Assert::ExpectException<std::runtime_error>([&d] { d.AsSpan<float>(); });
+			}
+
+			// Read only views leave the array shared
+			{
+				Datum d(Datum::DatumTypes::Float);
+				for (size_t index = 0_z; index < 8_z; ++index)
+				{
+					d.PushBack(static_cast<float>(index + 1_z));
+				}
+
+				Datum e(d);
+				std::span<const float> values = e.AsSpan<const float>();
+				Assert::IsTrue(e.IsShared());
+				Assert::AreEqual(3.f, values[0] + values[1]);
+
+				const Datum& const_d = d;
+				Assert::IsTrue(values.data() == const_d.AsSpan<float>().data());
+
+				// A writable view copies the array first
+				std::span<float> writable = e.AsSpan<float>();
+				Assert::IsFalse(e.IsShared());
+				writable[0] = 10.f;
+				Assert::AreEqual(1.f, const_d.Get<float>());
+				Assert::AreEqual(10.f, e.Get<float>());
+			}
+
+			// Empty and external datums
+			{
+				Datum d(Datum::DatumTypes::String);
+				Assert::IsTrue(d.AsSpan<std::string>().empty());
+
+				int values[3] = { 1, 2, 3 };
+				Datum e(Datum::DatumTypes::Integer);
+				e.SetStorage(values, 3_z);
+				std::span<int> external = e.AsSpan<int>();
+				Assert::IsTrue(values == external.data());
+				Assert::AreEqual(3_z, external.size());
+
+				Datum f;
+				Assert::ExpectException<std::runtime_error>([&f] { f.AsSpan<int>(); });
+			}
+		}
+
+		TEST_METHOD(TestInlineStorage)
+		{
+			using namespace std::string_literals;
+
+			// Small numeric payloads live in the datum
+			{
+				Datum d(Datum::DatumTypes::Integer);
+				Assert::IsFalse(d.IsInline());
+				for (int value = 1; value <= 4; ++value)
+				{
+					d.PushBack(value);
+					Assert::IsTrue(d.IsInline());
+				}
+
+				Datum e(Datum::DatumTypes::Vector);
+				e.PushBack(glm::vec4(1.f, 2.f, 3.f, 4.f));
+				Assert::IsTrue(e.IsInline());
+
+				Foo foo;
+				RTTI* foo_ref = &foo;
+				Datum f(Datum::DatumTypes::Pointer);
+				f.PushBack(foo_ref);
+				f.PushBack(foo_ref);
+				Assert::IsTrue(f.IsInline());
+			}
+
+			// Growing past the buffer moves the elements to the heap
+			{
+				Datum d(Datum::DatumTypes::Integer);
+				for (int value = 1; value <= 5; ++value)
+				{
+					d.PushBack(value);
+				}
+
+				Assert::IsFalse(d.IsInline());
+				for (size_t index = 0_z; index < 5_z; ++index)
+				{
+					Assert::AreEqual(static_cast<int>(index) + 1, d.Get<int>(index));
+				}
+
+				Datum e(Datum::DatumTypes::Float);
+				e.Reserve(8_z);
+				Assert::IsFalse(e.IsInline());
+			}
+
+			// Strings and matrices never go inline
+			{
+				Datum d(Datum::DatumTypes::String);
+				d.PushBack("Hi"s);
+				Assert::IsFalse(d.IsInline());
+
+				Datum e(Datum::DatumTypes::Matrix);
+				e.PushBack(glm::mat4(1.f));
+				Assert::IsFalse(e.IsInline());
+			}
+
+			// Copies and moves carry the elements with them
+			{
+				Datum d(Datum::DatumTypes::Float);
+				d.PushBack(1.f);
+				d.PushBack(2.f);
+
+				Datum e(d);
+				Assert::IsTrue(e.IsInline());
+				e.Set(10.f);
+				Assert::AreEqual(1.f, d.Get<float>());
+
+				Datum f(std::move(e));
+				Assert::IsTrue(f.IsInline());
+				Assert::AreEqual(10.f, f.Get<float>());
+				Assert::AreEqual(2.f, f.Get<float>(1_z));
+
+				Datum g(Datum::DatumTypes::Float);
+				g = std::move(f);
+				Assert::IsTrue(g.IsInline());
+				Assert::AreEqual(10.f, g.Get<float>());
+
+				g.Clear();
+				g.PushBack(3.f);
+				Assert::IsTrue(g.IsInline());
+				Assert::AreEqual(3.f, g.Front<float>());
+			}
+		}
+
 		TEST_METHOD(TestType)
 		{
 			Datum d(Datum::DatumTypes::Integer);
@@ -949,6 +1204,80 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TestStringFormatting)
+		{
+			using namespace std::string_literals;
+			using namespace std::string_view_literals;
+
+			// Numbers are written as the shortest text which reads back the same
+			{
+				Datum d(Datum::DatumTypes::Float);
+				d.PushBack(50.f);
+				d.PushBack(0.1f);
+				Assert::AreEqual("50"s, d.ToString());
+				Assert::AreEqual("0.1"s, d.ToString(1_z));
+
+				Datum e(Datum::DatumTypes::Vector);
+				e.PushBack(glm::vec4(1.f, 2.5f, -3.f, 0.f));
+				Assert::AreEqual("vec4(1, 2.5, -3, 0)"s, e.ToString());
+
+				Datum f(Datum::DatumTypes::Matrix);
+				f.PushBack(glm::mat4(1.f));
+				Assert::AreEqual("mat4x4((1, 0, 0, 0), (0, 1, 0, 0), (0, 0, 1, 0), (0, 0, 0, 1))"s, f.ToString());
+			}
+
+			// Appending reuses the caller's buffer
+			{
+				Datum d(Datum::DatumTypes::Integer);
+				d.PushBack(-7);
+				d.PushBack(42);
+				std::string buffer = "Values: "s;
+				d.AppendToString(buffer);
+				buffer += ' ';
+				d.AppendToString(buffer, 1_z);
+				Assert::AreEqual("Values: -7 42"s, buffer);
+
+				Datum unknown;
+				Assert::ExpectException<std::runtime_error>([&unknown, &buffer] { unknown.AppendToString(buffer); });
+			}
+
+			// Parsing tolerates the spacing and signs scanf did
+			{
+				Datum d(Datum::DatumTypes::Integer);
+				d.PushBackFromString("  +12"sv);
+				d.PushBackFromString("-3 apples"s);
+				Assert::AreEqual(12, d.Get<int>());
+				Assert::AreEqual(-3, d.Get<int>(1_z));
+
+				Datum e(Datum::DatumTypes::Vector);
+				e.PushBackFromString("vec4(1,2,3,4)"sv);
+				e.PushBackFromString(" vec4( 0.5 , -1e2, +3, 4 )"sv);
+				Assert::AreEqual(glm::vec4(1.f, 2.f, 3.f, 4.f), e.Get<glm::vec4>());
+				Assert::AreEqual(glm::vec4(0.5f, -100.f, 3.f, 4.f), e.Get<glm::vec4>(1_z));
+
+				Datum f(Datum::DatumTypes::Matrix);
+				f.PushBackFromString("mat4x4((1,2,3,4),(5,6,7,8),(9,10,11,12),(13,14,15,16))"sv);
+				Assert::AreEqual(2.f, f.Get<glm::mat4>()[0][1]);
+				Assert::AreEqual(16.f, f.Get<glm::mat4>()[3][3]);
+			}
+
+			// Malformed text
+			{
+				Datum d(Datum::DatumTypes::Integer);
+				Assert::ExpectException<std::invalid_argument>([&d] { d.PushBackFromString("abc"sv); });
+				Assert::ExpectException<std::invalid_argument>([&d] { d.PushBackFromString(""sv); });
+				Assert::ExpectException<std::out_of_range>([&d] { d.PushBackFromString("99999999999"sv); });
+
+				Datum e(Datum::DatumTypes::Vector);
+				Assert::ExpectException<std::invalid_argument>([&e] { e.PushBackFromString("vec4(1, 2)"sv); });
+				Assert::ExpectException<std::invalid_argument>([&e] { e.PushBackFromString("vec3(1, 2, 3)"sv); });
+
+				Datum f(Datum::DatumTypes::Matrix);
+				Assert::ExpectException<std::invalid_argument>([&f] { f.PushBackFromString("mat4x4((1, 2, 3, 4))"sv); });
+				Assert::AreEqual(0_z, d.Size() + e.Size() + f.Size());
+			}
+		}
+
 		TEST_METHOD(TestPushBack)
 		{
 			using namespace std::string_literals;
@@ -976,6 +1305,65 @@ namespace UnitTestLibraryDesktop
 			Assert::ExpectException<std::runtime_error>(expressionG);
 		}
 
+		TEST_METHOD(TestAppend)
+		{
+			using namespace std::string_literals;
+
+			// Copies from a span, growing once
+			{
+				const int values[6] = { 1, 2, 3, 4, 5, 6 };
+				Datum d(Datum::DatumTypes::Integer);
+				d.PushBack(0);
+				d.Append(std::span<const int>(values));
+				Assert::AreEqual(7_z, d.Size());
+				Assert::AreEqual(6, d.Back<int>());
+				Assert::IsFalse(d.IsInline());
+
+				Datum e(d);
+				e.Append<int>(values);
+				Assert::AreEqual(7_z, d.Size());
+				Assert::AreEqual(13_z, e.Size());
+
+				const glm::vec4 vectors[1] = { glm::vec4(1.f) };
+				Datum f(Datum::DatumTypes::Vector);
+				f.Append(std::span<const glm::vec4>(vectors));
+				Assert::IsTrue(f.IsInline());
+				Assert::AreEqual(glm::vec4(1.f), f.Front<glm::vec4>());
+
+				Assert::ExpectException<std::runtime_error>([&f, &values] { f.Append<int>(values); });
+
+				Datum g(Datum::DatumTypes::Integer);
+				int storage[2] = { 0, 0 };
+				g.SetStorage(storage, 2_z);
+				Assert::ExpectException<std::runtime_error>([&g, &values] { g.Append<int>(values); });
+			}
+			// Moves from a vector
+			{
+				Vector<std::string> strings{ "A string long enough to live on the heap"s, "Second"s };
+				const char* buffer = strings.Front().c_str();
+
+				Datum d(Datum::DatumTypes::String);
+				d.PushBack("First"s);
+				d.Append(std::move(strings));
+				Assert::AreEqual(3_z, d.Size());
+				Assert::IsTrue(strings.IsEmpty());
+				Assert::IsTrue(buffer == d.Get<std::string>(1_z).c_str());
+				Assert::AreEqual("Second"s, d.Back<std::string>());
+			}
+			// r-value strings
+			{
+				std::string value = "A string long enough to live on the heap"s;
+				const char* buffer = value.c_str();
+
+				Datum d(Datum::DatumTypes::String);
+				d.PushBack("First"s);
+				Datum e(d);
+				e.Set(std::move(value));
+				Assert::IsTrue(buffer == e.Front<std::string>().c_str());
+				Assert::AreEqual("First"s, d.Front<std::string>());
+			}
+		}
+
 		TEST_METHOD(TestPopBack)
 		{
 			// Integer
@@ -991,7 +1379,7 @@ namespace UnitTestLibraryDesktop
 				Assert::AreEqual(1_z, d.Size());
 				d.PopBack();
 				Assert::AreEqual(0_z, d.Size());
-				Assert::AreEqual(3_z, d.Capacity());
+				Assert::AreEqual(4_z, d.Capacity());
 			}
 			// String
 			{
@@ -1008,7 +1396,7 @@ namespace UnitTestLibraryDesktop
 				Assert::AreEqual(1_z, d.Size());
 				d.PopBack();
 				Assert::AreEqual(0_z, d.Size());
-				Assert::AreEqual(3_z, d.Capacity());
+				Assert::AreEqual(4_z, d.Capacity());
 			}
 		}
 
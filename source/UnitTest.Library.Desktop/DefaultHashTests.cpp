@@ -1,7 +1,10 @@
 #include "pch.h"
 #include <crtdbg.h>
+#include <cstring>
 #include <exception>
 #include <CppUnitTest.h>
+#include <set>
+#include <vector>
 #include "SList.h"
 #include "Vector.h"
 #include "HashMap.h"
@@ -123,7 +126,7 @@ namespace UnitTestLibraryDesktop
 				char hello[6] = "Hello";
 				char goodbye[8] = "Goodbye";
 				char hello_copy[6];
-				strcpy_s(hello_copy, hello);
+				std::memcpy(hello_copy, hello, sizeof(hello));
 				DefaultHash<char*> hash_functor;
 
 				Assert::AreEqual(hash_functor(hello), hash_functor(hello));
@@ -138,7 +141,7 @@ namespace UnitTestLibraryDesktop
 				const char* hello = "Hello";
 				const char* goodbye = "Goodbye";
 				char hello_copy[6];
-				strcpy_s(hello_copy, hello);
+				std::memcpy(hello_copy, hello, std::strlen(hello) + 1);
 				DefaultHash<const char*> hash_functor;
 
 				Assert::AreEqual(hash_functor(hello), hash_functor(hello));
@@ -155,7 +158,7 @@ namespace UnitTestLibraryDesktop
 				char* const ptr_hello = hello;
 				char* const ptr_goodbye = goodbye;
 				char hello_copy[6];
-				strcpy_s(hello_copy, hello);
+				std::memcpy(hello_copy, hello, sizeof(hello));
 				DefaultHash<char* const> hash_functor;
 
 				Assert::AreEqual(hash_functor(ptr_hello), hash_functor(ptr_hello));
@@ -170,7 +173,7 @@ namespace UnitTestLibraryDesktop
 				const char* const hello = "Hello";
 				const char* const goodbye = "Goodbye";
 				char hello_copy[6];
-				strcpy_s(hello_copy, hello);
+				std::memcpy(hello_copy, hello, std::strlen(hello) + 1);
 				DefaultHash<const char* const> hash_functor;
 
 				Assert::AreEqual(hash_functor(hello), hash_functor(hello));
@@ -198,6 +201,63 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(hash_functor(a), hash_functor(c));
 		}
 
+		TEST_METHOD(HashPermutations)
+		{
+			using namespace std::string_literals;
+			DefaultHash<std::string> hash_functor;
+
+			// Same bytes in a different order must not land on the same hash
+			Assert::AreNotEqual(hash_functor("ab"s), hash_functor("ba"s));
+			Assert::AreNotEqual(hash_functor("Health"s), hash_functor("htlaeH"s));
+			Assert::AreNotEqual(hash_functor("Position"s), hash_functor("Positoin"s));
+			Assert::AreNotEqual(hash_functor("Actions"s), hash_functor("Actions\0"s));
+			Assert::AreNotEqual(hash_functor(""s), hash_functor("\0"s));
+
+			// Keys longer than a single 48 byte block
+			const std::string long_key(100, 'a');
+			std::string long_key_changed(long_key);
+			long_key_changed[77] = 'b';
+			Assert::AreNotEqual(hash_functor(long_key), hash_functor(long_key_changed));
+
+			DefaultHash<const std::string> const_hash_functor;
+			Assert::AreEqual(hash_functor("Health"s), const_hash_functor("Health"s));
+		}
+
+		TEST_METHOD(HashDistribution)
+		{
+			const size_t key_count = 4096_z;
+			const size_t bucket_count = 1024_z;
+			DefaultHash<std::string> hash_functor;
+
+			std::set<size_t> hashes;
+			std::vector<size_t> buckets(bucket_count);
+			const char* prefixes[] = { "Attribute", "Position", "Actions", "Child", "" };
+			for (size_t index = 0_z; index < key_count; ++index)
+			{
+				const std::string key = prefixes[index % std::size(prefixes)] + std::to_string(index);
+				const size_t hash = hash_functor(key);
+				hashes.insert(hash);
+				++buckets[hash % bucket_count];
+			}
+
+			Assert::AreEqual(key_count, hashes.size());
+
+			// Four keys per bucket on average: a uniform hash leaves about 2% of the buckets empty and none badly overfull
+			const size_t empty_buckets = static_cast<size_t>(std::count(buckets.begin(), buckets.end(), 0_z));
+			const size_t longest_bucket = *std::max_element(buckets.begin(), buckets.end());
+			Assert::IsTrue(empty_buckets < 64_z);
+			Assert::IsTrue(longest_bucket < 16_z);
+
+			DefaultHash<int> int_hash_functor;
+			std::fill(buckets.begin(), buckets.end(), 0_z);
+			for (int value = 0; value < static_cast<int>(key_count); ++value)
+			{
+				// Multiples of the bucket count are the worst case for a plain modulus
+				++buckets[int_hash_functor(value * static_cast<int>(bucket_count)) % bucket_count];
+			}
+			Assert::IsTrue(*std::max_element(buckets.begin(), buckets.end()) < 16_z);
+		}
+
 	private:
 		static _CrtMemState sStartMemState; // Static members before C++17 could only be defined separate from declaration
 	};
@@ -77,6 +77,43 @@ namespace UnitTestLibraryDesktop
 			Assert::IsFalse(rtti->Equals(&foo));
 		}
 
+		TEST_METHOD(TestTypeDescriptor)
+		{
+			using namespace std::string_view_literals;
+			TestMonster monster;
+			const RTTI* rtti = &monster;
+
+			// TestMonster -> Entity -> Attributed -> Scope -> RTTI
+			const RTTI::TypeDescriptor& descriptor = rtti->TypeDescriptorInstance();
+			Assert::AreSame(TestMonster::TypeDescriptorClass(), descriptor);
+			Assert::AreEqual(TestMonster::TypeDepth, descriptor.depth);
+			Assert::AreEqual(4_z, descriptor.depth);
+			Assert::AreEqual(Scope::TypeIdClass(), descriptor.ancestor_ids[Scope::TypeDepth - 1]);
+			Assert::AreEqual(Attributed::TypeIdClass(), descriptor.ancestor_ids[Attributed::TypeDepth - 1]);
+			Assert::AreEqual(Entity::TypeIdClass(), descriptor.ancestor_ids[Entity::TypeDepth - 1]);
+			Assert::AreEqual(TestMonster::TypeIdClass(), descriptor.ancestor_ids[TestMonster::TypeDepth - 1]);
+			Assert::AreEqual(0_z, descriptor.ancestor_ids[TestMonster::TypeDepth]);
+			Assert::IsTrue(descriptor.ancestor_names[Entity::TypeDepth - 1] == "Entity"sv);
+
+			Assert::IsTrue(rtti->Is<Scope>());
+			Assert::IsTrue(rtti->Is<Entity>());
+			Assert::IsTrue(rtti->Is<TestMonster>());
+			Assert::IsFalse(rtti->Is<Action>());
+			Assert::IsFalse(rtti->Is<Foo>());
+
+			// Power sits at the same depth as Entity, in another branch
+			Assert::IsFalse(rtti->Is<Power>());
+			Assert::IsFalse(rtti->Is("Power"sv));
+			Assert::IsTrue(rtti->Is("Attributed"sv));
+			Assert::IsFalse(rtti->Is("RTTI"sv));
+
+			// A base only reaches up its own ancestry
+			Entity entity;
+			Assert::IsTrue(entity.Is<Entity>());
+			Assert::IsFalse(entity.Is<TestMonster>());
+			Assert::IsNull(entity.As<TestMonster>());
+		}
+
 		TEST_METHOD(TestJsonRead)
 		{
 			using namespace std::string_literals;
@@ -0,0 +1,315 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <exception>
+#include <CppUnitTest.h>
+#include "Foo.h"
+#include "FlatHashMap.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(FlatHashMapTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(ClassInitialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF); // Changes the way that "new" works
+			_CrtMemCheckpoint(&sStartMemState);
+#endif // Debug
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+#ifdef _DEBUG
+
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leak"); // Makes this string a wide character
+			}
+#endif // DEBUG
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			FlatHashMap<int, std::string> map(5_z);
+			Assert::AreEqual(0_z, map.Size());
+			Assert::AreEqual(16_z, map.BucketSize());
+
+			FlatHashMap<int, std::string> big_map(100_z);
+			Assert::AreEqual(128_z, big_map.BucketSize());
+
+			auto expression = [] { FlatHashMap<int, std::string> map(0_z); };
+			Assert::ExpectException<std::invalid_argument>(expression);
+		}
+
+		TEST_METHOD(TestCopyAndMove)
+		{
+			FlatHashMap<std::string, Foo> map;
+			map.Insert(std::make_pair("Hello", Foo(10)));
+			map.Insert(std::make_pair("Goodbye", Foo(49)));
+
+			FlatHashMap<std::string, Foo> copy_map(map);
+			Assert::AreEqual(2_z, copy_map.Size());
+			Assert::AreEqual(Foo(10), copy_map.at("Hello"));
+
+			FlatHashMap<std::string, Foo> moved_map(std::move(copy_map));
+			Assert::AreEqual(2_z, moved_map.Size());
+			Assert::AreEqual(Foo(49), moved_map.at("Goodbye"));
+
+			FlatHashMap<std::string, Foo> assigned_map;
+			assigned_map = map;
+			Assert::AreEqual(2_z, assigned_map.Size());
+			assigned_map = std::move(moved_map);
+			Assert::AreEqual(2_z, assigned_map.Size());
+			Assert::AreEqual(Foo(10), assigned_map.at("Hello"));
+
+			// A moved-from map is still usable
+			copy_map.Insert(std::make_pair("Again", Foo(3)));
+			Assert::AreEqual(1_z, copy_map.Size());
+			Assert::AreEqual(Foo(3), copy_map.at("Again"));
+		}
+
+		TEST_METHOD(TestInsertAndFind)
+		{
+			FlatHashMap<std::string, Foo> map;
+			auto [was_inserted, it] = map.Insert(std::make_pair("Hello", Foo(10)));
+			Assert::IsTrue(was_inserted);
+			Assert::AreEqual(std::string("Hello"), it->first);
+
+			auto [was_inserted_again, it_again] = map.Insert(std::make_pair("Hello", Foo(20)));
+			Assert::IsFalse(was_inserted_again);
+			Assert::IsTrue(it == it_again);
+			Assert::AreEqual(Foo(10), it_again->second);
+			Assert::AreEqual(1_z, map.Size());
+
+			Assert::IsTrue(map.Find("Goodbye") == map.end());
+			Assert::IsTrue(map.Find("Hello") == it);
+
+			const FlatHashMap<std::string, Foo> const_map(map);
+			Assert::IsTrue(const_map.Find("Goodbye") == const_map.end());
+			Assert::AreEqual(Foo(10), (*const_map.Find("Hello")).second);
+		}
+
+		TEST_METHOD(TestBracketOperator)
+		{
+			FlatHashMap<int, std::string> map;
+			map[1] = "One";
+			Assert::AreEqual(1_z, map.Size());
+			Assert::AreEqual(std::string("One"), map[1]);
+			Assert::AreEqual(1_z, map.Size());
+
+			const FlatHashMap<int, std::string> const_map(map);
+			Assert::AreEqual(std::string("One"), const_map[1]);
+
+			auto expression = [&const_map] { const_map[2]; };
+			Assert::ExpectException<std::runtime_error>(expression);
+		}
+
+		TEST_METHOD(TestRemove)
+		{
+			FlatHashMap<int, std::string> map;
+			for (int32_t i = 0; i < 100; ++i)
+			{
+				map.Insert(std::make_pair(i, std::to_string(i)));
+			}
+
+			map.Remove(1000);
+			Assert::AreEqual(100_z, map.Size());
+
+			for (int32_t i = 0; i < 100; i += 2)
+			{
+				map.Remove(i);
+			}
+
+			Assert::AreEqual(50_z, map.Size());
+			for (int32_t i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual((i % 2) != 0, map.ContainsKey(i));
+			}
+
+			// Churn through many more keys than slots so tombstones have to be reclaimed
+			const size_t slot_count = map.BucketSize();
+			for (int32_t i = 100; i < 10000; ++i)
+			{
+				map.Insert(std::make_pair(i, std::to_string(i)));
+				map.Remove(i);
+			}
+
+			Assert::AreEqual(50_z, map.Size());
+			Assert::AreEqual(slot_count, map.BucketSize());
+			Assert::AreEqual(std::string("99"), map.at(99));
+		}
+
+		TEST_METHOD(TestRehash)
+		{
+			FlatHashMap<int, std::string> map;
+			for (int32_t i = 0; i < 10; ++i)
+			{
+				map.Insert(std::make_pair(i, std::to_string(i)));
+			}
+
+			auto expression = [&map] { map.Resize(0_z); };
+			Assert::ExpectException<std::invalid_argument>(expression);
+
+			map.Rehash(100_z);
+			Assert::AreEqual(128_z, map.BucketSize());
+
+			// Never drops below what the max load factor allows
+			map.Rehash(1_z);
+			Assert::AreEqual(16_z, map.BucketSize());
+
+			map.Resize(64_z);
+			Assert::AreEqual(64_z, map.BucketSize());
+
+			for (int32_t i = 0; i < 10; ++i)
+			{
+				Assert::AreEqual(std::to_string(i), map.at(i));
+			}
+		}
+
+		TEST_METHOD(TestReserve)
+		{
+			FlatHashMap<int, std::string> map;
+			map.Reserve(100_z);
+			const size_t slot_count = map.BucketSize();
+			Assert::IsTrue(static_cast<float>(slot_count) * map.MaxLoadFactor() >= 100.0f);
+
+			// Never shrinks
+			map.Reserve(10_z);
+			Assert::AreEqual(slot_count, map.BucketSize());
+
+			for (int32_t i = 0; i < 100; ++i)
+			{
+				map.Insert(std::make_pair(i, std::to_string(i)));
+			}
+			Assert::AreEqual(slot_count, map.BucketSize());
+		}
+
+		TEST_METHOD(TestLoadFactor)
+		{
+			FlatHashMap<int, std::string> map;
+			Assert::AreEqual(0.0f, map.LoadFactor());
+			Assert::AreEqual(0.875f, map.MaxLoadFactor());
+
+			for (int32_t i = 0; i < 8; ++i)
+			{
+				map.Insert(std::make_pair(i, std::to_string(i)));
+			}
+			Assert::AreEqual(0.5f, map.LoadFactor());
+
+			auto expressionA = [&map] { map.SetMaxLoadFactor(0.0f); };
+			Assert::ExpectException<std::invalid_argument>(expressionA);
+			auto expressionB = [&map] { map.SetMaxLoadFactor(1.5f); };
+			Assert::ExpectException<std::invalid_argument>(expressionB);
+
+			map.SetMaxLoadFactor(0.25f);
+			Assert::AreEqual(0.25f, map.MaxLoadFactor());
+			Assert::AreEqual(32_z, map.BucketSize());
+			Assert::IsTrue(map.LoadFactor() <= map.MaxLoadFactor());
+		}
+
+		TEST_METHOD(TestAutomaticRehash)
+		{
+			FlatHashMap<int, std::string> map;
+			for (int32_t i = 0; i < 1000; ++i)
+			{
+				auto [was_inserted, it] = map.Insert(std::make_pair(i, std::to_string(i)));
+				Assert::IsTrue(was_inserted);
+				Assert::AreEqual(i, it->first);
+				Assert::IsTrue(map.LoadFactor() <= map.MaxLoadFactor());
+			}
+
+			Assert::AreEqual(1000_z, map.Size());
+
+			size_t counter = 0;
+			for (auto& pair : map)
+			{
+				UNREFERENCED_LOCAL(pair);
+				++counter;
+			}
+			Assert::AreEqual(1000_z, counter);
+
+			for (int32_t i = 0; i < 1000; ++i)
+			{
+				Assert::AreEqual(std::to_string(i), map.at(i));
+			}
+		}
+
+		TEST_METHOD(TestClear)
+		{
+			FlatHashMap<std::string, Foo> map;
+			map.Insert(std::make_pair("Hello", Foo(10)));
+			Assert::AreEqual(1_z, map.Size());
+
+			map.Clear();
+			Assert::AreEqual(0_z, map.Size());
+			Assert::IsTrue(map.begin() == map.end());
+
+			map.Insert(std::make_pair("Hello", Foo(10)));
+			Assert::AreEqual(1_z, map.Size());
+		}
+
+		TEST_METHOD(TestAt)
+		{
+			FlatHashMap<std::string, Foo> map;
+			map.Insert(std::make_pair("Hello", Foo(10)));
+			Assert::AreEqual(Foo(10), map.at("Hello"));
+
+			auto expressionA = [&map] { map.at("Goodbye"); };
+			Assert::ExpectException<std::runtime_error>(expressionA);
+
+			const FlatHashMap<std::string, Foo> const_map = map;
+			Assert::AreEqual(Foo(10), const_map.at("Hello"));
+
+			auto expressionB = [&const_map] { const_map.at("Goodbye"); };
+			Assert::ExpectException<std::runtime_error>(expressionB);
+		}
+
+		TEST_METHOD(TestIterators)
+		{
+			FlatHashMap<int, std::string> map;
+			Assert::IsTrue(map.begin() == map.end());
+			Assert::IsTrue(map.cbegin() == map.cend());
+
+			auto expressionA = [&map] { *map.end(); };
+			Assert::ExpectException<std::runtime_error>(expressionA);
+
+			FlatHashMap<int, std::string>::Iterator default_it;
+			auto expressionB = [&default_it] { ++default_it; };
+			Assert::ExpectException<std::runtime_error>(expressionB);
+
+			map.Insert(std::make_pair(10, "Hello"));
+			map.Insert(std::make_pair(45, "Goodbye"));
+
+			size_t counter = 0;
+			for (FlatHashMap<int, std::string>::Iterator it = map.begin(); it != map.end(); it++)
+			{
+				++counter;
+			}
+			Assert::AreEqual(map.Size(), counter);
+
+			const FlatHashMap<int, std::string> const_map(map);
+			counter = 0;
+			for (FlatHashMap<int, std::string>::ConstIterator it = const_map.begin(); it != const_map.end(); ++it)
+			{
+				++counter;
+			}
+			Assert::AreEqual(const_map.Size(), counter);
+
+			FlatHashMap<int, std::string>::ConstIterator converted = map.begin();
+			Assert::IsTrue(converted == map.cbegin());
+		}
+
+	private:
+		static _CrtMemState sStartMemState; // Static members before C++17 could only be defined separate from declaration
+	};
+
+	_CrtMemState FlatHashMapTests::sStartMemState;
+}
@@ -0,0 +1,372 @@
+#pragma once
+
+// Stands in for the Microsoft CppUnitTest framework header when building the unit tests with GoogleTest (see CMakeLists.txt)
+// Only the subset of the framework the tests actually use is provided: TEST_CLASS, TEST_METHOD, TEST_METHOD_INITIALIZE,
+// TEST_METHOD_CLEANUP, Assert and ToString. Every TEST_METHOD is registered as its own GoogleTest test named Class.Method
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <source_location>
+#include <sstream>
+#include <string>
+#include <strings.h>
+#include <type_traits>
+
+#define RETURN_WIDE_STRING(inputValue) { std::wstringstream _s; _s << inputValue; return _s.str(); }
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	/// <summary>
+	/// Only exists so Assert's signatures match the real framework, the caller's location comes from std::source_location instead
+	/// </summary>
+	struct __LineInfo final {};
+
+#pragma region ToString
+
+	/// <summary>
+	/// Converts a value to a string for failure messages, specialized by the tests for their own types
+	/// </summary>
+	/// <returns> The streamed value, or a placeholder when the type can't be streamed </returns>
+	template <typename Q>
+	std::wstring ToString(const Q& q)
+	{
+		if constexpr (requires(std::wostream& stream) { stream << q; })
+		{
+			RETURN_WIDE_STRING(q);
+		}
+		else
+		{
+			return L"<no ToString>";
+		}
+	}
+
+	template <typename Q>
+	std::wstring ToString(const Q* q)
+	{
+		RETURN_WIDE_STRING(static_cast<const void*>(q));
+	}
+
+	template <typename Q>
+	std::wstring ToString(Q* q)
+	{
+		RETURN_WIDE_STRING(static_cast<const void*>(q));
+	}
+
+	inline std::wstring ToString(const std::string& value)
+	{
+		return std::wstring(value.begin(), value.end());
+	}
+
+	inline std::wstring ToString(const char* value)
+	{
+		return ToString(std::string(value));
+	}
+
+	inline std::wstring ToString(const std::wstring& value)
+	{
+		return value;
+	}
+
+#pragma endregion ToString
+
+	/// <summary>
+	/// Thrown by a failed assertion to abort the test method, reported to GoogleTest by the adapter
+	/// </summary>
+	struct AssertFailedException final
+	{
+		std::wstring message;
+		std::source_location location;
+	};
+
+	/// <summary>
+	/// The assertions used by the tests, with the same signatures as the real framework
+	/// </summary>
+	class Assert final
+	{
+	public:
+		[[noreturn]] static void Fail(const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			Throw(L"Assert::Fail", message, location);
+		}
+
+		template <typename T>
+		static void AreEqual(const T& expected, const T& actual, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			if (!(expected == actual))
+			{
+				Throw(L"Assert::AreEqual failed. Expected:<" + ToString(expected) + L"> Actual:<" + ToString(actual) + L">", message, location);
+			}
+		}
+
+		static void AreEqual(const double expected, const double actual, const double tolerance, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			if (std::abs(expected - actual) > tolerance)
+			{
+				Throw(L"Assert::AreEqual failed. Expected:<" + ToString(expected) + L"> Actual:<" + ToString(actual) + L">", message, location);
+			}
+		}
+
+		static void AreEqual(const float expected, const float actual, const float tolerance, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			if (std::abs(expected - actual) > tolerance)
+			{
+				Throw(L"Assert::AreEqual failed. Expected:<" + ToString(expected) + L"> Actual:<" + ToString(actual) + L">", message, location);
+			}
+		}
+
+		static void AreEqual(const char* expected, const char* actual, const bool ignore_case = false, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			if ((ignore_case ? strcasecmp(expected, actual) : std::strcmp(expected, actual)) != 0)
+			{
+				Throw(L"Assert::AreEqual failed. Expected:<" + ToString(expected) + L"> Actual:<" + ToString(actual) + L">", message, location);
+			}
+		}
+
+		template <typename T>
+		static void AreNotEqual(const T& not_expected, const T& actual, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			if (not_expected == actual)
+			{
+				Throw(L"Assert::AreNotEqual failed. Not expected:<" + ToString(not_expected) + L"> Actual:<" + ToString(actual) + L">", message, location);
+			}
+		}
+
+		template <typename T>
+		static void AreSame(const T& expected, const T& actual, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			if (&expected != &actual)
+			{
+				Throw(L"Assert::AreSame failed", message, location);
+			}
+		}
+
+		template <typename T>
+		static void AreNotSame(const T& not_expected, const T& actual, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			if (&not_expected == &actual)
+			{
+				Throw(L"Assert::AreNotSame failed", message, location);
+			}
+		}
+
+		static void IsTrue(const bool condition, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			if (!condition)
+			{
+				Throw(L"Assert::IsTrue failed", message, location);
+			}
+		}
+
+		static void IsFalse(const bool condition, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			if (condition)
+			{
+				Throw(L"Assert::IsFalse failed", message, location);
+			}
+		}
+
+		template <typename T>
+		static void IsNull(const T* pointer, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			if (pointer != nullptr)
+			{
+				Throw(L"Assert::IsNull failed", message, location);
+			}
+		}
+
+		template <typename T>
+		static void IsNotNull(const T* pointer, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			if (pointer == nullptr)
+			{
+				Throw(L"Assert::IsNotNull failed", message, location);
+			}
+		}
+
+		template <typename ExpectedException, typename Functor>
+		static void ExpectException(Functor functor, const wchar_t* message = nullptr, const __LineInfo* = nullptr, const std::source_location location = std::source_location::current())
+		{
+			try
+			{
+				functor();
+			}
+			catch (const ExpectedException&)
+			{
+				return;
+			}
+			catch (const AssertFailedException&)
+			{
+				throw;
+			}
+			catch (...)
+			{
+				Throw(L"Assert::ExpectException failed, a different exception was thrown", message, location);
+			}
+
+			Throw(L"Assert::ExpectException failed, no exception was thrown", message, location);
+		}
+
+	private:
+		[[noreturn]] static void Throw(std::wstring failure, const wchar_t* message, const std::source_location& location)
+		{
+			if (message != nullptr)
+			{
+				failure += L" ";
+				failure += message;
+			}
+
+			throw AssertFailedException{ std::move(failure), location };
+		}
+	};
+}
+
+namespace CppUnitTestAdapter
+{
+	using Microsoft::VisualStudio::CppUnitTestFramework::AssertFailedException;
+
+	/// <summary>
+	/// Narrows a failure message for GoogleTest's output, anything outside of ASCII becomes '?'
+	/// </summary>
+	inline std::string Narrow(const std::wstring& message)
+	{
+		std::string narrow;
+		narrow.reserve(message.size());
+		for (const wchar_t character : message)
+		{
+			narrow.push_back((character >= 0 && character < 0x80) ? static_cast<char>(character) : '?');
+		}
+
+		return narrow;
+	}
+
+	/// <summary>
+	/// Base of every TEST_CLASS, provides the defaults for classes without an initialize or cleanup method
+	/// </summary>
+	template <typename TestClass, typename TestClassName>
+	class TestClassBase
+	{
+	public:
+		using ThisTestClass = TestClass;
+		using ThisTestClassName = TestClassName;
+
+		void CppUnitTestInitialize() {}
+		void CppUnitTestCleanup() {}
+	};
+
+	/// <summary>
+	/// One TEST_METHOD as a GoogleTest test, constructs a fresh instance of the test class like the real framework
+	/// </summary>
+	template <typename TestClass>
+	class MethodTest final : public ::testing::Test
+	{
+	public:
+		using MethodType = void (TestClass::*)();
+
+		explicit MethodTest(MethodType new_method) :
+			method(new_method)
+		{
+		}
+
+		void TestBody() override
+		{
+			TestClass instance;
+			bool passed = Run([this, &instance] { instance.CppUnitTestInitialize(); (instance.*method)(); });
+
+			// Cleanup typically checks for leaks, which a method aborted by a failed assertion can't pass, so only its first failure is reported
+			if (passed)
+			{
+				Run([&instance] { instance.CppUnitTestCleanup(); });
+			}
+			else
+			{
+				try
+				{
+					instance.CppUnitTestCleanup();
+				}
+				catch (...)
+				{
+				}
+			}
+		}
+
+	private:
+		template <typename Functor>
+		bool Run(Functor functor)
+		{
+			std::string failure;
+			std::string file;
+			int line = 0;
+
+			try
+			{
+				functor();
+				return true;
+			}
+			catch (const AssertFailedException& exception)
+			{
+				failure = Narrow(exception.message);
+				file = exception.location.file_name();
+				line = static_cast<int>(exception.location.line());
+			}
+			catch (const std::exception& exception)
+			{
+				failure = std::string("Unhandled exception: ") + exception.what();
+			}
+			catch (...)
+			{
+				failure = "Unhandled exception of unknown type";
+			}
+
+			if (line != 0)
+			{
+				ADD_FAILURE_AT(file.c_str(), line) << failure;
+			}
+			else
+			{
+				ADD_FAILURE() << failure;
+			}
+
+			return false;
+		}
+
+		MethodType method;
+	};
+
+	template <typename TestClass>
+	bool RegisterMethod(const char* class_name, const char* method_name, void (TestClass::*method)(), const char* file, const int line)
+	{
+		::testing::RegisterTest(class_name, method_name, nullptr, nullptr, file, line,
+			[method]() -> ::testing::Test* { return new MethodTest<TestClass>(method); });
+
+		return true;
+	}
+}
+
+#define TEST_CLASS(className) \
+	struct className##_CppUnitTestName final { static constexpr const char* value = #className; }; \
+	class className : public ::CppUnitTestAdapter::TestClassBase<className, className##_CppUnitTestName>
+
+#define TEST_METHOD_INITIALIZE(methodName) \
+	public: \
+	void CppUnitTestInitialize() { methodName(); } \
+	void methodName()
+
+#define TEST_METHOD_CLEANUP(methodName) \
+	public: \
+	void CppUnitTestCleanup() { methodName(); } \
+	void methodName()
+
+// The registrar's constructor body is a complete-class context, so it can name the method declared right after it
+#define TEST_METHOD(methodName) \
+	struct methodName##_CppUnitTestRegistrar final \
+	{ \
+		methodName##_CppUnitTestRegistrar() \
+		{ \
+			::CppUnitTestAdapter::RegisterMethod<ThisTestClass>(ThisTestClassName::value, #methodName, &ThisTestClass::methodName, __FILE__, __LINE__); \
+		} \
+	}; \
+	inline static methodName##_CppUnitTestRegistrar methodName##_cpp_unit_test_registrar{}; \
+	public: \
+	void methodName()
@@ -0,0 +1,58 @@
+#include <crtdbg.h>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	std::ptrdiff_t live_allocations = 0;
+
+	void* CountedAllocate(const std::size_t size)
+	{
+		void* memory = std::malloc(size != 0 ? size : 1);
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		++live_allocations;
+		return memory;
+	}
+
+	void CountedFree(void* memory) noexcept
+	{
+		if (memory != nullptr)
+		{
+			--live_allocations;
+			std::free(memory);
+		}
+	}
+}
+
+void* operator new(std::size_t size) { return CountedAllocate(size); }
+void* operator new[](std::size_t size) { return CountedAllocate(size); }
+void operator delete(void* memory) noexcept { CountedFree(memory); }
+void operator delete[](void* memory) noexcept { CountedFree(memory); }
+void operator delete(void* memory, std::size_t) noexcept { CountedFree(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { CountedFree(memory); }
+
+int _CrtSetDbgFlag(int flags)
+{
+	return flags;
+}
+
+void _CrtMemCheckpoint(_CrtMemState* state)
+{
+	state->live_allocations = live_allocations;
+}
+
+int _CrtMemDifference(_CrtMemState* difference, const _CrtMemState* old_state, const _CrtMemState* new_state)
+{
+	difference->live_allocations = new_state->live_allocations - old_state->live_allocations;
+	return (difference->live_allocations != 0) ? 1 : 0;
+}
+
+void _CrtMemDumpStatistics(const _CrtMemState* state)
+{
+	std::printf("%td live allocations difference\n", state->live_allocations);
+}
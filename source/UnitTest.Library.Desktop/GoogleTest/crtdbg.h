@@ -0,0 +1,22 @@
+#pragma once
+
+// Stands in for the MSVC debug heap header when building the unit tests with GoogleTest (see CMakeLists.txt)
+// The tests' leak checks compare checkpoints of the amount of live operator new allocations, counted in CrtDbg.cpp
+// Allocations made directly through malloc (e.g. Vector's buffer) aren't counted, unlike the real debug heap
+
+#include <cstddef>
+
+#define _CRTDBG_ALLOC_MEM_DF 0x01
+
+/// <summary>
+/// A snapshot of the heap, only the amount of live allocations is tracked
+/// </summary>
+struct _CrtMemState
+{
+	std::ptrdiff_t live_allocations = 0;
+};
+
+int _CrtSetDbgFlag(int flags);
+void _CrtMemCheckpoint(_CrtMemState* state);
+int _CrtMemDifference(_CrtMemState* difference, const _CrtMemState* old_state, const _CrtMemState* new_state);
+void _CrtMemDumpStatistics(const _CrtMemState* state);
@@ -243,6 +243,103 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(1_z, map.BucketSize());
 		}
 
+		TEST_METHOD(TestRehash)
+		{
+			HashMap<Foo, std::string> map(5_z);
+			for (int32_t i = 0; i < 5; ++i)
+			{
+				map.Insert(std::make_pair(Foo(i), std::to_string(i)));
+			}
+
+			Assert::AreEqual(5_z, map.BucketSize());
+			auto expression = [&map] { map.Resize(0_z); };
+			Assert::ExpectException<std::invalid_argument>(expression);
+
+			// Never drops below what the max load factor allows
+			map.Rehash(1_z);
+			Assert::AreEqual(5_z, map.BucketSize());
+
+			std::pair<const Foo, std::string>* pair_address = &(*map.Find(Foo(3)));
+			map.Rehash(23_z);
+			Assert::AreEqual(23_z, map.BucketSize());
+			Assert::AreEqual(5_z, map.Size());
+			Assert::IsTrue(pair_address == &(*map.Find(Foo(3))));
+
+			for (int32_t i = 0; i < 5; ++i)
+			{
+				Assert::AreEqual(std::to_string(i), map.at(Foo(i)));
+			}
+		}
+
+		TEST_METHOD(TestReserve)
+		{
+			HashMap<Foo, std::string> map(5_z);
+			map.Reserve(100_z);
+			Assert::AreEqual(100_z, map.BucketSize());
+
+			// Never shrinks
+			map.Reserve(10_z);
+			Assert::AreEqual(100_z, map.BucketSize());
+
+			for (int32_t i = 0; i < 100; ++i)
+			{
+				map.Insert(std::make_pair(Foo(i), std::to_string(i)));
+			}
+			Assert::AreEqual(100_z, map.BucketSize());
+		}
+
+		TEST_METHOD(TestLoadFactor)
+		{
+			HashMap<Foo, std::string> map(4_z);
+			Assert::AreEqual(0.0f, map.LoadFactor());
+			Assert::AreEqual(1.0f, map.MaxLoadFactor());
+
+			map.Insert(std::make_pair(Foo(1), "One"));
+			map.Insert(std::make_pair(Foo(2), "Two"));
+			Assert::AreEqual(0.5f, map.LoadFactor());
+
+			auto expression = [&map] { map.SetMaxLoadFactor(0.0f); };
+			Assert::ExpectException<std::invalid_argument>(expression);
+
+			map.SetMaxLoadFactor(0.25f);
+			Assert::AreEqual(0.25f, map.MaxLoadFactor());
+			Assert::AreEqual(8_z, map.BucketSize());
+			Assert::IsTrue(map.LoadFactor() <= map.MaxLoadFactor());
+		}
+
+		TEST_METHOD(TestAutomaticRehash)
+		{
+			HashMap<Foo, std::string> map(3_z);
+			Vector<std::pair<const Foo, std::string>*> addresses;
+
+			for (int32_t i = 0; i < 500; ++i)
+			{
+				auto [was_inserted, it] = map.Insert(std::make_pair(Foo(i), std::to_string(i)));
+				Assert::IsTrue(was_inserted);
+				addresses.PushBack(&(*it));
+				Assert::IsTrue(map.LoadFactor() <= map.MaxLoadFactor());
+			}
+
+			Assert::AreEqual(500_z, map.Size());
+			Assert::IsTrue(map.BucketSize() >= 500_z);
+
+			size_t counter = 0;
+			for (auto& pair : map)
+			{
+				UNREFERENCED_LOCAL(pair);
+				++counter;
+			}
+			Assert::AreEqual(500_z, counter);
+
+			// Nodes are relinked, so earlier references survive every growth
+			for (int32_t i = 0; i < 500; ++i)
+			{
+				auto it = map.Find(Foo(i));
+				Assert::IsTrue(it != map.end());
+				Assert::IsTrue(addresses[i] == &(*it));
+			}
+		}
+
 		TEST_METHOD(TestClear)
 		{
 			HashMap<Foo, std::string> map(5_z);
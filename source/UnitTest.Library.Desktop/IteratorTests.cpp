@@ -104,6 +104,7 @@ namespace UnitTestLibraryDesktop
 
 		TEST_METHOD(TestIteratorIncrement)
 		{
+#if FIEA_DEBUG_ITERATORS
 			// SList
 			{
 				// Prefix
@@ -125,6 +126,7 @@ namespace UnitTestLibraryDesktop
 				auto expressionA = [&it] { ++it; };
 				Assert::ExpectException<std::runtime_error>(expressionA);
 			}
+#endif
 		}
 
 		TEST_METHOD(TestIteratorDecrement)
@@ -132,9 +134,11 @@ namespace UnitTestLibraryDesktop
 			// Vector
 			{
 				// Prefix
+#if FIEA_DEBUG_ITERATORS
 				Vector<Foo>::Iterator it;
 				auto expressionA = [&it] { --it; };
 				Assert::ExpectException<std::runtime_error>(expressionA);
+#endif
 
 				const Foo a(10);
 				const Foo b(20);
@@ -151,6 +155,7 @@ namespace UnitTestLibraryDesktop
 
 		TEST_METHOD(TestIteratorDereference)
 		{
+#if FIEA_DEBUG_ITERATORS
 			// SList
 			{
 				SList<Foo>::Iterator it;
@@ -197,6 +202,7 @@ namespace UnitTestLibraryDesktop
 					Assert::ExpectException<std::runtime_error>(expressionA);
 				}
 			}
+#endif
 		}
 
 		TEST_METHOD(TestConstIteratorConstructor)
@@ -251,6 +257,7 @@ namespace UnitTestLibraryDesktop
 
 		TEST_METHOD(TestConstIteratorIncrement)
 		{
+#if FIEA_DEBUG_ITERATORS
 			// SList
 			{
 				SList<Foo>::ConstIterator it;
@@ -269,15 +276,18 @@ namespace UnitTestLibraryDesktop
 				auto expressionA = [&it] { ++it; };
 				Assert::ExpectException<std::runtime_error>(expressionA);
 			}
+#endif
 		}
 
 		TEST_METHOD(TestConstIteratorDecrement)
 		{
 			// Vector
 			{
+#if FIEA_DEBUG_ITERATORS
 				Vector<Foo>::ConstIterator it;
 				auto expressionA = [&it] { --it; };
 				Assert::ExpectException<std::runtime_error>(expressionA);
+#endif
 
 				const Foo a(10);
 				const Foo b(20);
@@ -295,6 +305,7 @@ namespace UnitTestLibraryDesktop
 
 		TEST_METHOD(TestConstIteratorDereference)
 		{
+#if FIEA_DEBUG_ITERATORS
 			// SList
 			{
 				SList<Foo>::ConstIterator it;
@@ -342,6 +353,7 @@ namespace UnitTestLibraryDesktop
 					Assert::ExpectException<std::runtime_error>(expressionA);
 				}
 			}
+#endif
 		}
 
 	private:
@@ -175,6 +175,32 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(list.IsEmpty());
 		}
 
+		TEST_METHOD(TestMoveFrontTo)
+		{
+			SList<Foo> list;
+			SList<Foo> destination;
+			auto expression = [&list, &destination] { list.MoveFrontTo(destination); };
+			Assert::ExpectException<std::runtime_error>(expression);
+
+			list.PushBack(Foo(10));
+			list.PushBack(Foo(20));
+			destination.PushBack(Foo(30));
+			const Foo* moved_address = &list.Front();
+
+			list.MoveFrontTo(destination);
+			Assert::AreEqual(1_z, list.Size());
+			Assert::AreEqual(Foo(20), list.Front());
+			Assert::AreEqual(2_z, destination.Size());
+			Assert::AreEqual(Foo(10), destination.Back());
+			Assert::IsTrue(moved_address == &destination.Back());
+
+			list.MoveFrontTo(destination);
+			Assert::IsTrue(list.IsEmpty());
+			Assert::AreEqual(list.begin(), list.end());
+			Assert::AreEqual(3_z, destination.Size());
+			Assert::AreEqual(Foo(20), destination.Back());
+		}
+
 		TEST_METHOD(TestPushBack)
 		{
 			SList<Foo> list;
@@ -348,6 +374,56 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(third_foo, list.Back());
 		}
 
+		TEST_METHOD(TestAllocators)
+		{
+			// Heap allocated nodes
+			{
+				SList<Foo, HeapAllocator> list;
+				list.PushBack(Foo(10));
+				list.PushFront(Foo(5));
+				list.InsertAfter(Foo(7), list.begin());
+				Assert::AreEqual(3_z, list.Size());
+				Assert::AreEqual(Foo(7), *(++list.begin()));
+
+				SList<Foo, HeapAllocator> copy(list);
+				list.PopBack();
+				list.PopFront();
+				list.Remove(Foo(7));
+				Assert::IsTrue(list.IsEmpty());
+				Assert::AreEqual(3_z, copy.Size());
+			}
+			// Pooled nodes move between lists and get recycled
+			{
+				SList<Foo> list;
+				SList<Foo> other;
+				for (int32_t i = 0; i < 1000; ++i)
+				{
+					list.PushBack(Foo(i));
+					if (i % 2 == 0)
+					{
+						list.MoveFrontTo(other);
+					}
+				}
+
+				Assert::AreEqual(500_z, list.Size());
+				Assert::AreEqual(500_z, other.Size());
+				Assert::AreEqual(Foo(0), other.Front());
+				Assert::AreEqual(Foo(499), other.Back());
+				Assert::AreEqual(Foo(500), list.Front());
+
+				other.Clear();
+				for (int32_t i = 1000; i < 2000; ++i)
+				{
+					list.PushBack(Foo(i));
+					list.PopFront();
+				}
+
+				Assert::AreEqual(500_z, list.Size());
+				Assert::AreEqual(Foo(1500), list.Front());
+				Assert::AreEqual(Foo(1999), list.Back());
+			}
+		}
+
 		TEST_METHOD(TestInsertAfter)
 		{
 			SList<Foo> list;
@@ -0,0 +1,132 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <exception>
+#include <set>
+#include <CppUnitTest.h>
+#include "Foo.h"
+#include "NodePool.h"
+#include "PoolAllocator.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(NodePoolTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(ClassInitialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF); // Changes the way that "new" works
+			_CrtMemCheckpoint(&sStartMemState);
+#endif // Debug
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+#ifdef _DEBUG
+
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leak"); // Makes this string a wide character
+			}
+#endif // DEBUG
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			NodePool pool(24_z, 8_z, 8_z);
+			Assert::AreEqual(24_z, pool.ChunkSize());
+			Assert::AreEqual(0_z, pool.LiveCount());
+			Assert::AreEqual(0_z, pool.BlockCount());
+
+			// Chunks are padded out to the alignment and can always hold a free list link
+			NodePool padded(1_z, 16_z);
+			Assert::AreEqual(16_z, padded.ChunkSize());
+
+			auto expressionA = [] { NodePool pool(0_z, 8_z); };
+			Assert::ExpectException<std::invalid_argument>(expressionA);
+			auto expressionB = [] { NodePool pool(8_z, 8_z, 0_z); };
+			Assert::ExpectException<std::invalid_argument>(expressionB);
+			auto expressionC = [] { NodePool pool(8_z, 12_z); };
+			Assert::ExpectException<std::invalid_argument>(expressionC);
+		}
+
+		TEST_METHOD(TestAllocateAndDeallocate)
+		{
+			NodePool pool(sizeof(Foo), alignof(Foo), 4_z);
+
+			std::set<void*> chunks;
+			for (size_t index = 0; index < 10; ++index)
+			{
+				void* chunk = pool.Allocate();
+				Assert::IsNotNull(chunk);
+				Assert::IsTrue(chunks.insert(chunk).second);
+			}
+
+			Assert::AreEqual(10_z, pool.LiveCount());
+			Assert::AreEqual(3_z, pool.BlockCount());
+
+			// Freed chunks are handed out again before any new block is allocated
+			void* first = *chunks.begin();
+			pool.Deallocate(first);
+			pool.Deallocate(nullptr);
+			Assert::AreEqual(9_z, pool.LiveCount());
+			Assert::IsTrue(first == pool.Allocate());
+			Assert::AreEqual(3_z, pool.BlockCount());
+
+			auto expression = [&pool] { pool.Release(); };
+			Assert::ExpectException<std::runtime_error>(expression);
+
+			// Blocks go back to the heap once the last chunk is returned
+			for (void* chunk : chunks)
+			{
+				pool.Deallocate(chunk);
+			}
+
+			Assert::AreEqual(0_z, pool.LiveCount());
+			Assert::AreEqual(0_z, pool.BlockCount());
+
+			// Refilling an emptied pool starts over with a fresh block
+			void* chunk = pool.Allocate();
+			Assert::AreEqual(1_z, pool.BlockCount());
+			pool.Deallocate(chunk);
+			Assert::AreEqual(0_z, pool.BlockCount());
+		}
+
+		TEST_METHOD(TestPoolAllocator)
+		{
+			PoolAllocator<8> allocator;
+			NodePool& pool = PoolAllocator<8>::Pool<Foo>();
+			Assert::IsTrue(&pool == &PoolAllocator<8>::Pool<Foo>());
+			Assert::AreEqual(0_z, pool.LiveCount());
+
+			Foo* a = allocator.Create<Foo>(10);
+			Foo* b = allocator.Create<Foo>(*a);
+			Assert::AreEqual(Foo(10), *b);
+			Assert::AreEqual(2_z, pool.LiveCount());
+			Assert::AreEqual(1_z, pool.BlockCount());
+
+			allocator.Destroy(a);
+			allocator.Destroy(b);
+			allocator.Destroy<Foo>(nullptr);
+			Assert::AreEqual(0_z, pool.LiveCount());
+			Assert::AreEqual(0_z, pool.BlockCount());
+
+			HeapAllocator heap_allocator;
+			Foo* c = heap_allocator.Create<Foo>(20);
+			Assert::AreEqual(Foo(20), *c);
+			heap_allocator.Destroy(c);
+		}
+
+	private:
+		static _CrtMemState sStartMemState; // Static members before C++17 could only be defined separate from declaration
+	};
+
+	_CrtMemState NodePoolTests::sStartMemState;
+}
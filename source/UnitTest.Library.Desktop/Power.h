@@ -23,8 +23,8 @@ namespace UnitTests
 		int ExternalInteger = 0;
 		float ExternalFloat = 0;
 		std::string ExternalString;
-		glm::vec4 ExternalVector;
-		glm::mat4 ExternalMatrix;
+		glm::vec4 ExternalVector{};
+		glm::mat4 ExternalMatrix{};
 
 		int ExternalIntegerArray[ArraySize];
 		float ExternalFloatArray[ArraySize];
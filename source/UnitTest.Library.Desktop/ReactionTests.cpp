@@ -246,6 +246,71 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(1_z, queue.Size());
 		}
 
+		TEST_METHOD(TestActionEventPayload)
+		{
+			using namespace std::string_literals;
+
+			TypeManager::AddType(Action::TypeIdClass(), Action::Signatures());
+			TypeManager::AddType(ActionList::TypeIdClass(), ActionList::Signatures(), Action::TypeIdClass());
+			TypeManager::AddType(Reaction::TypeIdClass(), Reaction::Signatures(), ActionList::TypeIdClass());
+			TypeManager::AddType(ReactionAttributed::TypeIdClass(), ReactionAttributed::Signatures(), Reaction::TypeIdClass());
+
+			GameTime game_time;
+			EventQueue queue;
+			WorldState state(game_time);
+
+			ActionEvent action_event(queue);
+			action_event.Subtype() = "Payload"s;
+			action_event.SetDelay(0);
+			Datum& amounts = action_event.AppendAuxililaryAttribute("Amounts"s);
+			amounts.SetType(Datum::DatumTypes::Integer);
+			for (int value = 1; value <= 6; ++value)
+			{
+				amounts.PushBack(value);
+			}
+
+			Datum& names = action_event.AppendAuxililaryAttribute("Names"s);
+			names.SetType(Datum::DatumTypes::String);
+			names.PushBack("A string long enough to live on the heap"s);
+
+			action_event.AppendScope("Targets"s)["Health"s] = 10;
+
+			ReactionAttributed reaction;
+			reaction.SetSubtype("Payload"s);
+			action_event.Update(state);
+			game_time.SetCurrentTime(game_time.CurrentTime() + std::chrono::milliseconds(1));
+			queue.Update(game_time);
+			Assert::AreEqual(0_z, queue.Size());
+
+			// The reaction received every argument the action carried
+			const Datum* received_amounts = reaction.Find("Amounts"s);
+			Assert::IsNotNull(received_amounts);
+			Assert::AreEqual(6_z, received_amounts->Size());
+			Assert::AreEqual(6, received_amounts->Get<int>(5_z));
+
+			Datum* received_names = reaction.Find("Names"s);
+			Assert::IsNotNull(received_names);
+			received_names->Set("Changed"s);
+			Assert::AreEqual("A string long enough to live on the heap"s, action_event["Names"s].Get<std::string>());
+
+			Datum* received_targets = reaction.Find("Targets"s);
+			Assert::IsNotNull(received_targets);
+			Assert::AreEqual(10, received_targets->Get<Scope>()["Health"s].Get<int>());
+			Assert::IsTrue(&received_targets->Get<Scope>() != &action_event["Targets"s].Get<Scope>());
+
+			// A second event replaces the scopes the first one handed over instead of adding to them
+			action_event["Targets"s].Get<Scope>()["Health"s] = 20;
+			action_event.Update(state);
+			game_time.SetCurrentTime(game_time.CurrentTime() + std::chrono::milliseconds(1));
+			queue.Update(game_time);
+			received_targets = reaction.Find("Targets"s);
+			Assert::AreEqual(1_z, received_targets->Size());
+			Assert::AreEqual(20, received_targets->Get<Scope>()["Health"s].Get<int>());
+			Assert::AreEqual(6_z, reaction.Find("Amounts"s)->Size());
+
+			Event<EventMessageAttributed>::UnsubscribeAll();
+		}
+
 	private:
 		static _CrtMemState sStartMemState; // Static members before C++17 could only be defined separate from declaration
 	};
@@ -0,0 +1,174 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <exception>
+#include <CppUnitTest.h>
+#include "ScopeSlab.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ScopeSlabTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(ClassInitialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF); // Changes the way that "new" works
+			_CrtMemCheckpoint(&sStartMemState);
+#endif // Debug
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+#ifdef _DEBUG
+
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leak"); // Makes this string a wide character
+			}
+#endif // DEBUG
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			ScopeSlab slab;
+			Assert::AreEqual(0_z, slab.LiveCount());
+			Assert::AreEqual(0_z, slab.BlockCount());
+			Assert::AreEqual(0_z, slab.BytesUsed());
+
+			auto expression = [] { ScopeSlab slab(0_z); };
+			Assert::ExpectException<std::invalid_argument>(expression);
+		}
+
+		TEST_METHOD(TestAppendScope)
+		{
+			using namespace std::string_literals;
+			ScopeSlab slab;
+
+			Scope& root = slab.Create();
+			Assert::IsTrue(&slab == root.Slab());
+			Assert::AreEqual(1_z, slab.LiveCount());
+			Assert::AreEqual(1_z, slab.BlockCount());
+
+			// Children follow their parent into the slab, laid out in creation order
+			Scope& first = root.AppendScope("Children"s);
+			Scope& second = root.AppendScope("Children"s);
+			Scope& grandchild = first.AppendScope("Children"s);
+			Assert::IsTrue(&slab == first.Slab());
+			Assert::IsTrue(&slab == grandchild.Slab());
+			Assert::IsTrue(&root < &first && &first < &second && &second < &grandchild);
+			Assert::AreEqual(4_z, slab.LiveCount());
+			Assert::AreEqual(&root, first.GetParent());
+			Assert::AreEqual(&first, grandchild.GetParent());
+
+			grandchild["Health"s] = 10;
+			Assert::AreEqual(10, std::get<0>(grandchild.Search("Health"s))->Get<int>());
+
+			// Clearing destroys the nested scopes in place, their memory is only returned on release
+			const size_t bytes_used = slab.BytesUsed();
+			root.Clear();
+			Assert::AreEqual(1_z, slab.LiveCount());
+			Assert::AreEqual(bytes_used, slab.BytesUsed());
+
+			Scope heap_root;
+			Assert::IsNull(heap_root.Slab());
+			Assert::IsNull(heap_root.AppendScope("Children"s).Slab());
+		}
+
+		TEST_METHOD(TestRelease)
+		{
+			using namespace std::string_literals;
+			ScopeSlab slab(512_z);
+
+			Scope& root = slab.Create();
+			for (size_t index = 0_z; index < 20_z; ++index)
+			{
+				Scope& child = root.AppendScope("Children"s);
+				child["Index"s] = static_cast<int>(index);
+				child.AppendScope("Children"s)["Name"s] = "A name long enough to allocate on the heap"s;
+			}
+
+			Assert::AreEqual(41_z, slab.LiveCount());
+			Assert::IsTrue(slab.BlockCount() > 1_z);
+
+			// Heap scopes adopted into the tree are deleted with it, slab scopes adopted elsewhere leave the tree
+			Scope* adopted = new Scope();
+			root.Adopt(*adopted, "Adopted"s);
+			Scope heap_root;
+			Scope& moved = root.AppendScope("Moved"s);
+			heap_root.Adopt(moved, "Moved"s);
+			Assert::AreEqual(42_z, slab.LiveCount());
+
+			slab.Release();
+			Assert::AreEqual(0_z, slab.LiveCount());
+			Assert::AreEqual(0_z, slab.BlockCount());
+			Assert::AreEqual(0_z, slab.BytesUsed());
+			Assert::AreEqual(1_z, heap_root.Size());
+			Assert::AreEqual(0_z, heap_root["Moved"s].Size());
+
+			// The slab can be reused once released
+			Scope& reused = slab.Create(4_z);
+			reused.AppendScope("Children"s);
+			Assert::AreEqual(2_z, slab.LiveCount());
+		}
+
+		TEST_METHOD(TestDestroy)
+		{
+			using namespace std::string_literals;
+			ScopeSlab slab;
+
+			Scope& root = slab.Create();
+			Scope& child = root.AppendScope("Children"s);
+			child.AppendScope("Children"s);
+			Assert::AreEqual(3_z, slab.LiveCount());
+
+			// Destroying a nested scope orphans it and takes its own children with it
+			Scope::Destroy(child);
+			Assert::AreEqual(1_z, slab.LiveCount());
+			Assert::AreEqual(0_z, root["Children"s].Size());
+
+			Scope* heap_scope = new Scope();
+			heap_scope->AppendScope("Children"s);
+			Scope::Destroy(*heap_scope);
+			Assert::AreEqual(1_z, slab.LiveCount());
+		}
+
+		TEST_METHOD(TestDeepCopy)
+		{
+			using namespace std::string_literals;
+			Scope source;
+			source["Health"s] = 100;
+			Scope& child = source.AppendScope("Children"s);
+			child["Name"s] = "Child"s;
+			child.AppendScope("Children"s)["Name"s] = "Grandchild"s;
+
+			ScopeSlab slab;
+			Scope& copy = slab.Create();
+			copy = source;
+			Assert::IsTrue(copy == source);
+			Assert::AreEqual(3_z, slab.LiveCount());
+
+			Scope& copied_child = copy["Children"s].Get<Scope>();
+			Assert::IsTrue(&slab == copied_child.Slab());
+			Assert::IsTrue(&slab == copied_child["Children"s].Get<Scope>().Slab());
+			Assert::AreEqual(&copy, copied_child.GetParent());
+			Assert::AreEqual("Grandchild"s, copied_child["Children"s].Get<Scope>()["Name"s].Get<std::string>());
+
+			// Copying out of the slab lands back on the heap
+			Scope heap_copy(copy);
+			Assert::IsNull(heap_copy["Children"s].Get<Scope>().Slab());
+			Assert::IsTrue(heap_copy == source);
+		}
+
+	private:
+		static _CrtMemState sStartMemState; // Static members before C++17 could only be defined separate from declaration
+	};
+
+	_CrtMemState ScopeSlabTests::sStartMemState;
+}
@@ -120,6 +120,45 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(scope, next_copy);
 		}
 
+		TEST_METHOD(TestCopyOnWrite)
+		{
+			using namespace std::string_literals;
+
+			Scope prefab;
+			prefab["Name"s] = "A name long enough to live on the heap"s;
+			prefab["Waypoints"s].SetType(Datum::DatumTypes::Vector);
+			prefab["Waypoints"s].Resize(16_z);
+			Scope& child = prefab.AppendScope("Children"s);
+			child["Health"s] = 100;
+
+			// Every scope is copied, but the arrays of their datums are shared
+			Scope instance(prefab);
+			Assert::IsTrue(instance == prefab);
+			Assert::IsTrue(instance["Name"s].IsShared());
+			Assert::IsTrue(instance["Waypoints"s].IsShared());
+			Scope& instance_child = instance["Children"s].Get<Scope>();
+			Assert::AreNotSame(child, instance_child);
+			Assert::AreEqual(&instance, instance_child.GetParent());
+			Assert::IsTrue(instance_child["Health"s].IsInline()); // Too small to share, copied along with the datum
+			Assert::IsFalse(instance_child["Health"s].IsShared());
+
+			// Writing to an instance only copies the written datum
+			instance_child["Health"s].Set(50);
+			instance["Waypoints"s].Set(glm::vec4(1.0f), 3_z);
+			Assert::IsFalse(instance_child["Health"s].IsShared());
+			Assert::IsFalse(instance["Waypoints"s].IsShared());
+			Assert::IsTrue(instance["Name"s].IsShared());
+			Assert::IsTrue(prefab["Children"s].Get<Scope>()["Health"s] == 100);
+			Assert::IsTrue(prefab["Waypoints"s] != instance["Waypoints"s]);
+			Assert::IsTrue(instance != prefab);
+
+			// The prefab can be destroyed while its instances still share its arrays
+			Scope* heap_prefab = new Scope(prefab);
+			Scope second_instance(*heap_prefab);
+			delete heap_prefab;
+			Assert::IsTrue(second_instance == prefab);
+		}
+
 		TEST_METHOD(TestMoveConstructor)
 		{
 			using namespace std::string_literals;
@@ -260,6 +299,165 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(scope, *found_scope);
 		}
 
+		TEST_METHOD(TestAtomLookups)
+		{
+			using namespace std::string_literals;
+
+			Scope scope;
+			const Atom a("A"s);
+			const Atom b("B"s);
+
+			Assert::IsNull(scope.Find(a));
+			Datum& datum = scope[a];
+			datum = 10;
+			Assert::AreEqual(&datum, scope.Find(a));
+			Assert::AreEqual(&datum, scope.Find("A"s));
+			Assert::AreEqual(&datum, &scope.Append(a));
+			Assert::AreEqual(1_z, scope.Size());
+
+			Scope& child = scope.AppendScope("Child"s);
+			auto [found_datum, found_scope] = child.Search(a);
+			Assert::AreEqual(&datum, found_datum);
+			Assert::AreEqual(&scope, found_scope);
+
+			std::tie(found_datum, found_scope) = child.Search(b);
+			Assert::IsNull(found_datum);
+			Assert::IsNull(found_scope);
+
+			const Scope& const_scope = scope;
+			Assert::AreEqual(const_cast<const Datum*>(&datum), const_scope.Find(a));
+
+			auto expression = [&scope] { scope.Append(Atom()); };
+			Assert::ExpectException<std::invalid_argument>(expression);
+		}
+
+		TEST_METHOD(TestGeneration)
+		{
+			using namespace std::string_literals;
+
+			Scope scope;
+			size_t generation = Scope::Generation();
+
+			scope.Append("A"s);
+			Assert::AreNotEqual(generation, Scope::Generation());
+
+			// Finding an existing entry doesn't change the structure
+			generation = Scope::Generation();
+			scope.Append("A"s);
+			scope.Find("A"s);
+			Assert::AreEqual(generation, Scope::Generation());
+
+			Scope& child = scope.AppendScope("B"s);
+			Assert::AreNotEqual(generation, Scope::Generation());
+
+			generation = Scope::Generation();
+			child.Orphan();
+			Assert::AreNotEqual(generation, Scope::Generation());
+
+			generation = Scope::Generation();
+			scope.Adopt(child, "C"s);
+			Assert::AreNotEqual(generation, Scope::Generation());
+
+			generation = Scope::Generation();
+			scope.Clear();
+			Assert::AreNotEqual(generation, Scope::Generation());
+		}
+
+		TEST_METHOD(TestIsUnchangedSince)
+		{
+			using namespace std::string_literals;
+
+			Scope root;
+			Scope& first = root.AppendScope("First"s);
+			Scope& second = root.AppendScope("Second"s);
+			const size_t generation = Scope::Generation();
+			Assert::IsTrue(first.IsUnchangedSince(generation));
+			Assert::IsTrue(first.IsUnchangedSince(generation, &root));
+
+			// Only the scopes from this one up to the ancestor are checked
+			second.Append("A"s);
+			Assert::IsTrue(first.IsUnchangedSince(generation));
+			Assert::IsFalse(second.IsUnchangedSince(generation));
+
+			root.Append("B"s);
+			Assert::IsFalse(first.IsUnchangedSince(generation));
+			Assert::IsFalse(first.IsUnchangedSince(generation, &root));
+			Assert::IsTrue(first.IsUnchangedSince(generation, &first));
+
+			// A scope that isn't an ancestor never matches
+			Assert::IsFalse(first.IsUnchangedSince(Scope::Generation(), &second));
+
+			// Being adopted counts as a change to the scope that moved, not to its new parent when the key already existed
+			size_t moved = Scope::Generation();
+			root.Adopt(first, "Second"s);
+			Assert::IsFalse(first.IsUnchangedSince(moved, &first));
+			Assert::IsTrue(root.IsUnchangedSince(moved));
+
+			moved = Scope::Generation();
+			first.Orphan();
+			Assert::IsFalse(first.IsUnchangedSince(moved));
+			delete &first;
+		}
+
+		TEST_METHOD(TestSearchCache)
+		{
+			using namespace std::string_literals;
+
+			Scope root;
+			Datum& root_a = root.Append("A"s);
+			Scope& middle = root.AppendScope("Middle"s);
+			Scope& leaf = middle.AppendScope("Leaf"s);
+
+			// Repeated searches, hits and misses alike, keep answering the same
+			for (size_t i = 0_z; i < 3_z; ++i)
+			{
+				auto [found_datum, found_scope] = leaf.Search("A"s);
+				Assert::AreEqual(&root_a, found_datum);
+				Assert::AreEqual(&root, found_scope);
+
+				std::tie(found_datum, found_scope) = leaf.Search("Missing"s);
+				Assert::IsNull(found_datum);
+				Assert::IsNull(found_scope);
+			}
+
+			// A closer entry shadows the cached one
+			Datum& middle_a = middle.Append("A"s);
+			auto [found_datum, found_scope] = leaf.Search("A"s);
+			Assert::AreEqual(&middle_a, found_datum);
+			Assert::AreEqual(&middle, found_scope);
+
+			// A previously missing entry is found once it exists
+			Datum& missing = root.Append("Missing"s);
+			std::tie(found_datum, found_scope) = leaf.Search(Atom("Missing"s));
+			Assert::AreEqual(&missing, found_datum);
+
+			// More keys than the cache has room for keep evicting each other without giving stale answers
+			Vector<Datum*> keyed;
+			for (int key = 0; key < 16; ++key)
+			{
+				keyed.PushBack(&root.Append("Key" + std::to_string(key)));
+			}
+
+			for (size_t pass = 0_z; pass < 2_z; ++pass)
+			{
+				for (int key = 0; key < 16; ++key)
+				{
+					std::tie(found_datum, found_scope) = leaf.Search(Atom("Key" + std::to_string(key)));
+					Assert::AreEqual(keyed[key], found_datum);
+					std::tie(found_datum, found_scope) = leaf.Search("Key" + std::to_string(key) + "Missing");
+					Assert::IsNull(found_datum);
+				}
+			}
+
+			// Reparenting searches the new ancestors
+			Scope other_root;
+			Datum& other_a = other_root.Append("A"s);
+			other_root.Adopt(leaf, "Leaf"s);
+			std::tie(found_datum, found_scope) = leaf.Search("A"s);
+			Assert::AreEqual(&other_a, found_datum);
+			Assert::AreEqual(&other_root, found_scope);
+		}
+
 		TEST_METHOD(TestAppend)
 		{
 			using namespace std::string_literals;
@@ -298,6 +496,83 @@ namespace UnitTestLibraryDesktop
 			Assert::ExpectException<std::invalid_argument>(expressionC);
 		}
 
+		TEST_METHOD(TestLargeScope)
+		{
+			using namespace std::string_literals;
+
+			// Small scopes are searched without a lookup table, larger ones build one and grow it as they go
+			Scope scope;
+			const size_t count = 200_z;
+			for (size_t index = 0_z; index < count; ++index)
+			{
+				scope.Append("Attribute"s + std::to_string(index)) = static_cast<int>(index);
+
+				for (size_t found_index = 0_z; found_index <= index; found_index += 7_z)
+				{
+					const Datum* found = scope.Find("Attribute"s + std::to_string(found_index));
+					Assert::IsNotNull(found);
+					Assert::AreEqual(static_cast<int>(found_index), found->Get<int>());
+				}
+
+				Assert::IsNull(scope.Find("Missing"s));
+			}
+
+			Assert::AreEqual(count, scope.Size());
+			for (size_t index = 0_z; index < count; ++index)
+			{
+				Assert::AreEqual(static_cast<int>(index), scope[static_cast<uint32_t>(index)].Get<int>());
+			}
+
+			Scope copy(scope);
+			Assert::IsTrue(copy == scope);
+			Assert::AreEqual(&copy[150], copy.Find("Attribute150"s));
+
+			Scope moved(std::move(copy));
+			Assert::AreEqual(&moved[199], moved.Find("Attribute199"s));
+			copy.Append("Reused"s) = 1;
+			Assert::AreEqual(1_z, copy.Size());
+			Assert::AreEqual(1, copy.Find("Reused"s)->Get<int>());
+
+			scope.Clear();
+			Assert::IsNull(scope.Find("Attribute0"s));
+			scope.Append("Attribute0"s) = 5;
+			Assert::AreEqual(5, scope.Find("Attribute0"s)->Get<int>());
+
+			Scope presized(50_z);
+			for (size_t index = 0_z; index < 50_z; ++index)
+			{
+				presized.Append("Attribute"s + std::to_string(index));
+			}
+
+			Assert::AreEqual(&presized[42], presized.Find("Attribute42"s));
+		}
+
+		TEST_METHOD(TestEntriesStayInPlace)
+		{
+			using namespace std::string_literals;
+
+			// A datum found earlier survives any amount of growth, however much capacity the scope started with
+			Scope scope;
+			Datum& first = scope.Append("First"s);
+			first = 1;
+			Scope& child = scope.AppendScope("Child"s);
+			Datum* child_datum = scope.Find("Child"s);
+
+			for (size_t index = 0_z; index < 100_z; ++index)
+			{
+				scope.Append("Attribute"s + std::to_string(index));
+			}
+
+			Assert::AreEqual(&first, scope.Find("First"s));
+			Assert::AreEqual(child_datum, scope.Find("Child"s));
+			Assert::AreEqual(1, first.Get<int>());
+			Assert::IsTrue(&child == &child_datum->Get<Scope>());
+
+			Scope moved(std::move(scope));
+			Assert::AreEqual(&first, moved.Find("First"s));
+			Assert::IsTrue(child.GetParent() == &moved);
+		}
+
 		TEST_METHOD(TestAppendScope)
 		{
 			using namespace std::string_literals;
@@ -463,6 +738,75 @@ namespace UnitTestLibraryDesktop
 			delete& aScope;
 		}
 
+		TEST_METHOD(TestOrphanKeepsSiblingOrder)
+		{
+			using namespace std::string_literals;
+
+			Scope scope;
+			scope["Health"s] = 100;
+			Scope& first = scope.AppendScope("Children"s);
+			Scope& second = scope.AppendScope("Children"s);
+			Scope& third = scope.AppendScope("Children"s);
+			Scope& fourth = scope.AppendScope("Children"s);
+			Scope& other = scope.AppendScope("Others"s);
+			Datum& children = scope["Children"s];
+
+			// Orphaning a middle child shifts the ones behind it down without reordering them
+			second.Orphan();
+			Assert::IsNull(second.GetParent());
+			Assert::AreEqual(3_z, children.Size());
+			Assert::AreSame(first, children.Get<Scope>(0));
+			Assert::AreSame(third, children.Get<Scope>(1));
+			Assert::AreSame(fourth, children.Get<Scope>(2));
+
+			auto [datum, index] = scope.FindContainedScope(fourth);
+			Assert::IsTrue(&children == datum);
+			Assert::AreEqual(2_z, index);
+
+			first.Orphan();
+			Assert::AreEqual(2_z, children.Size());
+			Assert::AreSame(third, children.Get<Scope>(0));
+			Assert::AreSame(fourth, children.Get<Scope>(1));
+
+			std::tie(datum, index) = scope.FindContainedScope(third);
+			Assert::IsTrue(&children == datum);
+			Assert::AreEqual(0_z, index);
+			std::tie(datum, index) = scope.FindContainedScope(other);
+			Assert::IsTrue(&scope["Others"s] == datum);
+			Assert::AreEqual(0_z, index);
+			std::tie(datum, index) = scope.FindContainedScope(first);
+			Assert::IsNull(datum);
+
+			// Adopting records the new slot, even in another parent
+			Scope other_parent;
+			other_parent.Append("Padding"s);
+			other_parent.Adopt(third, "Adopted"s);
+			Assert::AreEqual(1_z, children.Size());
+			Assert::AreSame(fourth, children.Get<Scope>(0));
+			std::tie(datum, index) = other_parent.FindContainedScope(third);
+			Assert::IsTrue(&other_parent["Adopted"s] == datum);
+			Assert::AreEqual(0_z, index);
+
+			// A moved scope takes over the slot of the one it was moved from
+			Scope* moved = new Scope(std::move(fourth));
+			std::tie(datum, index) = scope.FindContainedScope(*moved);
+			Assert::IsTrue(&children == datum);
+			Assert::AreEqual(0_z, index);
+			Scope::Destroy(*moved);
+			Assert::AreEqual(0_z, children.Size());
+
+			// Deep copies record the slots of their own children
+			Scope copy(scope);
+			Scope& copied_other = copy["Others"s].Get<Scope>();
+			copied_other.Orphan();
+			Assert::AreEqual(0_z, copy["Others"s].Size());
+
+			delete &first;
+			delete &second;
+			delete &fourth;
+			delete &copied_other;
+		}
+
 		TEST_METHOD(TestAncestry)
 		{
 			using namespace std::string_literals;
@@ -0,0 +1,210 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <exception>
+#include <string>
+#include <CppUnitTest.h>
+#include "ToStringSpecializations.h"
+#include "Foo.h"
+#include "SegmentedVector.h"
+#include "Vector.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SegmentedVectorTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(ClassInitialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF); // Changes the way that "new" works
+			_CrtMemCheckpoint(&sStartMemState);
+#endif // Debug
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+#ifdef _DEBUG
+
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leak"); // Makes this string a wide character
+			}
+#endif // DEBUG
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			SegmentedVector<Foo> v;
+			Assert::IsTrue(v.IsEmpty());
+			Assert::AreEqual(0_z, v.Capacity());
+			Assert::AreEqual(0_z, v.SegmentCount());
+
+			// The first segment is rounded up to a power of two
+			SegmentedVector<Foo> v_2(10);
+			Assert::IsTrue(v_2.IsEmpty());
+			Assert::AreEqual(16_z, v_2.Capacity());
+			Assert::AreEqual(1_z, v_2.SegmentCount());
+
+			SegmentedVector<Foo> v_3(1);
+			Assert::AreEqual(8_z, v_3.Capacity());
+		}
+
+		TEST_METHOD(TestPushBackKeepsAddresses)
+		{
+			SegmentedVector<Foo> v;
+			Vector<const Foo*> addresses;
+			for (int index = 0; index < 100; ++index)
+			{
+				addresses.PushBack(&v.PushBack(Foo(index)));
+			}
+
+			// 8 + 16 + 32 + 64
+			Assert::AreEqual(100_z, v.Size());
+			Assert::AreEqual(120_z, v.Capacity());
+			Assert::AreEqual(4_z, v.SegmentCount());
+
+			for (int index = 0; index < 100; ++index)
+			{
+				Assert::IsTrue(addresses[index] == &v[index]);
+				Assert::AreEqual(index, v[index].Data());
+			}
+
+			Foo& emplaced = v.EmplaceBack(v.Front().Data());
+			Assert::IsTrue(&emplaced == &v.Back());
+			Assert::AreEqual(0, emplaced.Data());
+			Assert::ExpectException<std::runtime_error>([&v] { v[v.Size()]; });
+			Assert::ExpectException<std::runtime_error>([&v] { v.at(v.Size()); });
+		}
+
+		TEST_METHOD(TestReserve)
+		{
+			SegmentedVector<Foo> v;
+			v.Reserve(5);
+			Assert::AreEqual(8_z, v.Capacity());
+			Foo& first = v.PushBack(Foo(1));
+
+			// A vector with elements grows by whole segments
+			v.Reserve(20);
+			Assert::AreEqual(24_z, v.Capacity());
+			Assert::IsTrue(&first == &v.Front());
+
+			v.Reserve(2);
+			Assert::AreEqual(24_z, v.Capacity());
+		}
+
+		TEST_METHOD(TestCopyAndMove)
+		{
+			SegmentedVector<Foo> v;
+			for (int index = 0; index < 20; ++index)
+			{
+				v.PushBack(Foo(index));
+			}
+
+			SegmentedVector<Foo> copy(v);
+			Assert::AreEqual(20_z, copy.Size());
+			Assert::AreEqual(1_z, copy.SegmentCount());
+			Assert::AreEqual(Foo(19), copy.Back());
+
+			const Foo* front = &v.Front();
+			SegmentedVector<Foo> moved(std::move(v));
+			Assert::IsTrue(v.IsEmpty());
+			Assert::AreEqual(0_z, v.Capacity());
+			Assert::IsTrue(front == &moved.Front());
+
+			v = copy;
+			Assert::AreEqual(20_z, v.Size());
+			Assert::AreEqual(Foo(7), v[7]);
+
+			copy = std::move(moved);
+			Assert::IsTrue(front == &copy.Front());
+			Assert::IsTrue(moved.IsEmpty());
+		}
+
+		TEST_METHOD(TestClear)
+		{
+			SegmentedVector<Foo> v;
+			for (int index = 0; index < 10; ++index)
+			{
+				v.PushBack(Foo(index));
+			}
+
+			const size_t capacity = v.Capacity();
+			v.Clear();
+			Assert::IsTrue(v.IsEmpty());
+			Assert::AreEqual(capacity, v.Capacity());
+			Assert::ExpectException<std::runtime_error>([&v] { v.Front(); });
+			Assert::ExpectException<std::runtime_error>([&v] { v.Back(); });
+
+			v.PushBack(Foo(3));
+			v.ShrinkToFit();
+			Assert::AreEqual(capacity, v.Capacity());
+
+			v.Clear();
+			v.ShrinkToFit();
+			Assert::AreEqual(0_z, v.Capacity());
+		}
+
+		TEST_METHOD(TestIterators)
+		{
+			SegmentedVector<Foo> v;
+			for (int index = 0; index < 10; ++index)
+			{
+				v.PushBack(Foo(index));
+			}
+
+			int expected = 0;
+			for (const Foo& value : v)
+			{
+				Assert::AreEqual(Foo(expected++), value);
+			}
+			Assert::AreEqual(10, expected);
+
+			auto it = v.end();
+			--it;
+			Assert::AreEqual(9, it->Data());
+			it--;
+			Assert::AreEqual(Foo(8), *it);
+			Assert::IsTrue(it++ != v.end());
+
+			SegmentedVector<Foo>::ConstIterator const_it = v.begin();
+			Assert::IsTrue(const_it == v.cbegin());
+			++const_it;
+			Assert::AreEqual(1, const_it->Data());
+			const_it--;
+			Assert::AreEqual(Foo(0), *const_it);
+
+			const SegmentedVector<Foo>& const_v = v;
+			size_t count = 0_z;
+			for (auto cit = const_v.begin(); cit != const_v.end(); cit++)
+			{
+				++count;
+			}
+			Assert::AreEqual(10_z, count);
+			Assert::IsTrue(const_v.end() == v.cend());
+
+#if FIEA_DEBUG_ITERATORS
+			SegmentedVector<Foo>::Iterator orphan;
+			Assert::ExpectException<std::runtime_error>([&orphan] { ++orphan; });
+			Assert::ExpectException<std::runtime_error>([&orphan] { --orphan; });
+			Assert::ExpectException<std::runtime_error>([&orphan] { *orphan; });
+
+			SegmentedVector<Foo>::ConstIterator const_orphan;
+			Assert::ExpectException<std::runtime_error>([&const_orphan] { ++const_orphan; });
+			Assert::ExpectException<std::runtime_error>([&const_orphan] { --const_orphan; });
+			Assert::ExpectException<std::runtime_error>([&const_orphan] { *const_orphan; });
+			Assert::ExpectException<std::runtime_error>([&v] { *v.end(); });
+#endif
+		}
+
+	private:
+		static _CrtMemState sStartMemState; // Static members before C++17 could only be defined separate from declaration
+	};
+
+	_CrtMemState SegmentedVectorTests::sStartMemState;
+}
@@ -0,0 +1,379 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <exception>
+#include <string>
+#include <CppUnitTest.h>
+#include "ToStringSpecializations.h"
+#include "Foo.h"
+#include "SmallVector.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SmallVectorTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(ClassInitialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF); // Changes the way that "new" works
+			_CrtMemCheckpoint(&sStartMemState);
+#endif // Debug
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+#ifdef _DEBUG
+
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leak"); // Makes this string a wide character
+			}
+#endif // DEBUG
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			const Foo c(30);
+
+			SmallVector<Foo, 4> v;
+			Assert::IsTrue(v.IsEmpty());
+			Assert::IsTrue(v.IsInline());
+			Assert::AreEqual(4_z, v.Capacity());
+
+			SmallVector<Foo, 4> v_2{ a, b, c };
+			Assert::AreEqual(3_z, v_2.Size());
+			Assert::IsTrue(v_2.IsInline());
+			Assert::AreEqual(c, v_2.Back());
+
+			// Asking for more than fits inline goes straight to the heap
+			SmallVector<Foo, 4> v_3(10);
+			Assert::IsFalse(v_3.IsInline());
+			Assert::AreEqual(10_z, v_3.Capacity());
+			Assert::IsTrue(v_3.IsEmpty());
+
+			SmallVector<Foo, 2> v_4{ a, b, c };
+			Assert::IsFalse(v_4.IsInline());
+			Assert::AreEqual(a, v_4.Front());
+			Assert::AreEqual(c, v_4.Back());
+		}
+
+		TEST_METHOD(TestCopy)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			const Foo c(30);
+
+			// Inline
+			{
+				const SmallVector<Foo, 4> v{ a, b };
+				SmallVector<Foo, 4> copy(v);
+				Assert::IsTrue(copy.IsInline());
+				Assert::AreEqual(2_z, copy.Size());
+				Assert::AreEqual(b, copy[1]);
+				Assert::IsFalse(v.Data() == copy.Data());
+			}
+			// Heap, but the copy only reserves what it needs
+			{
+				SmallVector<Foo, 2> v(16);
+				v.PushBack(a);
+				v.PushBack(b);
+				v.PushBack(c);
+				SmallVector<Foo, 2> copy(v);
+				Assert::IsFalse(copy.IsInline());
+				Assert::AreEqual(3_z, copy.Capacity());
+				Assert::AreEqual(c, copy.Back());
+
+				v.PopBack();
+				v.PopBack();
+				copy = v;
+				Assert::AreEqual(1_z, copy.Size());
+				Assert::AreEqual(a, copy.Front());
+
+				copy = copy;
+				Assert::AreEqual(1_z, copy.Size());
+			}
+		}
+
+		TEST_METHOD(TestMove)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			const Foo c(30);
+
+			// Inline elements are moved one at a time
+			{
+				SmallVector<Foo, 4> v{ a, b };
+				SmallVector<Foo, 4> moved(std::move(v));
+				Assert::IsTrue(moved.IsInline());
+				Assert::AreEqual(2_z, moved.Size());
+				Assert::AreEqual(a, moved.Front());
+				Assert::IsTrue(v.IsEmpty());
+				Assert::IsTrue(v.IsInline());
+			}
+			// A heap array is taken as is
+			{
+				SmallVector<Foo, 2> v{ a, b, c };
+				const Foo* array = v.Data();
+				SmallVector<Foo, 2> moved(std::move(v));
+				Assert::IsTrue(moved.Data() == array);
+				Assert::IsTrue(v.IsEmpty());
+				Assert::IsTrue(v.IsInline());
+				Assert::AreEqual(2_z, v.Capacity());
+
+				// The moved from vector is still usable
+				v.PushBack(c);
+				Assert::AreEqual(c, v.Front());
+
+				// Assigning over a heap array frees it
+				SmallVector<Foo, 2> target{ c, b, a };
+				target = std::move(moved);
+				Assert::IsTrue(target.Data() == array);
+				Assert::AreEqual(3_z, target.Size());
+
+				target = std::move(v);
+				Assert::IsTrue(target.IsInline());
+				Assert::AreEqual(1_z, target.Size());
+				Assert::AreEqual(c, target.Front());
+			}
+		}
+
+		TEST_METHOD(TestAccessors)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			SmallVector<Foo, 2> v;
+			Assert::ExpectException<std::runtime_error>([&v] { v.Front(); });
+			Assert::ExpectException<std::runtime_error>([&v] { v.Back(); });
+			Assert::ExpectException<std::runtime_error>([&v] { v[0]; });
+
+			v.PushBack(a);
+			v.PushBack(b);
+			Assert::AreEqual(a, v[0]);
+			Assert::AreEqual(b, v.at(1));
+			Assert::ExpectException<std::runtime_error>([&v] { v.at(2); });
+
+			const SmallVector<Foo, 2>& const_v = v;
+			Assert::AreEqual(a, const_v.Front());
+			Assert::AreEqual(b, const_v.Back());
+			Assert::AreEqual(b, const_v[1]);
+			Assert::ExpectException<std::runtime_error>([&const_v] { const_v.at(2); });
+			Assert::IsTrue(const_v.Data() == &const_v.Front());
+		}
+
+		TEST_METHOD(TestPushBack)
+		{
+			SmallVector<Foo, 4> v;
+			for (int value = 0; value < 4; ++value)
+			{
+				v.PushBack(Foo(value));
+			}
+
+			Assert::IsTrue(v.IsInline());
+			Assert::AreEqual(4_z, v.Capacity());
+
+			// The fifth element spills everything to the heap
+			const Foo fifth(4);
+			auto it = v.PushBack(fifth);
+			Assert::IsFalse(v.IsInline());
+			Assert::IsTrue(v.Capacity() > 4_z);
+			Assert::AreEqual(fifth, *it);
+			for (int value = 0; value < 5; ++value)
+			{
+				Assert::AreEqual(Foo(value), v[static_cast<size_t>(value)]);
+			}
+
+			// Pushing one of its own elements while full, since the element is built before the array moves
+			SmallVector<Foo, 2> full{ Foo(1), Foo(2) };
+			full.PushBack(full.Front());
+			Assert::AreEqual(Foo(1), full.Back());
+
+			SmallVector<std::string, 2> strings;
+			strings.EmplaceBack(40_z, 'a');
+			strings.EmplaceBack("short");
+			strings.EmplaceBack(3_z, 'c');
+			Assert::AreEqual(std::string(40, 'a'), strings[0]);
+			Assert::AreEqual(std::string("ccc"), strings.Back());
+		}
+
+		TEST_METHOD(TestEmplace)
+		{
+			SmallVector<Foo, 3> v{ Foo(1), Foo(3) };
+			auto it = v.Emplace(v.Find(Foo(3)), 2);
+			Assert::AreEqual(Foo(2), *it);
+			Assert::IsTrue(v.IsInline());
+
+			v.Emplace(v.begin(), 0);
+			Assert::IsFalse(v.IsInline());
+			v.Emplace(v.end(), 4);
+			for (int value = 0; value < 5; ++value)
+			{
+				Assert::AreEqual(Foo(value), v[static_cast<size_t>(value)]);
+			}
+
+			SmallVector<Foo, 3> other;
+			Assert::ExpectException<std::runtime_error>([&v, &other] { v.Emplace(other.begin(), 0); });
+
+			SmallVector<size_t, 4> sizes{ 1_z, 3_z };
+			sizes.Emplace(sizes.Find(3_z), 2_z);
+			Assert::AreEqual(2_z, sizes[1]);
+		}
+
+		TEST_METHOD(TestAppend)
+		{
+			const Foo values[] = { Foo(1), Foo(2), Foo(3) };
+			SmallVector<Foo, 4> v;
+			v.Append(std::span<const Foo>(values));
+			Assert::IsTrue(v.IsInline());
+			Assert::AreEqual(3_z, v.Size());
+
+			v.Append(std::span<const Foo>(values));
+			Assert::IsFalse(v.IsInline());
+			Assert::AreEqual(6_z, v.Size());
+			Assert::AreEqual(Foo(3), v.Back());
+
+			// An empty vector takes a heap array as is
+			SmallVector<Foo, 4> taken;
+			const Foo* array = v.Data();
+			taken.Append(std::move(v));
+			Assert::IsTrue(taken.Data() == array);
+			Assert::AreEqual(6_z, taken.Size());
+			Assert::IsTrue(v.IsEmpty());
+
+			// Otherwise the elements are moved across
+			SmallVector<Foo, 4> inline_source{ Foo(7), Foo(8) };
+			taken.Append(std::move(inline_source));
+			Assert::AreEqual(8_z, taken.Size());
+			Assert::AreEqual(Foo(8), taken.Back());
+			Assert::IsTrue(inline_source.IsEmpty());
+		}
+
+		TEST_METHOD(TestFindAndRemove)
+		{
+			SmallVector<Foo, 4> v{ Foo(1), Foo(2), Foo(3), Foo(4) };
+			Assert::IsTrue(v.Find(Foo(9)) == v.end());
+			Assert::AreEqual(Foo(3), *v.Find(Foo(3)));
+
+			const SmallVector<Foo, 4>& const_v = v;
+			Assert::AreEqual(Foo(2), *const_v.Find(Foo(2)));
+
+			Assert::IsTrue(v.Remove(Foo(2)));
+			Assert::IsFalse(v.Remove(Foo(2)));
+			Assert::AreEqual(3_z, v.Size());
+			Assert::AreEqual(Foo(3), v[1]);
+
+			Assert::IsTrue(v.Remove(v.begin(), v.Find(Foo(4))));
+			Assert::AreEqual(1_z, v.Size());
+			Assert::AreEqual(Foo(4), v.Front());
+			Assert::IsFalse(v.Remove(v.begin(), v.begin()));
+
+			SmallVector<Foo, 4> other;
+			Assert::ExpectException<std::runtime_error>([&v, &other] { v.Remove(other.begin()); });
+			Assert::ExpectException<std::runtime_error>([&v, &other] { v.Remove(v.begin(), other.end()); });
+			Assert::ExpectException<std::runtime_error>([&v] { v.Remove(v.end(), v.begin()); });
+
+			SmallVector<size_t, 2> sizes{ 1_z, 2_z, 3_z, 4_z };
+			sizes.Remove(2_z);
+			sizes.Remove(sizes.begin(), sizes.Find(4_z));
+			Assert::AreEqual(1_z, sizes.Size());
+			Assert::AreEqual(4_z, sizes.Front());
+		}
+
+		TEST_METHOD(TestResizeAndShrink)
+		{
+			SmallVector<Foo, 4> v;
+			v.Resize(3);
+			Assert::IsTrue(v.IsInline());
+			Assert::AreEqual(Foo(), v.Back());
+
+			v.Resize(6);
+			Assert::IsFalse(v.IsInline());
+			Assert::AreEqual(6_z, v.Size());
+
+			// Shrinking while the elements still need the heap keeps them there
+			v.Reserve(20);
+			v.ShrinkToFit();
+			Assert::IsFalse(v.IsInline());
+			Assert::AreEqual(6_z, v.Capacity());
+
+			// Once they fit inline again they move back and the heap array is freed
+			v.Resize(2);
+			v[1] = Foo(5);
+			v.ShrinkToFit();
+			Assert::IsTrue(v.IsInline());
+			Assert::AreEqual(4_z, v.Capacity());
+			Assert::AreEqual(Foo(5), v.Back());
+
+			v.Clear();
+			Assert::IsTrue(v.IsEmpty());
+			Assert::IsTrue(v.IsInline());
+
+			SmallVector<size_t, 2> sizes{ 1_z, 2_z, 3_z };
+			sizes.Reserve(32);
+			sizes.ShrinkToFit();
+			Assert::AreEqual(3_z, sizes.Capacity());
+			sizes.PopBack();
+			sizes.ShrinkToFit();
+			Assert::IsTrue(sizes.IsInline());
+			Assert::AreEqual(2_z, sizes.Back());
+		}
+
+		TEST_METHOD(TestIterators)
+		{
+			SmallVector<Foo, 2> v{ Foo(1), Foo(2), Foo(3) };
+			int expected = 1;
+			for (const Foo& value : v)
+			{
+				Assert::AreEqual(Foo(expected++), value);
+			}
+
+			auto it = v.end();
+			--it;
+			Assert::AreEqual(3, it->Data());
+			it--;
+			Assert::AreEqual(Foo(2), *it);
+			Assert::IsTrue(it++ != v.end());
+
+			SmallVector<Foo, 2>::ConstIterator const_it = v.begin();
+			Assert::IsTrue(const_it == v.cbegin());
+			++const_it;
+			Assert::AreEqual(2, const_it->Data());
+			const_it--;
+			Assert::AreEqual(Foo(1), *const_it);
+
+			const SmallVector<Foo, 2>& const_v = v;
+			size_t count = 0_z;
+			for (auto cit = const_v.begin(); cit != const_v.end(); cit++)
+			{
+				++count;
+			}
+			Assert::AreEqual(3_z, count);
+			Assert::IsTrue(const_v.end() == v.cend());
+
+#if FIEA_DEBUG_ITERATORS
+			SmallVector<Foo, 2>::Iterator orphan;
+			Assert::ExpectException<std::runtime_error>([&orphan] { ++orphan; });
+			Assert::ExpectException<std::runtime_error>([&orphan] { --orphan; });
+			Assert::ExpectException<std::runtime_error>([&orphan] { *orphan; });
+
+			SmallVector<Foo, 2>::ConstIterator const_orphan;
+			Assert::ExpectException<std::runtime_error>([&const_orphan] { ++const_orphan; });
+			Assert::ExpectException<std::runtime_error>([&const_orphan] { --const_orphan; });
+			Assert::ExpectException<std::runtime_error>([&const_orphan] { *const_orphan; });
+			Assert::ExpectException<std::runtime_error>([&v] { *v.end(); });
+#endif
+		}
+
+	private:
+		static _CrtMemState sStartMemState; // Static members before C++17 could only be defined separate from declaration
+	};
+
+	_CrtMemState SmallVectorTests::sStartMemState;
+}
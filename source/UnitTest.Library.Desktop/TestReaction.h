@@ -26,7 +26,7 @@ namespace UnitTests
 
 		int32_t Count() const;
 	private:
-		int32_t count;
+		int32_t count = 0;
 	};
 
 	ConcreteFactory(TestReaction, FieaGameEngine::Scope)
@@ -85,6 +85,61 @@ namespace UnitTestLibraryDesktop
 			Assert::IsFalse(TypeManager::ContainsType(AttributedFoo::TypeIdClass()));
 		}
 
+		TEST_METHOD(TestGetSignaturesForType)
+		{
+			using namespace std::string_literals;
+			Assert::IsTrue(TypeManager::GetSignaturesForType(Monster::TypeIdClass()).IsEmpty());
+
+			// Registered before its parent, so the parent's signatures only show up once the parent is added
+			const Vector<Signature> monster_signatures{ Signature("Health"s, Datum::DatumTypes::Integer, 1_z, 0_z) };
+			TypeManager::AddType(Monster::TypeIdClass(), monster_signatures, AttributedFoo::TypeIdClass());
+			const Vector<Signature>& signatures = TypeManager::GetSignaturesForType(Monster::TypeIdClass());
+			Assert::AreEqual(1_z, signatures.Size());
+
+			const Vector<Signature> foo_signatures = AttributedFoo::Signatures();
+			TypeManager::AddType(AttributedFoo::TypeIdClass(), foo_signatures);
+			Assert::AreSame(signatures, TypeManager::GetSignaturesForType(Monster::TypeIdClass()));
+			Assert::AreEqual(foo_signatures.Size() + 1_z, signatures.Size());
+			Assert::AreEqual(foo_signatures.Front().name, signatures.Front().name);
+			Assert::AreEqual("Health"s, signatures.Back().name);
+
+			const Signature* health = TypeManager::GetSignature(Monster::TypeIdClass(), "Health"s);
+			Assert::IsNotNull(health);
+			Assert::AreSame(signatures.Back(), *health);
+			Assert::IsNull(TypeManager::GetSignature(Monster::TypeIdClass(), "Missing"s));
+
+			TypeManager::RemoveType(AttributedFoo::TypeIdClass());
+			Assert::AreEqual(1_z, signatures.Size());
+			Assert::AreEqual("Health"s, signatures.Front().name);
+		}
+
+		TEST_METHOD(TestGetShape)
+		{
+			Assert::IsTrue(TypeManager::GetShape(AttributedFoo::TypeIdClass()).signatures.IsEmpty());
+
+			TypeManager::AddType(AttributedFoo::TypeIdClass(), AttributedFoo::Signatures());
+			const TypeManager::Shape& shape = TypeManager::GetShape(AttributedFoo::TypeIdClass());
+			Assert::AreSame(shape.signatures, TypeManager::GetSignaturesForType(AttributedFoo::TypeIdClass()));
+			Assert::AreEqual(shape.signatures.Size(), shape.name_hashes.Size());
+			for (size_t index = 0_z; index < shape.signatures.Size(); ++index)
+			{
+				Assert::AreEqual(DefaultHash<std::string>{}(shape.signatures[index].name), shape.name_hashes[index]);
+			}
+
+			// Populated from the shape, in signature order, right after "this"
+			AttributedFoo a;
+			Assert::AreEqual(shape.signatures.Size() + 1_z, a.Size());
+			for (size_t index = 0_z; index < shape.signatures.Size(); ++index)
+			{
+				const Signature& signature = shape.signatures[index];
+				Assert::IsTrue(a.IsPrescribedAttribute(signature.name));
+				Assert::AreEqual(signature.type, a[static_cast<uint32_t>(index + 1_z)].Type());
+			}
+
+			AttributedFoo copy(a);
+			Assert::AreEqual(&copy.ExternalInteger, &copy["ExternalInteger"].Get<int>());
+		}
+
 	private:
 		static _CrtMemState sStartMemState; // Static members before C++17 could only be defined separate from declaration
 	};
@@ -179,6 +179,24 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TestData)
+		{
+			Vector<Foo> empty;
+			Assert::IsNull(empty.Data());
+
+			const Foo a(10);
+			const Foo b(20);
+			Vector<Foo> v{ a, b };
+			Assert::IsTrue(v.Data() == &v.Front());
+			Assert::AreEqual(b, v.Data()[1]);
+
+			// Iterators read through the same array
+			Assert::IsTrue(&(*v.begin()) == v.Data());
+
+			const Vector<Foo>& const_v = v;
+			Assert::IsTrue(const_v.Data() == &const_v.Front());
+		}
+
 		TEST_METHOD(TestPopBack)
 		{
 			const Foo a(10);
@@ -302,10 +320,52 @@ namespace UnitTestLibraryDesktop
 			const Foo a(10);
 			const Foo b(20);
 			const Foo c(30);
-			v.PushBack(a);				// Adds 1 to capacity
-			v.PushBack(b);				// Adds 1 to capacity
-			v.PushBack(c);				// Adds 1 to capacity
-			Assert::AreEqual(3_z, v.Capacity());
+			v.PushBack(a);				// Grows by the minimum chunk
+			v.PushBack(b);
+			v.PushBack(c);
+			Assert::AreEqual(4_z, v.Capacity());
+		}
+
+		TEST_METHOD(TestGeometricGrowth)
+		{
+			// Default Increment
+			{
+				Vector<int> v;
+				size_t reallocations = 0;
+				size_t capacity = v.Capacity();
+				for (int i = 0; i < 10000; ++i)
+				{
+					v.PushBack(i);
+					if (v.Capacity() != capacity)
+					{
+						Assert::IsTrue(v.Capacity() >= capacity + capacity / 2);
+						capacity = v.Capacity();
+						++reallocations;
+					}
+				}
+
+				Assert::AreEqual(10000_z, v.Size());
+				Assert::IsTrue(reallocations < 25_z);
+			}
+			// Doubling
+			{
+				Vector<int> v;
+				v.PushBack<GeometricIncrement<2, 1, 1>>(1);
+				Assert::AreEqual(1_z, v.Capacity());
+				v.PushBack<GeometricIncrement<2, 1, 1>>(2);
+				Assert::AreEqual(2_z, v.Capacity());
+				v.PushBack<GeometricIncrement<2, 1, 1>>(3);
+				Assert::AreEqual(4_z, v.Capacity());
+				v.PushBack<GeometricIncrement<2, 1, 1>>(4);
+				v.PushBack<GeometricIncrement<2, 1, 1>>(5);
+				Assert::AreEqual(8_z, v.Capacity());
+			}
+			// Minimum chunk
+			{
+				Vector<int> v;
+				v.PushBack<GeometricIncrement<3, 2, 16>>(1);
+				Assert::AreEqual(16_z, v.Capacity());
+			}
 		}
 
 		TEST_METHOD(TestPushBack)
@@ -318,10 +378,10 @@ namespace UnitTestLibraryDesktop
 				const Foo a(10);
 				const Foo b(20);
 				const Foo c(30);
-				v.PushBack(a);			// Adds 1 to capacity
-				v.PushBack(b);			// Adds 1 to capacity
-				v.PushBack(c);			// Adds 1 to capacity
-				Assert::AreEqual(3_z, v.Capacity());
+				v.PushBack(a);			// Grows by the minimum chunk
+				v.PushBack(b);
+				v.PushBack(c);
+				Assert::AreEqual(4_z, v.Capacity());
 				Assert::AreEqual(3_z, v.Size());
 				Assert::AreEqual(a, v.Front());
 				Assert::AreEqual(c, v.Back());
@@ -374,6 +434,91 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TestEmplace)
+		{
+			using namespace std::string_literals;
+
+			// EmplaceBack
+			{
+				Vector<Foo> v;
+				v.EmplaceBack(10);
+				v.EmplaceBack(20);
+				Assert::AreEqual(2_z, v.Size());
+				Assert::AreEqual(Foo(10), v.Front());
+				Assert::AreEqual(Foo(20), v.Back());
+
+				// An argument from the vector itself survives the growth it causes
+				Vector<std::string> strings;
+				strings.EmplaceBack<IncrementStrategy>("A string long enough to live on the heap"s);
+				Assert::AreEqual(1_z, strings.Capacity());
+				strings.EmplaceBack(strings.Front());
+				Assert::AreEqual(strings.Front(), strings.Back());
+				strings.EmplaceBack(3_z, 'x');
+				Assert::AreEqual("xxx"s, strings.Back());
+			}
+			// Emplace
+			{
+				Vector<Foo> v{ Foo(10), Foo(30) };
+				auto it = v.Emplace(++v.begin(), 20);
+				Assert::AreEqual(Foo(20), *it);
+				v.Emplace(v.begin(), 0);
+				v.Emplace(v.end(), 40);
+				Assert::AreEqual(5_z, v.Size());
+				for (size_t index = 0_z; index < v.Size(); ++index)
+				{
+					Assert::AreEqual(Foo(static_cast<int>(index) * 10), v[index]);
+				}
+
+				Vector<int> integers{ 1, 3 };
+				integers.Emplace(++integers.begin(), 2);
+				Assert::AreEqual(2, integers[1]);
+				Assert::AreEqual(3, integers[2]);
+
+				Vector<Foo> other;
+				Assert::ExpectException<std::runtime_error>([&v, &other] { v.Emplace(other.begin(), 0); });
+			}
+		}
+
+		TEST_METHOD(TestAppend)
+		{
+			using namespace std::string_literals;
+
+			// Copies from a span
+			{
+				const Foo values[3] = { Foo(10), Foo(20), Foo(30) };
+				Vector<Foo> v{ Foo(0) };
+				v.Append(std::span<const Foo>(values));
+				Assert::AreEqual(4_z, v.Size());
+				Assert::AreEqual(Foo(30), v.Back());
+				Assert::AreEqual(Foo(10), values[0]);
+
+				Vector<int> integers;
+				const int numbers[5] = { 1, 2, 3, 4, 5 };
+				integers.Append(std::span<const int>(numbers));
+				integers.Append(std::span<const int>());
+				Assert::AreEqual(5_z, integers.Size());
+				Assert::AreEqual(5, integers.Back());
+			}
+			// Moves from another vector
+			{
+				Vector<std::string> source{ "A string long enough to live on the heap"s, "Second"s };
+				const char* buffer = source.Front().c_str();
+				Vector<std::string> v{ "First"s };
+				v.Append(std::move(source));
+				Assert::AreEqual(3_z, v.Size());
+				Assert::IsTrue(source.IsEmpty());
+				Assert::IsTrue(buffer == v[1].c_str());
+
+				// An empty destination takes the whole array
+				Vector<std::string> empty;
+				v.PushBack("Fourth"s);
+				empty.Append(std::move(v));
+				Assert::AreEqual(4_z, empty.Size());
+				Assert::AreEqual("Fourth"s, empty.Back());
+				Assert::IsTrue(v.IsEmpty());
+			}
+		}
+
 		TEST_METHOD(TestFind)
 		{
 			Vector<Foo> v;